@@ -1,1326 +1,32 @@
 #include "ActionData.h"
+#include "ActionSpec.h"
 
 namespace ms
 {
 
-ActionData::ActionData(std::int32_t bZigzag, std::int32_t bPieced, std::string sName)
-    : m_sName(std::move(sName))
+ActionData::ActionData(std::int32_t bZigzag, std::int32_t bPieced, std::string_view sName)
+    : m_sName(sName)
     , m_bZigzag(bZigzag)
     , m_bPieced(bPieced)
 {
 }
 
-ActionData s_aCharacterActionData[ACTIONDATA_COUNT] = {
-    {0, 0, "walk1"},
-    {0, 0, "walk2"},
-    {1, 0, "stand1"},
-    {1, 0, "stand2"},
-    {1, 0, "alert"},
-    {0, 0, "swingO1"},
-    {0, 0, "swingO2"},
-    {0, 0, "swingO3"},
-    {0, 0, "swingOF"},
-    {0, 0, "swingT1"},
-    {0, 0, "swingT2"},
-    {0, 0, "swingT3"},
-    {0, 0, "swingTF"},
-    {0, 0, "swingP1"},
-    {0, 0, "swingP2"},
-    {0, 0, "swingPF"},
-    {0, 0, "stabO1"},
-    {0, 0, "stabO2"},
-    {0, 0, "stabOF"},
-    {0, 0, "stabT1"},
-    {0, 0, "stabT2"},
-    {0, 0, "stabTF"},
-    {0, 0, "shoot1"},
-    {0, 0, "shoot2"},
-    {0, 0, "proneStab"},
-    {0, 0, "prone"},
-    {0, 0, "heal"},
-    {0, 0, "fly"},
-    {0, 0, "jump"},
-    {0, 0, "sit"},
-    {0, 0, "ladder"},
-    {0, 0, "rope"},
-    {0, 0, "dead"},
-    {0, 0, "blink"},
-    {0, 1, "rune"},
-    {0, 1, "runeAttack"},
-    {0, 1, "swingD1"},
-    {0, 1, "swingD2"},
-    {0, 1, "stabD1"},
-    {0, 1, "swingDb1"},
-    {0, 1, "swingDb2"},
-    {0, 1, "swingC1"},
-    {0, 1, "swingC2"},
-    {0, 1, "tripleBlow"},
-    {0, 1, "quadBlow"},
-    {0, 1, "deathBlow"},
-    {0, 1, "finishBlow"},
-    {0, 1, "finishAttack_link"},
-    {0, 1, "finishAttack_link2"},
-    {0, 0, "swingO1"},
-    {0, 0, "swingO2"},
-    {0, 0, "swingO3"},
-    {0, 1, "shootDb1"},
-    {0, 0, "shootF"},
-    {0, 1, "shotC1"},
-    {0, 0, "swingO1"},
-    {0, 0, "swingO3"},
-    {0, 0, "stabO1"},
-    {0, 0, "tired"},
-    {0, 1, "tank_prone"},
-    {0, 1, "proneStab_jaguar"},
-    {0, 1, "alert2"},
-    {0, 1, "alert3"},
-    {0, 1, "alert4"},
-    {0, 1, "alert5"},
-    {0, 1, "alert6"},
-    {0, 1, "alert7"},
-    {0, 1, "ladder2"},
-    {0, 1, "rope2"},
-    {0, 1, "shoot6"},
-    {0, 1, "magic1"},
-    {0, 1, "magic2"},
-    {0, 1, "magic3"},
-    {0, 1, "magic5"},
-    {0, 1, "magic6"},
-    {0, 1, "burster1"},
-    {0, 1, "burster2"},
-    {0, 1, "savage"},
-    {0, 1, "avenger"},
-    {0, 1, "assaulter"},
-    {0, 1, "prone2"},
-    {0, 1, "assassination"},
-    {0, 1, "assassinationS"},
-    {0, 1, "tornadoDash"},
-    {0, 1, "tornadoDashStop"},
-    {0, 1, "tornadoRush"},
-    {0, 1, "rush"},
-    {0, 1, "rush2"},
-    {0, 1, "brandish1"},
-    {0, 1, "brandish2"},
-    {0, 1, "braveslash1"},
-    {0, 1, "braveslash2"},
-    {0, 1, "braveslash3"},
-    {0, 1, "braveslash4"},
-    {0, 1, "darkImpale"},
-    {0, 1, "sanctuary"},
-    {0, 1, "meteor"},
-    {0, 1, "paralyze"},
-    {0, 1, "blizzard"},
-    {0, 1, "genesis"},
-    {0, 1, "chargeBlow"},
-    {0, 1, "ninjastorm"},
-    {0, 1, "blast"},
-    {0, 1, "holyshield"},
-    {0, 1, "showdown"},
-    {0, 1, "resurrection"},
-    {0, 1, "chainlightning"},
-    {0, 1, "smokeshell"},
-    {0, 1, "handgun"},
-    {0, 1, "somersault"},
-    {0, 1, "straight"},
-    {0, 1, "eburster"},
-    {0, 1, "backspin"},
-    {0, 1, "eorb"},
-    {0, 1, "screw"},
-    {0, 1, "doubleupper"},
-    {0, 1, "dragonstrike"},
-    {0, 1, "doublefire"},
-    {0, 1, "triplefire"},
-    {0, 1, "fake"},
-    {0, 1, "airstrike"},
-    {0, 1, "edrain"},
-    {0, 1, "octopus"},
-    {0, 1, "backstep"},
-    {0, 1, "shot"},
-    {0, 1, "recovery"},
-    {0, 1, "fireburner"},
-    {0, 1, "coolingeffect"},
-    {0, 1, "fist"},
-    {0, 1, "timeleap"},
-    {0, 1, "rapidfire"},
-    {0, 1, "homing"},
-    {0, 0, "ghostwalk"},
-    {1, 0, "ghoststand"},
-    {0, 0, "ghostjump"},
-    {0, 0, "ghostproneStab"},
-    {0, 0, "ghostfly"},
-    {0, 0, "ghostladder"},
-    {0, 0, "ghostrope"},
-    {0, 0, "ghostsit"},
-    {0, 1, "cannon"},
-    {0, 1, "torpedo"},
-    {0, 1, "darksight"},
-    {0, 1, "bamboo"},
-    {0, 1, "pyramid"},
-    {0, 1, "wave"},
-    {0, 1, "blade"},
-    {0, 1, "souldriver"},
-    {0, 1, "firestrike"},
-    {0, 1, "flamegear"},
-    {0, 1, "stormbreak"},
-    {0, 1, "vampire"},
-    {0, 1, "float"},
-    {0, 1, "swingT2PoleArm"},
-    {0, 1, "swingP1PoleArm"},
-    {0, 1, "swingP2PoleArm"},
-    {0, 1, "doubleSwing"},
-    {0, 1, "tripleSwing"},
-    {0, 1, "fullSwingDouble"},
-    {0, 1, "fullSwingTriple"},
-    {0, 1, "overSwingDouble"},
-    {0, 1, "overSwingTriple"},
-    {0, 1, "rollingSpin"},
-    {0, 1, "comboSmash"},
-    {0, 1, "comboFenrir"},
-    {0, 1, "comboTempest"},
-    {0, 1, "finalCharge"},
-    {0, 1, "combatStep"},
-    {0, 1, "finalBlow"},
-    {0, 1, "finalBlow2"},
-    {0, 1, "finalToss"},
-    {0, 1, "magicmissile"},
-    {0, 1, "lightingBolt"},
-    {0, 1, "dragonBreathe"},
-    {0, 1, "breathe_prepare"},
-    {0, 1, "dragonIceBreathe"},
-    {0, 1, "icebreathe_prepare"},
-    {0, 1, "blaze"},
-    {0, 1, "fireCircle"},
-    {0, 1, "illusion"},
-    {0, 1, "magicFlare"},
-    {0, 1, "elementalReset"},
-    {0, 1, "magicRegistance"},
-    {0, 1, "recoveryAura"},
-    {0, 1, "magicBooster"},
-    {0, 1, "magicShield"},
-    {0, 1, "flameWheel"},
-    {0, 1, "killingWing"},
-    {0, 1, "OnixBlessing"},
-    {0, 1, "Earthquake"},
-    {0, 1, "soulStone"},
-    {0, 1, "dragonThrust"},
-    {0, 1, "ghostLettering"},
-    {0, 1, "darkFog"},
-    {0, 1, "slow"},
-    {0, 1, "mapleHero"},
-    {0, 1, "Awakening"},
-    {0, 1, "flyingAssaulter"},
-    {0, 1, "tripleStab"},
-    {0, 1, "fatalBlow"},
-    {0, 1, "slashStorm1"},
-    {0, 1, "slashStorm2"},
-    {0, 1, "bloodyStorm"},
-    {0, 1, "flashBang"},
-    {0, 1, "upperStab"},
-    {0, 1, "bladeFury"},
-    {0, 1, "chainPull"},
-    {0, 1, "chainAttack"},
-    {0, 1, "owlDead"},
-    {0, 1, "monsterBombPrepare"},
-    {0, 1, "monsterBombThrow"},
-    {0, 1, "finalCut"},
-    {0, 1, "finalCutPrepare"},
-    {0, 1, "DBbladeAscension"},
-    {0, 1, "cyclone_pre"},
-    {0, 1, "cyclone"},
-    {0, 1, "cyclone_after"},
-    {0, 1, "doubleJump"},
-    {0, 1, "knockback"},
-    {0, 1, "darkTornado_pre"},
-    {0, 1, "darkTornado"},
-    {0, 1, "darkTornado_after"},
-    {0, 1, "dungdung"},
-    {0, 1, "rbooster_pre"},
-    {0, 1, "rbooster"},
-    {0, 1, "rbooster_after"},
-    {0, 1, "crossRoad"},
-    {0, 1, "nemesis"},
-    {0, 1, "wildbeast"},
-    {0, 1, "siege_pre"},
-    {0, 1, "siege"},
-    {0, 1, "siege_stand"},
-    {0, 1, "siege_after"},
-    {0, 1, "tank_pre"},
-    {0, 1, "tank"},
-    {0, 1, "tank_stand"},
-    {0, 1, "tank_after"},
-    {0, 1, "tank_walk"},
-    {0, 1, "tank_laser"},
-    {0, 1, "tank_siegepre"},
-    {0, 1, "tank_siegeattack"},
-    {0, 1, "tank_siegestand"},
-    {0, 1, "tank_siegeafter"},
-    {0, 1, "tank_hoverpre"},
-    {0, 1, "tank_hoverattack"},
-    {0, 1, "tank_hoverstand"},
-    {0, 1, "tank_hoverafter"},
-    {0, 1, "tank_hovermove"},
-    {0, 1, "tank_hovermRush"},
-    {0, 1, "sonicBoom"},
-    {0, 1, "revive"},
-    {0, 1, "darkLightning"},
-    {0, 1, "darkChain"},
-    {0, 1, "glacialChain"},
-    {0, 1, "flamethrower_pre"},
-    {0, 1, "flamethrower"},
-    {0, 1, "flamethrower_after"},
-    {0, 1, "flamethrower_pre2"},
-    {0, 1, "flamethrower2"},
-    {0, 1, "flamethrower_after2"},
-    {0, 1, "mbooster"},
-    {0, 1, "msummon"},
-    {0, 1, "msummon2"},
-    {0, 1, "gatlingshot"},
-    {0, 1, "gatlingshot2"},
-    {0, 1, "drillrush"},
-    {0, 1, "earthslug"},
-    {0, 1, "rpunch"},
-    {0, 1, "clawCut"},
-    {0, 1, "swallow_attack"},
-    {0, 1, "WHassistantHuntingUnit"},
-    {0, 1, "WHextendMagazine"},
-    {0, 1, "capture"},
-    {0, 1, "ride"},
-    {0, 1, "getoff"},
-    {0, 1, "ride2"},
-    {0, 1, "getoff2"},
-    {0, 1, "ride3"},
-    {0, 1, "getoff3"},
-    {0, 1, "mRush"},
-    {0, 1, "tank_msummon"},
-    {0, 1, "tank_msummon2"},
-    {0, 1, "tank_mRush"},
-    {0, 1, "tank_rbooster_pre"},
-    {0, 1, "tank_rbooster_after"},
-    {0, 1, "gather0"},
-    {0, 1, "gather1"},
-    {0, 1, "OnixProtection"},
-    {0, 1, "OnixWill"},
-    {0, 1, "phantomBlow"},
-    {0, 1, "comboJudgement"},
-    {0, 1, "arrowRain"},
-    {0, 1, "arrowEruption"},
-    {0, 1, "iceStrike"},
-    {0, 1, "explosion"},
-    {0, 1, "pvpko"},
-    {0, 1, "pvpko2"},
-    {0, 1, "swingT2Giant"},
-    {0, 1, "counterCannon"},
-    {0, 1, "cannonJump"},
-    {0, 1, "swiftShot"},
-    {0, 1, "slayerDoubleJump"},
-    {0, 1, "giganticBackstep"},
-    {0, 1, "mistEruption"},
-    {0, 1, "cannonSmash"},
-    {0, 1, "cannonSlam"},
-    {0, 1, "flamesplash"},
-    {0, 1, "piratebless"},
-    {0, 1, "rushBoom"},
-    {0, 1, "noiseWave"},
-    {0, 1, "noiseWave_pre"},
-    {0, 1, "noiseWave_ing"},
-    {0, 1, "monkeyBoomboom"},
-    {0, 1, "superCannon"},
-    {0, 1, "magneticCannon"},
-    {0, 1, "jShot"},
-    {0, 1, "demonSlasher"},
-    {0, 1, "bombExplosion"},
-    {0, 1, "cannonSpike"},
-    {0, 1, "speedDualShot"},
-    {0, 1, "strikeDual"},
-    {0, 1, "cannonBooster"},
-    {0, 1, "crossPiercing"},
-    {0, 1, "piercing"},
-    {0, 1, "spiritJump"},
-    {0, 1, "elfTornado"},
-    {0, 1, "immolation"},
-    {0, 1, "deathDraw"},
-    {0, 1, "healingAttack"},
-    {0, 1, "edgeSpiral"},
-    {0, 1, "windEffect"},
-    {0, 1, "elfrush"},
-    {0, 1, "elfrush2"},
-    {0, 1, "elfrush_final"},
-    {0, 1, "elfrush_final2"},
-    {0, 1, "demolitionElf"},
-    {0, 1, "dealingRush"},
-    {0, 1, "pirateSpirit"},
-    {0, 1, "maxForce0"},
-    {0, 1, "maxForce1"},
-    {0, 1, "maxForce2"},
-    {0, 1, "maxForce3"},
-    {0, 1, "demonGravity"},
-    {0, 1, "powerEndure"},
-    {0, 1, "darkThrust"},
-    {0, 1, "demonTrace"},
-    {0, 1, "demonTracePrep"},
-    {0, 1, "dualVulcanPrep"},
-    {0, 1, "dualVulcanLoop"},
-    {0, 1, "dualVulcanEnd"},
-    {0, 1, "darkSpin"},
-    {0, 1, "devilCry"},
-    {0, 1, "blessOfGaia"},
-    {0, 1, "darkDevilCry"},
-    {0, 1, "rollingElf"},
-    {0, 1, "bluntSmashPrep"},
-    {0, 1, "bluntSmashLoop"},
-    {0, 1, "bluntSmashEnd"},
-    {0, 1, "demonicBreathe_prep"},
-    {0, 1, "demonicBreathe"},
-    {0, 1, "demonicBreathe_end"},
-    {0, 1, "demonJumpUpward"},
-    {0, 1, "demonJumpFoward"},
-    {0, 1, "soulEater_prep"},
-    {0, 1, "soulEater"},
-    {0, 1, "soulEater_end"},
-    {0, 1, "devilishPower"},
-    {0, 1, "demonImpact"},
-    {0, 1, "demonbind"},
-    {0, 1, "provoc"},
-    {0, 1, "demonFly"},
-    {0, 1, "demonFly2"},
-    {0, 1, "reverseGravity"},
-    {0, 1, "reverseGravity2"},
-    {0, 1, "partyHealing"},
-    {0, 1, "fallDown_direction"},
-    {0, 1, "itemThrow1"},
-    {0, 1, "itemThrow2"},
-    {0, 1, "shurikenBurst"},
-    {0, 1, "tripleThrow"},
-    {0, 1, "quadrupleThrow"},
-    {0, 1, "windTalisman"},
-    {0, 1, "suddenRaid"},
-    {0, 1, "shadeSplit"},
-    {0, 1, "edgeCarnival"},
-    {0, 1, "HTultimateDrivePrep"},
-    {0, 1, "HTultimateDrive"},
-    {0, 1, "HTultimateDriveEnd"},
-    {0, 1, "HTtempestPrep"},
-    {0, 1, "HTtempest"},
-    {0, 1, "HTswiftPhantom"},
-    {0, 1, "doubleBarrel"},
-    {0, 1, "assembleCrew"},
-    {0, 1, "bulletSmash"},
-    {0, 1, "tornadoUpper"},
-    {0, 1, "HTluckOfMasterthief"},
-    {0, 1, "HTtwilightVanish"},
-    {0, 1, "HTtwilightFinish"},
-    {0, 1, "HTdoublePiercing"},
-    {0, 1, "HTcallOfFate"},
-    {0, 1, "HTknightEngaging"},
-    {0, 1, "HTcoatOfArms"},
-    {0, 1, "HTprotectMisfortune"},
-    {0, 1, "fusillade"},
-    {0, 1, "headShot"},
-    {0, 1, "HTphantomCharge"},
-    {0, 1, "HTphantomCharge2"},
-    {0, 1, "energyBlast"},
-    {0, 1, "fistEnrage"},
-    {0, 1, "wings"},
-    {0, 1, "doubleSpiral"},
-    {0, 1, "HTphantomship"},
-    {0, 1, "SharpSlash"},
-    {0, 1, "shiningChase"},
-    {0, 1, "ShiningRay"},
-    {0, 1, "ShiningBlast"},
-    {0, 1, "SoulSlash"},
-    {0, 1, "SoulAssault"},
-    {0, 1, "ragingBlow1"},
-    {0, 1, "ragingBlow2"},
-    {0, 1, "ragingBlow3"},
-    {0, 1, "ragingBlow4"},
-    {0, 1, "LMsylphidLancer"},
-    {0, 1, "LMnoxSphere"},
-    {0, 1, "LMmornigStarfall"},
-    {0, 1, "LMtwinkleFlash"},
-    {0, 1, "LMextendMana"},
-    {0, 1, "LMshineRedemption"},
-    {0, 1, "LMdarkFalling"},
-    {0, 1, "LMvoidPressurePrepare"},
-    {0, 1, "LMvoidPressureKeydown"},
-    {0, 1, "LMvoidPressureEnd"},
-    {0, 1, "LMinviolability"},
-    {0, 1, "LMabsoluteKill"},
-    {0, 1, "LMapocalypse"},
-    {0, 1, "LMdarkCresendo"},
-    {0, 1, "LMmagicBooster"},
-    {0, 1, "LMdarkScythe"},
-    {0, 1, "LMspectralLightPrepare"},
-    {0, 1, "LMspectralLightKeydown"},
-    {0, 1, "LMspectralLightEnd"},
-    {0, 1, "LMlightReflection"},
-    {0, 1, "LMarmageddon"},
-    {0, 1, "LMlightShadowGuard"},
-    {0, 1, "DKdragonUpper"},
-    {0, 1, "DKimpactWave"},
-    {0, 1, "DKburstUp"},
-    {0, 1, "DKdragonSlash0"},
-    {0, 1, "DKdragonSlash1"},
-    {0, 1, "DKdragonSlash2"},
-    {0, 1, "DKextraKnockback"},
-    {0, 1, "DKropeConnect0"},
-    {0, 1, "DKropeConnect1"},
-    {0, 1, "DKropeConnect2"},
-    {0, 1, "DKchainPulling"},
-    {0, 1, "DKflyingSword"},
-    {0, 1, "DKwingBeat"},
-    {0, 1, "DKpestopassing"},
-    {0, 1, "DKregainStr"},
-    {0, 1, "DKenterTheDragon"},
-    {0, 1, "DKmedusa"},
-    {0, 1, "DKsoulCharge"},
-    {0, 1, "DKgigaSlasher"},
-    {0, 1, "DKearthQuake0"},
-    {0, 1, "DKearthQuake1"},
-    {0, 1, "earthBreak"},
-    {0, 1, "ABsuccessor_prep"},
-    {0, 1, "ABsuccessor"},
-    {0, 1, "ABsuccessor_end"},
-    {0, 1, "ABbubbleStar"},
-    {0, 1, "ABlyricalCross"},
-    {0, 1, "ABstingExplosion"},
-    {0, 1, "ABstingExplosion_second"},
-    {0, 1, "ABpinkScud"},
-    {0, 1, "ABpowerTransfer"},
-    {0, 1, "ABsoulSeeker"},
-    {0, 1, "ABgiganticIcycle"},
-    {0, 1, "ABlandCrash"},
-    {0, 1, "ABcallOfAncient"},
-    {0, 1, "ABironLotus"},
-    {0, 1, "ABprimalRoar"},
-    {0, 1, "ABtrinity_first"},
-    {0, 1, "ABtrinity_second"},
-    {0, 1, "ABtrinity_third"},
-    {0, 1, "ABfatality"},
-    {0, 1, "ABsoulResonance_prep"},
-    {0, 1, "ABsoulResonance"},
-    {0, 1, "ABsoulResonance_end"},
-    {0, 1, "ABsoulGaze"},
-    {0, 1, "DAexGrandCross0"},
-    {0, 1, "DAexGrandCross1"},
-    {0, 1, "DAexGrandCross2"},
-    {0, 1, "DAexGrandCross3"},
-    {0, 1, "DAexGrandCross4"},
-    {0, 1, "DAexDemonStrike"},
-    {0, 1, "DAbatsSwarm"},
-    {0, 1, "DAreleaseOverload"},
-    {0, 1, "DAabyssalRage"},
-    {0, 1, "DAexMoonLightSlash0"},
-    {0, 1, "DAexMoonLightSlash1"},
-    {0, 1, "DAexMoonLightSlash2"},
-    {0, 1, "DAexMoonLightSlash3"},
-    {0, 1, "DAexMoonLightSlash4"},
-    {0, 1, "DAshieldCharge0"},
-    {0, 1, "DAshieldCharge1"},
-    {0, 1, "DAinhaleVitalityPrep"},
-    {0, 1, "DAinhaleVitality"},
-    {0, 1, "DAinhaleVitalityEnd"},
-    {0, 1, "DAexExecution0"},
-    {0, 1, "DAexExecution1"},
-    {0, 1, "DAexExecution2"},
-    {0, 1, "DAexExecution3"},
-    {0, 1, "DAexExecution4"},
-    {0, 1, "DAshieldChasing"},
-    {0, 1, "DAarmorBreak"},
-    {0, 1, "DAthousandSword0"},
-    {0, 1, "DAforbiddenContract"},
-    {0, 1, "DAdemonBind"},
-    {0, 1, "RTionThrusterPrep"},
-    {0, 1, "RTionThruster"},
-    {0, 1, "RTionThrusterEnd"},
-    {0, 1, "RTdiagonalChase"},
-    {0, 1, "RTlinearPerspective"},
-    {0, 1, "RTenergySpline"},
-    {0, 1, "RTcombatSwitchingUp"},
-    {0, 1, "RTcombatSwitchingLeft"},
-    {0, 1, "RTcombatSwitchingRight"},
-    {0, 1, "RTbladeDancingPrep"},
-    {0, 1, "RTbladeDancing"},
-    {0, 1, "RTbladeDancingEnd"},
-    {0, 1, "RTpillarScramble"},
-    {0, 1, "RTfuzzyLobMasUp"},
-    {0, 1, "RTfuzzyLobMasLeft"},
-    {0, 1, "RTfuzzyLobMasRight"},
-    {0, 1, "RTbooster"},
-    {0, 1, "RTquickSilverSwordUp"},
-    {0, 1, "RTquickSilverSwordLeft"},
-    {0, 1, "RTquickSilverSwordRight"},
-    {0, 1, "RThologramGraffiti"},
-    {0, 1, "RTconfineEntangle"},
-    {0, 1, "RTtimeCapsule"},
-    {0, 1, "RTtankAssult"},
-    {0, 1, "CKelementalSlash"},
-    {0, 1, "CKjourneyHome"},
-    {0, 1, "STflash"},
-    {0, 1, "STwaterWave"},
-    {0, 1, "STthunder"},
-    {0, 1, "STtornado"},
-    {0, 1, "STneedleCarapace"},
-    {0, 1, "STsharkUltimate"},
-    {0, 1, "STsharkSoryuken"},
-    {0, 1, "STthunderBolt"},
-    {0, 1, "STtypoon"},
-    {0, 1, "STsharkTooth"},
-    {0, 1, "STsharkKick"},
-    {0, 1, "STelectricCharge"},
-    {0, 1, "WBbreezeArrow"},
-    {0, 1, "WBwindWalk_land"},
-    {0, 1, "WBwindWalk_air"},
-    {0, 1, "WBpinPointPierce"},
-    {0, 1, "WBemeraldFlower"},
-    {0, 1, "WBalbatross"},
-    {0, 1, "WBgustShot"},
-    {0, 1, "WBfairyTurn"},
-    {0, 1, "WBdanceOfFrozenWindPrepare"},
-    {0, 1, "WBdanceOfFrozenWindKeydown"},
-    {0, 1, "WBdanceOfFrozenWindEnd"},
-    {0, 1, "RAwhiteHeatRush"},
-    {0, 1, "SMlightFlux"},
-    {0, 1, "SMsilentMove"},
-    {0, 1, "SMsolarPierce"},
-    {0, 1, "SMfallingMoonStand"},
-    {0, 1, "SMrisingSunStand"},
-    {0, 1, "SMfallingMoon"},
-    {0, 1, "SMrisingSun"},
-    {0, 1, "SMdanceOfMoon"},
-    {0, 1, "SMdanceOfMoonAir"},
-    {0, 1, "SMmoonShadow"},
-    {0, 1, "SMcresentDivide"},
-    {0, 1, "SMspeedingSunset"},
-    {0, 1, "SMspeedingSunsetAir"},
-    {0, 1, "SMmoonCross"},
-    {0, 1, "SMsunCross"},
-    {0, 1, "SMtripleSlash"},
-    {0, 1, "SMswordOfLight"},
-    {0, 1, "SMsoulPenetration"},
-    {0, 1, "SMsolunarTime"},
-    {0, 1, "SMsoulPledge"},
-    {0, 1, "SMloudRush"},
-    {0, 1, "SMtraceCut"},
-    {0, 1, "SMshadowBurn"},
-    {0, 1, "SMfallingMoonStand2"},
-    {0, 1, "SMrisingSunStand2"},
-    {0, 1, "SMfallingMoon2"},
-    {0, 1, "SMrisingSun2"},
-    {0, 1, "SMdanceOfMoon2"},
-    {0, 1, "SMdanceOfMoonAir2"},
-    {0, 1, "SMmoonShadow2"},
-    {0, 1, "SMcresentDivide2"},
-    {0, 1, "SMspeedingSunset2"},
-    {0, 1, "SMspeedingSunsetAir2"},
-    {0, 1, "SMmoonCross2"},
-    {0, 1, "SMsunCross2"},
-    {0, 1, "SMtripleSlash2"},
-    {0, 1, "SMswordOfLight2"},
-    {0, 1, "SMsoulPenetration2"},
-    {0, 1, "SMsolunarTime2"},
-    {0, 1, "SMsoulPledge2"},
-    {0, 1, "SMloudRush2"},
-    {0, 1, "SMtraceCut2"},
-    {0, 1, "SMshadowBurn2"},
-    {0, 1, "lamanchaSpearPrep"},
-    {0, 1, "lamanchaSpear"},
-    {0, 1, "lamanchaSpearEnd"},
-    {0, 1, "slashBlast"},
-    {0, 1, "slashBlast2"},
-    {0, 1, "brandishNew"},
-    {0, 1, "brandishNew2"},
-    {0, 1, "comboForce"},
-    {0, 1, "comboForce0"},
-    {0, 1, "weaponBooster"},
-    {0, 1, "furyNew"},
-    {0, 1, "shoutNew"},
-    {0, 1, "incising"},
-    {0, 1, "magicCrash"},
-    {0, 1, "stanceNew"},
-    {0, 1, "pageOrder"},
-    {0, 1, "restoration"},
-    {0, 1, "rushNew"},
-    {0, 1, "panic"},
-    {0, 1, "threat"},
-    {0, 1, "blastNew"},
-    {0, 1, "sanctuaryNew"},
-    {0, 1, "voidCharge"},
-    {0, 1, "guardianSpirit"},
-    {0, 1, "piercingThrough"},
-    {0, 1, "spearPulling"},
-    {0, 1, "ironWallNew"},
-    {0, 1, "gungnirDescent"},
-    {0, 1, "sacrifice"},
-    {0, 1, "energyBolt"},
-    {0, 1, "magicArmor"},
-    {0, 1, "flameArrow"},
-    {0, 1, "armorMeltingPrep"},
-    {0, 1, "armorMelting"},
-    {0, 1, "armorMeltingEnd"},
-    {0, 1, "thunderBolt"},
-    {0, 1, "flameHaze"},
-    {0, 1, "meteorNew"},
-    {0, 1, "viciousSlime"},
-    {0, 1, "poisonMist"},
-    {0, 1, "elementalAdapting"},
-    {0, 1, "blizzardNew"},
-    {0, 1, "holySymbol"},
-    {0, 1, "holyArrow"},
-    {0, 1, "invincible"},
-    {0, 1, "coldBeam"},
-    {0, 1, "thunderStorm"},
-    {0, 1, "chainLightningNew"},
-    {0, 1, "frozenOrb"},
-    {0, 1, "divineProtection"},
-    {0, 1, "angelRay"},
-    {0, 1, "createHalidom"},
-    {0, 1, "castNetThrowing"},
-    {0, 1, "advancedQuiver"},
-    {0, 1, "woundsShot"},
-    {0, 1, "retreatShotPre"},
-    {0, 1, "retreatShot"},
-    {0, 1, "retreatShotEnd"},
-    {0, 1, "steigeisenConnect0"},
-    {0, 1, "steigeisenConnect1"},
-    {0, 1, "steigeisenConnect2"},
-    {0, 1, "painKiller"},
-    {0, 1, "arrowIllusion"},
-    {0, 1, "resurrectionNew"},
-    {0, 1, "uncountableArrow"},
-    {0, 1, "boltRupture"},
-    {0, 1, "snipingNew"},
-    {0, 1, "genesisNew"},
-    {0, 1, "piercingNew"},
-    {0, 1, "ragingBlowNew"},
-    {0, 1, "shadeSplitNew"},
-    {0, 1, "showDownChallenge"},
-    {0, 1, "savageBlow"},
-    {0, 1, "assassinationNew"},
-    {0, 1, "energyTornado"},
-    {0, 1, "energyBuster"},
-    {0, 1, "energyBlastNew"},
-    {0, 1, "energyBlastMax"},
-    {0, 1, "wingsNew"},
-    {0, 1, "battleShipBomberPre"},
-    {0, 1, "battleShipBomber"},
-    {0, 1, "battleShipBomberEnd"},
-    {0, 1, "chargeBlow2"},
-    {0, 1, "assassinationNew2"},
-    {0, 1, "blastNew2"},
-    {0, 1, "shadowWeb"},
-    {0, 1, "zeroAurora"},
-    {0, 1, "returnTemple"},
-    {0, 1, "zeroDash"},
-    {0, 1, "zeroDash"},
-    {0, 1, "risingSlash"},
-    {0, 1, "earthStomp"},
-    {0, 1, "moonStrike"},
-    {0, 1, "pierceAttack"},
-    {0, 1, "shadowCrossing_pre"},
-    {0, 1, "shadowCrossing"},
-    {0, 1, "upperSlash"},
-    {0, 1, "adEarthStomp"},
-    {0, 1, "adEarthStomp_shockWave"},
-    {0, 1, "shadowCrossing_blade"},
-    {0, 1, "flashStrike"},
-    {0, 1, "spinCutter"},
-    {0, 1, "adSpinCutter"},
-    {0, 1, "adSpinCutter_blade"},
-    {0, 1, "turningSwing"},
-    {0, 1, "turningDrive"},
-    {0, 1, "whirlWind_pre"},
-    {0, 1, "whirlWind"},
-    {0, 1, "frontStrike"},
-    {0, 1, "throwingWeapon"},
-    {0, 1, "adThrowingWeapon"},
-    {0, 1, "windCutter"},
-    {0, 1, "windCrash"},
-    {0, 1, "stormBreak"},
-    {0, 1, "adStormBreak"},
-    {0, 1, "gigaStrike"},
-    {0, 1, "jumpingCrash"},
-    {0, 1, "jumpingCrash_shockWave"},
-    {0, 1, "earthBreak"},
-    {0, 1, "earthBreak_shockWave"},
-    {0, 1, "adEarthBreak"},
-    {0, 1, "adEarthBreak_shockWave"},
-    {0, 1, "rollingAssaulter"},
-    {0, 1, "adRollingAssaulter"},
-    {0, 1, "adRollingAssaulter_blade"},
-    {0, 1, "rollingStomp"},
-    {0, 1, "adRollingStomp"},
-    {0, 1, "adRollingStomp_blade"},
-    {0, 1, "shadowRain_beta"},
-    {0, 1, "shadowRain_alpha"},
-    {0, 1, "dropTime"},
-    {0, 1, "dropTime_beta"},
-    {0, 1, "hurricaneWind_pre"},
-    {0, 1, "hurricaneWind"},
-    {0, 1, "hurricaneWind_end"},
-    {0, 1, "timeDistotion"},
-    {0, 1, "RMbattleSpurt"},
-    {0, 1, "HY3212battleMaster"},
-    {0, 1, "CSmonkeyFurious"},
-    {0, 1, "HY6512superNova"},
-    {0, 1, "beyonder_first"},
-    {0, 1, "beyonder_second"},
-    {0, 1, "beyonder_third"},
-    {0, 1, "HY2112comboUnlimited"},
-    {0, 1, "HY6512finalContract"},
-    {0, 1, "HY6512soulExalt"},
-    {0, 1, "HY2312wrathOfEnlil"},
-    {0, 1, "HY6112prominence"},
-    {0, 1, "HY2412roseCarteFinale"},
-    {0, 1, "FrenziedSoul"},
-    {0, 1, "HY222lightningSphere_prep"},
-    {0, 1, "HY222lightningSphere"},
-    {0, 1, "HY222lightningSphere_end"},
-    {0, 1, "HY112rageUprising"},
-    {0, 1, "HY112valhalla"},
-    {0, 1, "HY122smite"},
-    {0, 1, "HY122sacrosanctity"},
-    {0, 1, "HY132darkSynthesis"},
-    {0, 1, "HY132darkThirst"},
-    {0, 1, "HY222iceAura"},
-    {0, 1, "HY212megiddoFlame"},
-    {0, 1, "HY212fireAura"},
-    {0, 1, "HY5112deadlyCharge"},
-    {0, 1, "HY5112sacredCube"},
-    {0, 1, "HY232vengenceOfAngel"},
-    {0, 1, "HY312stormArrowMovable"},
-    {0, 1, "HY312windOfFrey"},
-    {0, 1, "HY312preperation"},
-    {0, 1, "HY322longRangeTrueShot"},
-    {0, 1, "HY322bullseye"},
-    {0, 1, "HY412fourSeasons"},
-    {0, 1, "HY412bleedingToxin"},
-    {0, 1, "HY422veilOfShadow"},
-    {0, 1, "HY434asura_prep"},
-    {0, 1, "HY434asura"},
-    {0, 1, "HY434asura_end"},
-    {0, 1, "HY434hiddenBlade"},
-    {0, 1, "HY512unityOfPower"},
-    {0, 1, "HY512stimulate"},
-    {0, 1, "HY522bigFatBoy"},
-    {0, 1, "HY522unwearyingRum"},
-    {0, 1, "HY3112cerberus"},
-    {0, 1, "HY3112blueBlood"},
-    {0, 1, "HY3312rampageAsOne"},
-    {0, 1, "HY3312silentRampage"},
-    {0, 1, "HY3512distortionField"},
-    {0, 1, "HY3512tank_distortionField"},
-    {0, 1, "HY3512tank_siege_distortionField"},
-    {0, 1, "HY532rollingCannon_prep"},
-    {0, 1, "HY532rollingCannon"},
-    {0, 1, "HY532rollingCannon_end"},
-    {0, 1, "HY3212unionAura"},
-    {0, 1, "HY3212battleKingBar_first"},
-    {0, 1, "HY3212battleKingBar_second"},
-    {0, 1, "HY3212anotherBlow"},
-    {0, 1, "RTmeltdownExplosion"},
-    {0, 1, "HY1512godOfTheSea"},
-    {0, 1, "HY1512creationOfTheBeginning"},
-    {0, 1, "HY1312monsoon"},
-    {0, 1, "HY1312stormBringer"},
-    {0, 1, "HY1112crossTheStyx"},
-    {0, 1, "HY1112crossTheStyx_prep"},
-    {0, 1, "HY1112crossTheStyx_end"},
-    {0, 1, "HY1112soulForge"},
-    {0, 1, "HY1112crossTheStyx2"},
-    {0, 1, "HY1112crossTheStyx2_prep"},
-    {0, 1, "HY1112crossTheStyx2_end"},
-    {0, 1, "iceAttack1"},
-    {0, 1, "iceAttack2"},
-    {0, 1, "iceSmash"},
-    {0, 1, "iceDoubleJump"},
-    {0, 1, "iceTempest"},
-    {0, 1, "iceChop"},
-    {0, 1, "icePanic"},
-    {0, 1, "create0"},
-    {0, 1, "create1"},
-    {0, 0, "create2"},
-    {0, 0, "create2_s"},
-    {0, 0, "create2_f"},
-    {0, 0, "create3"},
-    {0, 0, "create3_s"},
-    {0, 0, "create3_f"},
-    {0, 0, "create4"},
-    {0, 0, "create4_s"},
-    {0, 0, "create4_f"},
-    {0, 1, "shockwave"},
-    {0, 1, "demolition"},
-    {0, 1, "snatch"},
-    {0, 1, "windspear"},
-    {0, 1, "windshot"},
-    {0, 1, "fly2"},
-    {0, 1, "fly2Move"},
-    {0, 1, "fly2Skill"},
-    {0, 1, "herbalism_jaguar"},
-    {0, 1, "mining_jaguar"},
-    {0, 1, "herbalism_mechanic"},
-    {0, 1, "mining_mechanic"},
-    {0, 1, "backward"},
-    {0, 1, "stand1_floating"},
-    {0, 1, "stand2_floating"},
-    {0, 1, "stand1_floating2"},
-    {0, 1, "stand2_floating2"},
-    {0, 1, "VampDeath"},
-    {0, 0, "hide"},
-    {0, 1, "MichaelLink"},
-    {0, 0, "setitem3"},
-    {0, 0, "setitem4"},
-    {0, 1, "soulSkillDragonRiderJP"},
-    {0, 1, "soulSkillBarlogJP"},
-    {0, 1, "soulSkillPinkbeanJP"},
-    {0, 1, "soulSkillVanLeonJP"},
-    {0, 1, "soulSkillAniJP"},
-    {0, 1, "soulSkillRockJP"},
-    {0, 1, "soulSkillMugongJP"},
-    {0, 1, "soulSkillZakumJP"},
-    {0, 1, "soulSkillHontailJP"},
-    {0, 1, "soulSkillRexJP"},
-    {0, 1, "fullSoulActionJP"},
-    {0, 1, "cappufire"},
-    {0, 1, "cappucut"},
-    {0, 1, "foodFight1"},
-    {0, 1, "wiping"},
-    {0, 1, "hekatonFlightAttack"},
-    {0, 0, "dance0"},
-    {0, 0, "dance1"},
-    {0, 0, "dance2"},
-    {0, 0, "dance3"},
-    {0, 0, "mesoRed"},
-    {0, 0, "mesoBlue"},
-    {0, 0, "mesoGreen"},
-    {0, 0, "mesoYellow"},
-    {0, 0, "mesoPink"},
-    {0, 1, "shockWavePunch0"},
-    {0, 1, "shockWavePunch1"},
-    {0, 1, "shockWavePunch2"},
-    {0, 1, "groundStrike0"},
-    {0, 1, "groundStrike1"},
-    {0, 1, "cancelBackStep"},
-    {0, 1, "deathMarker"},
-    {0, 1, "momentStep"},
-    {0, 1, "divisionSoulAttack"},
-    {0, 1, "summonSoulTent_pre"},
-    {0, 1, "summonSoulTent"},
-    {0, 1, "summonRedemption"},
-    {0, 1, "spiritClaw"},
-    {0, 1, "bombPunch0"},
-    {0, 1, "bombPunch1"},
-    {0, 1, "bombPunch2"},
-    {0, 1, "bombPunch3"},
-    {0, 1, "megaPunch0"},
-    {0, 1, "megaPunch1"},
-    {0, 1, "dragPulling_front"},
-    {0, 1, "dragPulling_turn"},
-    {0, 1, "dragPulling_down"},
-    {0, 1, "spiritBarrier"},
-    {0, 1, "bindArea"},
-    {0, 1, "spiritTransformation"},
-    {0, 1, "FWflameOrb"},
-    {0, 1, "FWflameWind"},
-    {0, 1, "FWflareBlink"},
-    {0, 1, "FWfireRelease"},
-    {0, 1, "FWblazingStrike"},
-    {0, 1, "FWcolossusBomb"},
-    {0, 1, "FWflameBall"},
-    {0, 1, "FWignition"},
-    {0, 1, "FWsoulProtection"},
-    {0, 1, "FWflameSprit"},
-    {0, 1, "FWburningRegion"},
-    {0, 1, "FWultimateBurnout"},
-    {0, 1, "FWdragonSlavePrep"},
-    {0, 1, "FWdragonSlave"},
-    {0, 1, "FWdragonSlaveLast"},
-    {0, 1, "NWrapidEvasion"},
-    {0, 1, "NWdarknessOmen"},
-    {0, 1, "NWdarknessOmenPre"},
-    {0, 1, "HY1412Dominion"},
-    {0, 1, "NWshadowStitchPrepare"},
-    {0, 1, "NWtripleThrow"},
-    {0, 1, "NWtripleThrow2"},
-    {0, 1, "NWquadrupleThrow"},
-    {0, 1, "NWquadrupleThrow2"},
-    {0, 1, "NWstardust"},
-    {0, 1, "NWdarknessAscension"},
-    {0, 1, "NWquintupleThrow"},
-    {0, 1, "NWquintupleThrow2"},
-    {0, 1, "NWshadowStitch"},
-    {0, 1, "HY1412Shadowillusion"},
-    {0, 1, "NWluckySeven"},
-    {0, 1, "NWshadowServant"},
-    {0, 0, "dance_starP0"},
-    {0, 0, "dance_starP1"},
-    {0, 0, "dance_starP2"},
-    {0, 0, "dance_starP3"},
-    {0, 0, "dance_starP4"},
-    {0, 0, "dance_starP5"},
-    {0, 0, "dance_star_ev0"},
-    {0, 0, "dance_star_ev1"},
-    {0, 0, "dance_star_ev2"},
-    {0, 0, "dance_star_ev3"},
-    {0, 0, "dance_star_ev4"},
-    {0, 0, "dance_star_ev5"},
-    {0, 1, "crawl"},
-    {0, 1, "boost1"},
-    {0, 1, "boost2"},
-    {0, 1, "plane_die"},
-    {0, 1, "wakeup_swing"},
-    {0, 1, "WHdoubleShot"},
-    {0, 1, "WHtripleShot"},
-    {0, 1, "WHwildShot"},
-    {0, 1, "WHdrillContainer"},
-    {0, 1, "WHwildVulcan"},
-    {0, 1, "WHsummonJaguar"},
-    {0, 1, "advancedgatling"},
-    {0, 1, "homingmissile"},
-    {0, 1, "focusFire"},
-    {0, 1, "tank_focusFire"},
-    {0, 1, "multiFire_pre"},
-    {0, 1, "multiFire"},
-    {0, 1, "multiFire_after"},
-    {0, 1, "tank_multiFire"},
-    {0, 1, "tank_getoff2"},
-    {0, 1, "tank_ride2"},
-    {0, 1, "tank_rbooster"},
-    {0, 1, "tank_jump"},
-    {0, 1, "tank_ladder"},
-    {0, 1, "tank_rope"},
-    {0, 1, "tank_herbalism_mechanic"},
-    {0, 1, "tank_mining_mechanic"},
-    {0, 1, "georg_attack1"},
-    {0, 0, "hideBody"},
-    {0, 0, "PBwalk1"},
-    {0, 0, "PBstand1"},
-    {0, 0, "PBstand2"},
-    {0, 0, "PBstand3"},
-    {0, 0, "PBstand4"},
-    {0, 0, "PBstand5"},
-    {0, 0, "PBstand6"},
-    {0, 0, "PBstand7"},
-    {0, 0, "PBstand8"},
-    {0, 0, "PBstand9"},
-    {0, 0, "PBstand10"},
-    {0, 0, "PBstand11"},
-    {0, 0, "PBstand12"},
-    {0, 0, "PBalert"},
-    {0, 0, "PBswingO1"},
-    {0, 0, "PBswingT1"},
-    {0, 0, "PBswingTF"},
-    {0, 0, "PBswingP1"},
-    {0, 0, "PBswingPF"},
-    {0, 0, "PBswingT2Giant"},
-    {0, 0, "PBstabO1"},
-    {0, 0, "PBstabT1"},
-    {0, 0, "PBstabTF"},
-    {0, 0, "PBproneStab"},
-    {0, 0, "PBprone"},
-    {0, 0, "PBheal"},
-    {0, 0, "PBfly"},
-    {0, 0, "PBflySkill"},
-    {0, 0, "PBjump"},
-    {0, 0, "PBsit"},
-    {0, 0, "PBladder"},
-    {0, 0, "PBrope"},
-    {0, 0, "PBdead"},
-    {0, 0, "PBdead2"},
-    {0, 0, "PBblink"},
-    {0, 0, "PBAttack1"},
-    {0, 0, "PBAttack2A"},
-    {0, 0, "PBAttack2B"},
-    {0, 0, "PBAttack3A"},
-    {0, 0, "PBAttack3B"},
-    {0, 0, "PBAttack4A"},
-    {0, 0, "PBAttack4B"},
-    {0, 0, "PBUmbrella"},
-    {0, 0, "PBUmbrella_loop"},
-    {0, 0, "PBSummon"},
-    {0, 0, "PBRollingAttackPrep"},
-    {0, 0, "PBRollingAttack1"},
-    {0, 0, "PBRollingAttack2"},
-    {0, 0, "PBRollingAttackEnd"},
-    {0, 0, "PBRollingAttackAir"},
-    {0, 0, "PBOgoStickPrep"},
-    {0, 0, "PBOgoStickKeydown"},
-    {0, 0, "PBOgoStickGaugeMax"},
-    {0, 0, "PBOgoStick_sky_repeat"},
-    {0, 0, "PBOgoStickEnd"},
-    {0, 0, "PBOgoStickAttackafter"},
-    {0, 0, "PBYoyo1"},
-    {0, 0, "PBYoyo2"},
-    {0, 0, "PBPinkGenesis"},
-    {0, 0, "PBMusic1"},
-    {0, 0, "PBMusic2"},
-    {0, 0, "PBMusic3"},
-    {0, 0, "PBRelaxA"},
-    {0, 0, "PBRelaxB"},
-    {0, 0, "PBRelaxC"},
-    {0, 0, "PBRelaxD"},
-    {0, 0, "PBRelaxE"},
-    {0, 0, "PBCheer"},
-    {0, 0, "PBmangchi"},
-    {0, 0, "PBCheer"},
-    {0, 0, "PVPA1_walk"},
-    {0, 0, "PVPA1_stand"},
-    {0, 0, "PVPA1_rope"},
-    {0, 0, "PVPA1_prone"},
-    {0, 0, "PVPA1_proneStab"},
-    {0, 0, "PVPA1_jump"},
-    {0, 0, "PVPA1_die"},
-    {0, 0, "PVPA1_attack1"},
-    {0, 0, "PVPA1_attack2"},
-    {0, 0, "PVPA1_tripleAttack"},
-    {0, 0, "PVPA1_ankleAttack"},
-    {0, 0, "PVPA1_balogAttack"},
-    {0, 0, "PVPA1_ultimate"},
-    {0, 0, "PVPA2_walk"},
-    {0, 0, "PVPA2_stand"},
-    {0, 0, "PVPA2_rope"},
-    {0, 0, "PVPA2_prone"},
-    {0, 0, "PVPA2_proneStab"},
-    {0, 0, "PVPA2_jump"},
-    {0, 0, "PVPA2_die"},
-    {0, 0, "PVPA2_dummy"},
-    {0, 0, "PVPA2_attack1"},
-    {0, 0, "PVPA2_attack2"},
-    {0, 1, "PVPA2_bugle"},
-    {0, 1, "PVPA2_giantClub"},
-    {0, 0, "PVPA3_walk"},
-    {0, 0, "PVPA3_stand"},
-    {0, 0, "PVPA3_rope"},
-    {0, 0, "PVPA3_prone"},
-    {0, 0, "PVPA3_proneStab"},
-    {0, 0, "PVPA3_jump"},
-    {0, 0, "PVPA3_die"},
-    {0, 0, "PVPA3_dummy"},
-    {0, 0, "PVPA3_attack1"},
-    {0, 0, "PVPA3_attack2"},
-    {0, 1, "PVPA3_tomb"},
-    {0, 1, "PVPA3_bigdagger"},
-    {0, 1, "PVPA3_bet"},
-    {0, 0, "PVPA4_walk"},
-    {0, 0, "PVPA4_stand"},
-    {0, 0, "PVPA4_rope"},
-    {0, 0, "PVPA4_prone"},
-    {0, 0, "PVPA4_proneStab"},
-    {0, 0, "PVPA4_jump"},
-    {0, 0, "PVPA4_die"},
-    {0, 0, "PVPA4_dummy"},
-    {0, 1, "PVPA4_attack"},
-    {0, 1, "PVPA4_typoon"},
-    {0, 1, "PVPA4_meteo"},
-    {0, 0, "PVPA5_walk"},
-    {0, 0, "PVPA5_stand"},
-    {0, 0, "PVPA5_rope"},
-    {0, 0, "PVPA5_prone"},
-    {0, 0, "PVPA5_proneStab"},
-    {0, 0, "PVPA5_jump"},
-    {0, 0, "PVPA5_die"},
-    {0, 0, "PVPA5_dummy"},
-    {0, 1, "PVPA5_attack"},
-    {0, 1, "PVPA5_attack2"},
-    {0, 1, "PVPA5_heaveyKick"},
-    {0, 1, "PVPA5_swingKick"},
-    {0, 1, "PVPA5_somerSault"},
-    {0, 0, "PVPA6_walk"},
-    {0, 0, "PVPA6_stand"},
-    {0, 0, "PVPA6_rope"},
-    {0, 0, "PVPA6_prone"},
-    {0, 0, "PVPA6_proneStab"},
-    {0, 0, "PVPA6_jump"},
-    {0, 0, "PVPA6_die"},
-    {0, 0, "PVPA6_dummy"},
-    {0, 1, "PVPA6_attack"},
-    {0, 1, "PVPA6_stabShot"},
-    {0, 1, "PVPA6_iceArrow"},
-    {0, 1, "PVPA6_focusShot"},
-    {0, 0, "PVPA7_walk"},
-    {0, 0, "PVPA7_stand"},
-    {0, 0, "PVPA7_rope"},
-    {0, 0, "PVPA7_prone"},
-    {0, 0, "PVPA7_proneStab"},
-    {0, 0, "PVPA7_jump"},
-    {0, 0, "PVPA7_die"},
-    {0, 0, "PVPA7_dummy"},
-    {0, 1, "PVPA7_attack"},
-    {0, 1, "PVPA7_attack1"},
-    {0, 1, "PVPA7_gangan"},
-    {0, 1, "PVPA7_teleport"},
-    {0, 1, "PVPA7_shield"},
-    {0, 1, "PVPA7_soulAttack"},
-    {0, 0, "PVPA8_walk"},
-    {0, 0, "PVPA8_stand"},
-    {0, 0, "PVPA8_rope"},
-    {0, 0, "PVPA8_prone"},
-    {0, 0, "PVPA8_proneStab"},
-    {0, 0, "PVPA8_jump"},
-    {0, 0, "PVPA8_die"},
-    {0, 0, "PVPA8_dummy"},
-    {0, 1, "PVPA8_attack"},
-    {0, 1, "PVPA8_attack1"},
-    {0, 1, "PVPA8_rolling"},
-    {0, 1, "PVPA8_absorb"},
-    {0, 1, "PVPA8_destroy"},
-    {0, 1, "wireShot"},
-    {0, 1, "SNW_swing"},
-    {0, 1, "reactor0"},
-    {0, 1, "dash"},
-    {0, 0, "FS_Guitar_Stand_M"},
-    {0, 0, "FS_Guitar_Stroke_M"},
-    {0, 0, "FS_Guitar_Stand_W"},
-    {0, 0, "FS_Guitar_Stroke_W"},
-    {0, 1, "mangchi"},
-    {0, 1, "OpenTheBox"},
-    {0, 1, "royalGuard"},
-    {0, 1, "royalGuardAttack"},
-    {0, 1, "shiningCross"},
-    {0, 0, "dead_riding"},
-    {0, 1, "KSPsychicAttack"},
-    {0, 1, "KSPsychicForce"},
-    {0, 1, "KSPsychicForceH"},
-    {0, 1, "KSPsychicGrab"},
-    {0, 1, "KSPsychicSmash"},
-    {0, 1, "KSPsychicShoot"},
-    {0, 1, "KSPsychicShield"},
-    {0, 1, "KSPsychicWar"},
-    {0, 1, "KSbackHome"},
-    {0, 1, "KSPsychickDrain"},
-    {0, 1, "KSMadCrash"},
-    {0, 1, "KSPurePower"},
-    {0, 1, "KSUltimateTrain"},
-    {0, 1, "KSPsychicGround"},
-    {0, 1, "KSStrengthofMental"},
-    {0, 1, "KSPsychicMove"},
-    {0, 1, "KSPsychoBrake"},
-    {0, 1, "KSSpiritPurge"},
-    {0, 1, "KSUltimateFist"},
-    {0, 1, "KSEverPsychic"},
-    {0, 1, "KSPsychoMetry"},
-    {0, 1, "KSPsychicOver"},
-    {0, 1, "KSDeepImpact"},
-    {0, 1, "KSDeepImpact1"},
-    {0, 1, "KSMaterial"},
-    {0, 1, "KSCrash"},
-    {0, 1, "slashStance_KR"},
-    {0, 1, "kenjiBatdo_KR"},
-    {0, 1, "kenjiSwing1_KR"},
-    {0, 1, "kenjiSwing2_KR"},
-    {0, 1, "kenjiSwing3_KR"},
-    {0, 1, "kenjikaze_KR"},
-    {0, 1, "kenjiRush_KR"},
-    {0, 1, "kenjiJumpAttack_KR"},
-    {0, 1, "kenjiAssualt_KR"},
-    {0, 1, "kenjiHighJump_KR"},
-    {0, 1, "kenjiRanMu_KR"},
-    {0, 1, "kenjirainKatana_KR"},
-    {0, 1, "kenjidashAttack1_KR"},
-    {0, 1, "kenjidashAttack2_KR"},
-    {0, 1, "kenjidashAttack3_KR"},
-    {0, 1, "kenjidashAttack4_KR"},
-    {0, 1, "kenjiitsen_KR"},
-    {0, 1, "kenjiDraw_KR"},
-    {0, 1, "kenjiHighJumpEnd_KR"},
-    {0, 1, "kenjiTornado_KR"},
-    {0, 0, "kenjiBlink_KR"},
-    {0, 1, "kenjiHiryuzan_KR"},
-    {0, 1, "kenjiHiryuzan2_KR"},
-    {0, 1, "kannaAlert3_KR"},
-    {0, 1, "kannaBlood_KR"},
-    {0, 1, "kannaDraw_KR"},
-    {0, 1, "kannaDraw2_KR"},
-    {0, 1, "kannaBind_KR"},
-    {0, 1, "kannaSoloAttack_KR"},
-    {0, 1, "kannaNineTale_KR"},
-    {0, 1, "kannaSummonGhost_KR"},
-    {0, 1, "kannaOniAttack_KR"},
-    {0, 1, "kannaSikikami_KR"},
-    {0, 1, "kannaSikikami2_KR"},
-    {0, 1, "kannaSikikami3_KR"},
-    {0, 1, "kannaSakura_KR"},
-    {0, 1, "kannaAssualt_KR"},
-    {0, 1, "kannaAlert_KR"},
-    {0, 1, "kannaDoubleDraw_KR"},
-    {0, 1, "kannaOrochi_KR"},
-    {0, 1, "kannaFoxHeal_KR"},
-    {0, 1, "kannaFoxFireBarrier_KR"},
-    {0, 1, "kannaFoxBless_KR"},
-    {0, 1, "kannaFoxGetsoku_KR"},
-    {0, 1, "kannaSummonKami_KR"},
-    {0, 1, "kannaSoloAttackPre_KR"},
-    {0, 1, "kannaSoloEnd_KR"},
-    {0, 1, "kannaHikami_KR"},
-    {0, 1, "AyameCombo1_KR"},
-    {0, 1, "AyameCombo2_KR"},
-    {0, 1, "AyameCombo3_KR"},
-    {0, 1, "AyameCombo4_KR"},
-    {0, 1, "AyamePiercingShoot_KR"},
-    {0, 1, "AyamePowerShoot_KR"},
-    {0, 1, "AyameDropShoot_KR"},
-    {0, 1, "AyameFlashJump_KR"},
-    {0, 1, "AyameFeverShoot_KR"},
-    {0, 1, "AyameFeverMode_KR"},
-    {0, 1, "EVhome"},
-    {0, 1, "EVcircleMana"},
-    {0, 1, "EVcircleMana2"},
-    {0, 1, "EVcircleMana3"},
-    {0, 1, "EVcircleMana4"},
-    {0, 1, "EVcircleWind"},
-    {0, 1, "EVcircleThunder"},
-    {0, 1, "EVcircleEarth"},
-    {0, 1, "EVbooster"},
-    {0, 1, "EVelemental"},
-    {0, 1, "EVmagicRemains"},
-    {0, 1, "EVbless"},
-    {0, 1, "EVdragonBack"},
-    {0, 1, "EVdragonMasterPrapare"},
-    {0, 1, "EVdragonMasterKeydown"},
-    {0, 1, "EVdragonMasterKeydowned"},
-    {0, 1, "EVcircleWindMix"},
-    {0, 1, "EVcircleThunderMix"},
-    {0, 1, "EVcircleEarthMix"},
-    {0, 1, "smashSwing"},
-    {0, 1, "smashSwing1"},
-    {0, 1, "smashSwing2"},
-    {0, 1, "aeroSwing"},
-    {0, 1, "smashWave"},
-    {0, 1, "comboJudgement_side"},
-    {0, 1, "gatheringCatcher"},
-    {0, 1, "boostEnd_sof"},
-    {0, 1, "boostEnd_sof0"},
-    {0, 1, "boostEnd_ht"},
-    {0, 1, "boostEnd_ht0"},
-    {0, 1, "boostEnd_htPrepare"},
-    {0, 1, "HY2112zoneOfMaha"},
-    {0, 1, "backtoRien"},
-    {0, 1, "finalBlowS"},
-    {0, 1, "RWgauntletPunch"},
-    {0, 1, "RWpileBunker"},
-    {0, 1, "RWexplosionJump"},
-    {0, 1, "RWexplosionJumpUp"},
-    {0, 1, "RWdoubleFang"},
-    {0, 1, "RWduckingDash"},
-    {0, 1, "RWduckingDashCh"},
-    {0, 1, "RWchoppingHammer"},
-    {0, 1, "RWchoppingHammerCh"},
-    {0, 1, "RWsway"},
-    {0, 1, "RWswayCh"},
-    {0, 1, "RWliftPress"},
-    {0, 1, "RWliftPressMagnum"},
-    {0, 1, "RWshockWavePunch"},
-    {0, 1, "RWswayBlow"},
-    {0, 1, "RWrollingHurricane"},
-    {0, 1, "RWrollingHurricanePre"},
-    {0, 1, "RWrollingHurricaneEnd"},
-    {0, 1, "RWpileBunkerBind"},
-    {0, 1, "RWpileBunkerBindEnd"},
-    {0, 1, "RWsuperHeal"},
-    {0, 1, "HY3712maximizeCanon"},
-    {0, 1, "HY3712hyperMagnumPre"},
-    {0, 1, "HY3712hyperMagnumPre2"},
-    {0, 1, "HY3712hyperMagnumPre3"},
-    {0, 1, "HY3712hyperMagnum"},
-};
+ActionData s_aCharacterActionData[ACTIONDATA_COUNT];
+
+namespace
+{
+
+// Seed the runtime table from the constexpr spec before anything reads it
+const bool s_bActionDataSeeded = []
+{
+    for (std::size_t i = 0; i < ACTIONDATA_COUNT; ++i)
+    {
+        const auto& spec = s_aActionSpec[i];
+        s_aCharacterActionData[i] = ActionData(spec.bZigzag, spec.bPieced, spec.sName);
+    }
+    return true;
+}();
+
+} // namespace
 
 } // namespace ms
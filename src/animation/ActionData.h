@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ms
@@ -30,7 +31,7 @@ public:
         std::int32_t m_nDirectionFix{0};
     };
 
-    std::string m_sName;
+    std::string_view m_sName;  ///< Points into s_aActionSpec
     std::int32_t m_bZigzag{0};
     std::int32_t m_bPieced{0};
     std::int32_t m_nTotalDelay{0};
@@ -39,12 +40,17 @@ public:
     std::int32_t m_nRepeatFrame{0};
     std::vector<Piece> m_aPieces;
 
+    /// Set once the WZ-dependent members (delays onward) have been read
+    bool m_bLoaded{false};
+
     ActionData() = default;
-    ActionData(std::int32_t bZigzag, std::int32_t bPieced, std::string sName);
+    ActionData(std::int32_t bZigzag, std::int32_t bPieced, std::string_view sName);
 };
 
 inline constexpr std::size_t ACTIONDATA_COUNT = 1310;
 
+/// Seeded from s_aActionSpec; read through ActionMan::GetActionData so the
+/// WZ-dependent members are loaded.
 extern ActionData s_aCharacterActionData[ACTIONDATA_COUNT];
 
 } // namespace ms
@@ -1,6 +1,7 @@
 #include "ActionMan.h"
 
 #include "ActionFrame.h"
+#include "ActionSpec.h"
 #include "CharacterActionFrameEntry.h"
 #include "LoadItemAction.h"
 #include "SpriteSource.h"
@@ -21,17 +22,10 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
-#include <map>
 
 namespace ms
 {
 
-// ---------------------------------------------------------------------------
-// Static maps (matches s_mCharacterRotateAction / s_mBlinkAction in client)
-// ---------------------------------------------------------------------------
-static std::map<std::int32_t, std::int32_t> s_mCharacterRotateAction;
-static std::map<std::int32_t, bool> s_mBlinkAction;
-
 // ---------------------------------------------------------------------------
 // s_asEmotionName — 39 emotion name strings (from dynamic initializer at
 // 0x1ea5bae, populated via StringPool IDs).
@@ -246,8 +240,6 @@ static auto is_action_on_develop(std::int32_t nAction) -> bool
 }
 
 // ---------------------------------------------------------------------------
-const std::string ActionMan::s_sEmpty;
-
 ActionMan::ActionMan() = default;
 
 // ---------------------------------------------------------------------------
@@ -259,15 +251,6 @@ auto ActionMan::Initialize(bool bCallOnLoadAction) -> bool
     if (!bCallOnLoadAction)
         ActionFrame::LoadMappers();
 
-    // Build name→code lookup (was InitNameMap)
-    m_nameToCode.clear();
-    m_nameToCode.reserve(ACTIONDATA_COUNT);
-    for (std::size_t i = 0; i < ACTIONDATA_COUNT; ++i)
-    {
-        m_nameToCode.emplace(
-            s_aCharacterActionData[i].m_sName, static_cast<std::int32_t>(i));
-    }
-
     // Load body item (ID 0x7D0 = 2000)
     auto pBodyEntry = GetCharacterImgEntry(2000);
     if (!pBodyEntry || !pBodyEntry->m_pImg)
@@ -276,301 +259,287 @@ auto ActionMan::Initialize(bool bCallOnLoadAction) -> bool
         return false;
     }
 
-    auto pImg = pBodyEntry->m_pImg;
+    // Action pieces are read from the body image on first use
+    // (GetActionData), not walked here for all ACTIONDATA_COUNT actions
+    m_pBodyImg = pBodyEntry->m_pImg;
+    for (auto& action : s_aCharacterActionData)
+        action.m_bLoaded = false;
 
-    for (std::int32_t i = 0; i < static_cast<std::int32_t>(ACTIONDATA_COUNT); ++i)
-    {
-        // Skip action 58 (matches: if (v4 == 58) goto LABEL_260)
-        if (i == 58)
-            continue;
+    LoadRandomMoveActionChange();
 
-        auto& action = s_aCharacterActionData[static_cast<std::size_t>(i)];
+    LOG_INFO("ActionMan: Initialized, action data loads on demand");
+    return true;
+}
 
-        auto pActionNode = pImg->GetChild(action.m_sName);
-        if (!pActionNode)
-        {
-            if (is_action_on_develop(i))
-                continue;
+// ---------------------------------------------------------------------------
+// LoadActionData  (per-action body of CActionMan::Init's action loop)
+// Reads the pieces, delays and repeat info of action i from the body image.
+// ---------------------------------------------------------------------------
+void ActionMan::LoadActionData(std::int32_t i, ActionData& action) const
+{
+    auto pActionNode = m_pBodyImg->GetChild(std::string(action.m_sName));
+    if (!pActionNode)
+    {
+        if (!is_action_on_develop(i))
             LOG_ERROR("No Character Action Data : {}", i);
-            continue;
-        }
+        return;
+    }
 
-        // Ghost actions (132-139): navigate into sub-property "1"
-        if (static_cast<std::uint32_t>(i - 132) <= 7u)
-        {
-            auto pSub = pActionNode->GetChild("1");
-            if (pSub)
-                pActionNode = pSub;
-        }
+    // Ghost actions (132-139): navigate into sub-property "1"
+    if (static_cast<std::uint32_t>(i - 132) <= 7u)
+    {
+        auto pSub = pActionNode->GetChild("1");
+        if (pSub)
+            pActionNode = pSub;
+    }
 
-        action.m_nTotalDelay = 0;
+    action.m_nTotalDelay = 0;
 
-        // Get frame count
-        auto nSrcCount = static_cast<std::int32_t>(pActionNode->GetChildCount());
+    // Get frame count
+    auto nSrcCount = static_cast<std::int32_t>(pActionNode->GetChildCount());
 
-        // Read subAvatarAction
-        auto pSubAvatar = pActionNode->GetChild("subAvatarAction");
-        action.m_sSubAvatarAction = pSubAvatar ? pSubAvatar->GetString("") : "";
-        if (!action.m_sSubAvatarAction.empty())
-            --nSrcCount;
+    // Read subAvatarAction
+    auto pSubAvatar = pActionNode->GetChild("subAvatarAction");
+    action.m_sSubAvatarAction = pSubAvatar ? pSubAvatar->GetString("") : "";
+    if (!action.m_sSubAvatarAction.empty())
+        --nSrcCount;
 
-        // Read repeat
-        auto pRepeat = pActionNode->GetChild("repeat");
-        action.m_nRepeatFrame = pRepeat ? pRepeat->GetInt(0) : 0;
-        if (action.m_nRepeatFrame)
-            --nSrcCount;
+    // Read repeat
+    auto pRepeat = pActionNode->GetChild("repeat");
+    action.m_nRepeatFrame = pRepeat ? pRepeat->GetInt(0) : 0;
+    if (action.m_nRepeatFrame)
+        --nSrcCount;
 
-        if (action.m_bPieced)
+    if (action.m_bPieced)
+    {
+        // === Pieced mode ===
+        action.m_aPieces.resize(static_cast<std::size_t>(nSrcCount));
+        action.m_bZigzag = 0;
+        action.m_nEventDelay = 0;
+
+        for (std::int32_t j = 0; j < nSrcCount; ++j)
         {
-            // === Pieced mode ===
-            action.m_aPieces.resize(static_cast<std::size_t>(nSrcCount));
-            action.m_bZigzag = 0;
-            action.m_nEventDelay = 0;
+            auto pFrame = pActionNode->GetChild(std::to_string(j));
+            if (!pFrame)
+                continue;
 
-            for (std::int32_t j = 0; j < nSrcCount; ++j)
+            auto& piece = action.m_aPieces[static_cast<std::size_t>(j)];
+
+            // action (StringPool 11026)
+            auto pActionProp = pFrame->GetChild("action");
+            if (pActionProp)
+                piece.m_nAction = GetActionCode(pActionProp->GetString(""));
+
+            // frame (StringPool 1833)
+            auto pFrameIdx = pFrame->GetChild("frame");
+            piece.m_nFrameIdx = pFrameIdx ? pFrameIdx->GetInt(0) : 0;
+
+            // delay (StringPool 11044, default 150)
+            auto pDelay = pFrame->GetChild("delay");
+            piece.m_nFrameDelay = pDelay ? pDelay->GetInt(150) : 150;
+
+            // flip (StringPool 5918)
+            auto pFlip = pFrame->GetChild("flip");
+            piece.m_bFlip = (pFlip && pFlip->GetInt(0) != 0) ? 1 : 0;
+
+            // rotate (StringPool 5919)
+            auto pRotate = pFrame->GetChild("rotate");
+            piece.m_nRotate = pRotate ? pRotate->GetInt(0) : 0;
+
+            // weapon2
+            auto pWeapon2 = pFrame->GetChild("weapon2");
+            piece.m_bWeapon2 = (pWeapon2 && pWeapon2->GetInt(0) != 0) ? 1 : 0;
+
+            // noweapon
+            auto pNoWeapon = pFrame->GetChild("noweapon");
+            piece.m_bNoWeapon = pNoWeapon && pNoWeapon->GetInt(0) != 0;
+
+            // alpha (default 255)
+            auto pAlpha = pFrame->GetChild("alpha");
+            piece.m_nAlpha =
+                static_cast<std::uint8_t>(pAlpha ? pAlpha->GetInt(255) : 255);
+
+            // justDir
+            auto pJustDir = pFrame->GetChild("justDir");
+            piece.m_nDirectionFix = pJustDir ? pJustDir->GetInt(0) : 0;
+
+            // emotion (default -1, clamped to max 0x26)
+            auto pEmotion = pFrame->GetChild("emotion");
+            auto nEmotion =
+                static_cast<std::uint32_t>(pEmotion ? pEmotion->GetInt(-1) : -1);
+            if (nEmotion > 0x26u)
+                nEmotion = static_cast<std::uint32_t>(-1);
+            piece.m_nEmotion = static_cast<std::int32_t>(nEmotion);
+
+            // move (StringPool 11071)
+            auto pMove = pFrame->GetChild("move");
+            if (pMove)
             {
-                auto pFrame = pActionNode->GetChild(std::to_string(j));
-                if (!pFrame)
-                    continue;
-
-                auto& piece = action.m_aPieces[static_cast<std::size_t>(j)];
-
-                // action (StringPool 11026)
-                auto pActionProp = pFrame->GetChild("action");
-                if (pActionProp)
-                    piece.m_nAction = GetActionCode(pActionProp->GetString(""));
-
-                // frame (StringPool 1833)
-                auto pFrameIdx = pFrame->GetChild("frame");
-                piece.m_nFrameIdx = pFrameIdx ? pFrameIdx->GetInt(0) : 0;
-
-                // delay (StringPool 11044, default 150)
-                auto pDelay = pFrame->GetChild("delay");
-                piece.m_nFrameDelay = pDelay ? pDelay->GetInt(150) : 150;
-
-                // flip (StringPool 5918)
-                auto pFlip = pFrame->GetChild("flip");
-                piece.m_bFlip = (pFlip && pFlip->GetInt(0) != 0) ? 1 : 0;
-
-                // rotate (StringPool 5919)
-                auto pRotate = pFrame->GetChild("rotate");
-                piece.m_nRotate = pRotate ? pRotate->GetInt(0) : 0;
-
-                // weapon2
-                auto pWeapon2 = pFrame->GetChild("weapon2");
-                piece.m_bWeapon2 = (pWeapon2 && pWeapon2->GetInt(0) != 0) ? 1 : 0;
-
-                // noweapon
-                auto pNoWeapon = pFrame->GetChild("noweapon");
-                piece.m_bNoWeapon = pNoWeapon && pNoWeapon->GetInt(0) != 0;
-
-                // alpha (default 255)
-                auto pAlpha = pFrame->GetChild("alpha");
-                piece.m_nAlpha =
-                    static_cast<std::uint8_t>(pAlpha ? pAlpha->GetInt(255) : 255);
-
-                // justDir
-                auto pJustDir = pFrame->GetChild("justDir");
-                piece.m_nDirectionFix = pJustDir ? pJustDir->GetInt(0) : 0;
-
-                // emotion (default -1, clamped to max 0x26)
-                auto pEmotion = pFrame->GetChild("emotion");
-                auto nEmotion =
-                    static_cast<std::uint32_t>(pEmotion ? pEmotion->GetInt(-1) : -1);
-                if (nEmotion > 0x26u)
-                    nEmotion = static_cast<std::uint32_t>(-1);
-                piece.m_nEmotion = static_cast<std::int32_t>(nEmotion);
-
-                // Track actions with rotation
-                if (piece.m_nRotate != 0)
-                    s_mCharacterRotateAction.try_emplace(i, 1);
-
-                // Track actions referencing blink (action code 33)
-                if (piece.m_nAction == 33)
-                    s_mBlinkAction.try_emplace(i, true);
-
-                // move (StringPool 11071)
-                auto pMove = pFrame->GetChild("move");
-                if (pMove)
-                {
-                    auto vec = pMove->GetVector();
-                    piece.m_ptMove = {vec.x, vec.y};
-                }
-                else
-                {
-                    piece.m_ptMove = {0, 0};
-                }
-
-                // bShowFace: COPY from referenced action (not read from WZ)
-                auto nRefAction = piece.m_nAction;
-                auto nRefFrame = piece.m_nFrameIdx;
-                if (nRefAction >= 0
-                    && static_cast<std::size_t>(nRefAction) < ACTIONDATA_COUNT)
-                {
-                    auto& refPieces =
-                        s_aCharacterActionData[static_cast<std::size_t>(nRefAction)]
-                            .m_aPieces;
-                    if (nRefFrame >= 0
-                        && static_cast<std::size_t>(nRefFrame) < refPieces.size())
-                    {
-                        piece.m_bShowFace =
-                            refPieces[static_cast<std::size_t>(nRefFrame)].m_bShowFace;
-                    }
-                }
+                auto vec = pMove->GetVector();
+                piece.m_ptMove = {vec.x, vec.y};
+            }
+            else
+            {
+                piece.m_ptMove = {0, 0};
+            }
 
-                // Negative delay: negate and accumulate to tEventDelay (all pieced)
-                if (piece.m_nFrameDelay < 0)
+            // bShowFace: COPY from referenced action (not read from WZ)
+            // (loads the referenced action first if it has not been used yet)
+            auto nRefFrame = piece.m_nFrameIdx;
+            if (const auto* pRef = GetActionData(piece.m_nAction))
+            {
+                const auto& refPieces = pRef->m_aPieces;
+                if (nRefFrame >= 0
+                    && static_cast<std::size_t>(nRefFrame) < refPieces.size())
                 {
-                    piece.m_nFrameDelay = -piece.m_nFrameDelay;
-                    action.m_nEventDelay += piece.m_nFrameDelay;
+                    piece.m_bShowFace =
+                        refPieces[static_cast<std::size_t>(nRefFrame)].m_bShowFace;
                 }
+            }
 
-                action.m_nTotalDelay += piece.m_nFrameDelay;
+            // Negative delay: negate and accumulate to tEventDelay (all pieced)
+            if (piece.m_nFrameDelay < 0)
+            {
+                piece.m_nFrameDelay = -piece.m_nFrameDelay;
+                action.m_nEventDelay += piece.m_nFrameDelay;
             }
-        }
-        else
-        {
-            // === Non-pieced mode ===
-            auto nDesCount =
-                action.m_bZigzag ? 2 * nSrcCount - 2 : nSrcCount;
 
-            action.m_aPieces.resize(static_cast<std::size_t>(nDesCount));
+            action.m_nTotalDelay += piece.m_nFrameDelay;
+        }
+    }
+    else
+    {
+        // === Non-pieced mode ===
+        auto nDesCount =
+            action.m_bZigzag ? 2 * nSrcCount - 2 : nSrcCount;
 
-            // Range check: actions 981-1050 (PB actions) have special delay handling
-            auto bIsPBRange =
-                static_cast<std::uint32_t>(i - 981) <= 0x45u;
+        action.m_aPieces.resize(static_cast<std::size_t>(nDesCount));
 
-            for (std::int32_t j = 0; j < nSrcCount; ++j)
-            {
-                auto pFrame = pActionNode->GetChild(std::to_string(j));
-                if (!pFrame)
-                    continue;
+        // Range check: actions 981-1050 (PB actions) have special delay handling
+        auto bIsPBRange =
+            static_cast<std::uint32_t>(i - 981) <= 0x45u;
 
-                auto& piece = action.m_aPieces[static_cast<std::size_t>(j)];
-                piece.m_nFrameIdx = 0;
-
-                // delay (default 150)
-                auto pDelay = pFrame->GetChild("delay");
-                piece.m_nFrameDelay = pDelay ? pDelay->GetInt(150) : 150;
-
-                // flip
-                auto pFlip = pFrame->GetChild("flip");
-                piece.m_bFlip = (pFlip && pFlip->GetInt(0) != 0) ? 1 : 0;
-
-                // rotate
-                auto pRotate = pFrame->GetChild("rotate");
-                piece.m_nRotate = pRotate ? pRotate->GetInt(0) : 0;
-
-                // weapon2
-                auto pWeapon2 = pFrame->GetChild("weapon2");
-                piece.m_bWeapon2 = (pWeapon2 && pWeapon2->GetInt(0) != 0) ? 1 : 0;
-
-                // noweapon
-                auto pNoWeapon = pFrame->GetChild("noweapon");
-                piece.m_bNoWeapon = pNoWeapon && pNoWeapon->GetInt(0) != 0;
-
-                // alpha (default 255)
-                auto pAlpha = pFrame->GetChild("alpha");
-                piece.m_nAlpha =
-                    static_cast<std::uint8_t>(pAlpha ? pAlpha->GetInt(255) : 255);
-
-                // justDir
-                auto pJustDir = pFrame->GetChild("justDir");
-                piece.m_nDirectionFix = pJustDir ? pJustDir->GetInt(0) : 0;
-
-                // emotion (default -1, clamped to max 0x26)
-                auto pEmotion = pFrame->GetChild("emotion");
-                auto nEmotion =
-                    static_cast<std::uint32_t>(pEmotion ? pEmotion->GetInt(-1) : -1);
-                if (nEmotion > 0x26u)
-                    nEmotion = static_cast<std::uint32_t>(-1);
-                piece.m_nEmotion = static_cast<std::int32_t>(nEmotion);
-
-                // Track actions with rotation
-                if (piece.m_nRotate != 0)
-                    s_mCharacterRotateAction.try_emplace(i, 1);
-
-                // move
-                auto pMove = pFrame->GetChild("move");
-                if (pMove)
-                {
-                    auto vec = pMove->GetVector();
-                    piece.m_ptMove = {vec.x, vec.y};
-                }
-                else
-                {
-                    piece.m_ptMove = {0, 0};
-                }
+        for (std::int32_t j = 0; j < nSrcCount; ++j)
+        {
+            auto pFrame = pActionNode->GetChild(std::to_string(j));
+            if (!pFrame)
+                continue;
 
-                // face / bShowFace (StringPool 11046) — read from WZ
-                auto pFace = pFrame->GetChild("face");
-                piece.m_bShowFace = (pFace && pFace->GetInt(0) != 0) ? 1 : 0;
+            auto& piece = action.m_aPieces[static_cast<std::size_t>(j)];
+            piece.m_nFrameIdx = 0;
+
+            // delay (default 150)
+            auto pDelay = pFrame->GetChild("delay");
+            piece.m_nFrameDelay = pDelay ? pDelay->GetInt(150) : 150;
+
+            // flip
+            auto pFlip = pFrame->GetChild("flip");
+            piece.m_bFlip = (pFlip && pFlip->GetInt(0) != 0) ? 1 : 0;
+
+            // rotate
+            auto pRotate = pFrame->GetChild("rotate");
+            piece.m_nRotate = pRotate ? pRotate->GetInt(0) : 0;
+
+            // weapon2
+            auto pWeapon2 = pFrame->GetChild("weapon2");
+            piece.m_bWeapon2 = (pWeapon2 && pWeapon2->GetInt(0) != 0) ? 1 : 0;
+
+            // noweapon
+            auto pNoWeapon = pFrame->GetChild("noweapon");
+            piece.m_bNoWeapon = pNoWeapon && pNoWeapon->GetInt(0) != 0;
+
+            // alpha (default 255)
+            auto pAlpha = pFrame->GetChild("alpha");
+            piece.m_nAlpha =
+                static_cast<std::uint8_t>(pAlpha ? pAlpha->GetInt(255) : 255);
+
+            // justDir
+            auto pJustDir = pFrame->GetChild("justDir");
+            piece.m_nDirectionFix = pJustDir ? pJustDir->GetInt(0) : 0;
+
+            // emotion (default -1, clamped to max 0x26)
+            auto pEmotion = pFrame->GetChild("emotion");
+            auto nEmotion =
+                static_cast<std::uint32_t>(pEmotion ? pEmotion->GetInt(-1) : -1);
+            if (nEmotion > 0x26u)
+                nEmotion = static_cast<std::uint32_t>(-1);
+            piece.m_nEmotion = static_cast<std::int32_t>(nEmotion);
+
+            // move
+            auto pMove = pFrame->GetChild("move");
+            if (pMove)
+            {
+                auto vec = pMove->GetVector();
+                piece.m_ptMove = {vec.x, vec.y};
+            }
+            else
+            {
+                piece.m_ptMove = {0, 0};
+            }
 
-                // Negative delay: only for PB actions [981, 1050]
-                if (bIsPBRange && piece.m_nFrameDelay < 0)
-                {
-                    piece.m_nFrameDelay = -piece.m_nFrameDelay;
-                    action.m_nEventDelay += piece.m_nFrameDelay;
-                }
+            // face / bShowFace (StringPool 11046) — read from WZ
+            auto pFace = pFrame->GetChild("face");
+            piece.m_bShowFace = (pFace && pFace->GetInt(0) != 0) ? 1 : 0;
 
-                action.m_nTotalDelay += piece.m_nFrameDelay;
+            // Negative delay: only for PB actions [981, 1050]
+            if (bIsPBRange && piece.m_nFrameDelay < 0)
+            {
+                piece.m_nFrameDelay = -piece.m_nFrameDelay;
+                action.m_nEventDelay += piece.m_nFrameDelay;
             }
 
-            // Zigzag: mirror frames
-            if (nSrcCount < nDesCount)
-            {
-                auto dst = nSrcCount;
-                auto src = nDesCount - nSrcCount; // = nSrcCount - 2
-                auto count = nDesCount - nSrcCount;
+            action.m_nTotalDelay += piece.m_nFrameDelay;
+        }
 
-                for (std::int32_t k = 0; k < count; ++k)
-                {
-                    action.m_aPieces[static_cast<std::size_t>(dst)] =
-                        action.m_aPieces[static_cast<std::size_t>(src)];
+        // Zigzag: mirror frames
+        if (nSrcCount < nDesCount)
+        {
+            auto dst = nSrcCount;
+            auto src = nDesCount - nSrcCount; // = nSrcCount - 2
+            auto count = nDesCount - nSrcCount;
 
-                    auto& mirrored =
-                        action.m_aPieces[static_cast<std::size_t>(dst)];
-                    mirrored.m_nFrameIdx = 0;
+            for (std::int32_t k = 0; k < count; ++k)
+            {
+                action.m_aPieces[static_cast<std::size_t>(dst)] =
+                    action.m_aPieces[static_cast<std::size_t>(src)];
 
-                    // Negative delay handling for mirrored frames
-                    if (bIsPBRange && mirrored.m_nFrameDelay < 0)
-                    {
-                        mirrored.m_nFrameDelay = -mirrored.m_nFrameDelay;
-                        action.m_nEventDelay += mirrored.m_nFrameDelay;
-                    }
+                auto& mirrored =
+                    action.m_aPieces[static_cast<std::size_t>(dst)];
+                mirrored.m_nFrameIdx = 0;
 
-                    action.m_nTotalDelay += mirrored.m_nFrameDelay;
-                    ++dst;
-                    --src;
+                // Negative delay handling for mirrored frames
+                if (bIsPBRange && mirrored.m_nFrameDelay < 0)
+                {
+                    mirrored.m_nFrameDelay = -mirrored.m_nFrameDelay;
+                    action.m_nEventDelay += mirrored.m_nFrameDelay;
                 }
+
+                action.m_nTotalDelay += mirrored.m_nFrameDelay;
+                ++dst;
+                --src;
             }
+        }
 
-            // Event delay override for non-PB actions
-            if (!bIsPBRange)
+        // Event delay override for non-PB actions
+        if (!bIsPBRange)
+        {
+            if (action.m_bZigzag)
             {
-                if (action.m_bZigzag)
-                {
-                    action.m_nEventDelay = 0;
-                }
-                else if (nDesCount > 0)
-                {
-                    action.m_nEventDelay =
-                        action.m_nTotalDelay
-                        - action.m_aPieces[static_cast<std::size_t>(nDesCount - 1)]
-                              .m_nFrameDelay;
-                }
-                else
-                {
-                    action.m_nEventDelay = 0;
-                }
+                action.m_nEventDelay = 0;
+            }
+            else if (nDesCount > 0)
+            {
+                action.m_nEventDelay =
+                    action.m_nTotalDelay
+                    - action.m_aPieces[static_cast<std::size_t>(nDesCount - 1)]
+                          .m_nFrameDelay;
+            }
+            else
+            {
+                action.m_nEventDelay = 0;
             }
         }
     }
-
-    LoadRandomMoveActionChange();
-
-    LOG_INFO("ActionMan: Initialized actions from body item");
-    return true;
 }
 
 // ---------------------------------------------------------------------------
@@ -579,9 +548,8 @@ auto ActionMan::Initialize(bool bCallOnLoadAction) -> bool
 auto ActionMan::GetCharacterImgEntry(std::int32_t nItemID)
     -> std::shared_ptr<CharacterImgEntry>
 {
-    auto it = m_mCharacterImgEntry.find(nItemID);
-    if (it != m_mCharacterImgEntry.end())
-        return it->second;
+    if (const auto* pEntry = m_mCharacterImgEntry.Find(nItemID))
+        return *pEntry;
 
     auto sPath = get_equip_data_path(nItemID);
     if (sPath.empty())
@@ -649,26 +617,32 @@ auto ActionMan::GetActionData(std::int32_t nAction) const -> const ActionData*
 {
     if (nAction < 0 || static_cast<std::size_t>(nAction) >= ACTIONDATA_COUNT)
         return nullptr;
-    return &s_aCharacterActionData[static_cast<std::size_t>(nAction)];
+
+    auto& action = s_aCharacterActionData[static_cast<std::size_t>(nAction)];
+    // Action 58 is never loaded (matches: if (v4 == 58) goto LABEL_260)
+    if (!action.m_bLoaded && m_pBodyImg && nAction != 58)
+    {
+        // Mark first: pieced actions may refer back to themselves
+        action.m_bLoaded = true;
+        LoadActionData(nAction, action);
+    }
+    return &action;
 }
 
 // ---------------------------------------------------------------------------
 // GetActionCode  (matches decompiled get_action_code_from_name, but O(1)
-// via hash map instead of the original O(n) linear scan)
+// via a compile-time perfect hash instead of the original O(n) linear scan)
 // ---------------------------------------------------------------------------
 auto ActionMan::GetActionCode(const std::string& sName) const -> std::int32_t
 {
-    auto it = m_nameToCode.find(sName);
-    if (it != m_nameToCode.end())
-        return it->second;
-    return -1;
+    return get_action_code_from_name(sName);
 }
 
 // ---------------------------------------------------------------------------
-auto ActionMan::GetActionName(std::int32_t nAction) const -> const std::string&
+auto ActionMan::GetActionName(std::int32_t nAction) const -> std::string_view
 {
     if (nAction < 0 || static_cast<std::size_t>(nAction) >= ACTIONDATA_COUNT)
-        return s_sEmpty;
+        return {};
     return s_aCharacterActionData[static_cast<std::size_t>(nAction)].m_sName;
 }
 
@@ -699,7 +673,7 @@ auto ActionMan::GetWeaponAfterImage(const std::string& sUOL)
         for (std::int32_t nAction = 0;
              nAction < static_cast<std::int32_t>(ACTIONDATA_COUNT); ++nAction)
         {
-            auto& sActionName = GetActionName(nAction);
+            const std::string sActionName(GetActionName(nAction));
 
             auto pAction = pAfterimage->GetChild(sActionName);
             if (!pAction)
@@ -759,11 +733,11 @@ auto ActionMan::GetWeaponAfterImage(const std::string& sUOL)
 // ---------------------------------------------------------------------------
 auto ActionMan::GetRandomMoveActionChange(std::int32_t nActionID) -> std::int32_t
 {
-    auto it = m_mMoveActionChange.find(nActionID);
-    if (it == m_mMoveActionChange.end())
+    auto* pEntries = m_mMoveActionChange.Find(nActionID);
+    if (!pEntries)
         return -1;
 
-    auto& entries = it->second;
+    auto& entries = *pEntries;
     if (entries.empty())
         return -1;
 
@@ -802,7 +776,7 @@ void ActionMan::LoadRandomMoveActionChange()
     if (!pProp)
         return;
 
-    m_mMoveActionChange.clear();
+    m_mMoveActionChange.Clear();
 
     for (auto& [sName, pChild] : pProp->GetChildren())
     {
@@ -899,10 +873,10 @@ void ActionMan::LoadFaceLook(
     FaceLookCodes fl{nFace, nEmotion, nFaceAcc};
 
     // ---- Cache lookup ----
-    auto cacheIt = m_mFaceLook.find(fl);
-    if (cacheIt != m_mFaceLook.end() && cacheIt->second)
+    auto* pCached = m_mFaceLook.Find(fl.Pack());
+    if (pCached && *pCached)
     {
-        auto& entry = cacheIt->second;
+        auto& entry = *pCached;
         entry->m_tLastAccessed = static_cast<std::int32_t>(
             Application::GetInstance().GetUpdateTime());
         lpEmotion.clear();
@@ -1184,7 +1158,7 @@ void ActionMan::LoadFaceLook(
         Application::GetInstance().GetUpdateTime());
 
     m_lFaceLook.push_back(entry);
-    m_mFaceLook[fl] = entry;
+    m_mFaceLook[fl.Pack()] = entry;
 }
 
 // ---------------------------------------------------------------------------
@@ -1313,7 +1287,7 @@ auto ActionMan::load_character_action(
     {
         if (pHairImgEntry->m_pWeeklyImg)
         {
-            auto sActionName = GetActionName(nAction);
+            const std::string sActionName(GetActionName(nAction));
             auto pHairAction = pHairImgEntry->m_pWeeklyImg->GetChild(sActionName);
             if (pHairAction)
             {
@@ -1332,7 +1306,7 @@ auto ActionMan::load_character_action(
     {
         if (pCapImgEntry->m_pWeeklyImg)
         {
-            auto sActionName = GetActionName(nAction);
+            const std::string sActionName(GetActionName(nAction));
             auto pCapAction = pCapImgEntry->m_pWeeklyImg->GetChild(sActionName);
             if (pCapAction)
             {
@@ -1608,10 +1582,9 @@ void ActionMan::MergeCharacterSprite(
         entry->tDelay = frame.tDelay;
         entry->rcBody = frame.rcBody;
 
-        // Canvas compositing is deferred — our rendering pipeline handles
-        // sprite layering differently from the original COM-based Draw().
-        entry->pCanvasUnderFace = nullptr;
-        entry->pCanvasOverFace = nullptr;
+        // Flatten the part sprites below and above the face into one canvas
+        // each (original: CActionFrame::Draw into two IWzCanvas pages)
+        CharacterFrameCache::Composite(frame.m_lpSprites, ActionFrame::GetFaceZ(), *entry);
 
         // Search all groups for named anchor points.
         // Original CActionFrame::Draw extracts these relative to body center
@@ -1881,10 +1854,30 @@ void ActionMan::LoadCharacterAction(
     if (nLocalAction >= 0
         && static_cast<std::size_t>(nLocalAction) < ACTIONDATA_COUNT)
     {
-        bZigZag = s_aCharacterActionData[static_cast<std::size_t>(nLocalAction)]
-                      .m_bZigzag != 0;
+        bZigZag = s_aActionSpec[static_cast<std::size_t>(nLocalAction)].bZigzag;
     }
 
+    // --- Reuse frames composited for an identical look ---
+    CharacterLook look;
+    look.nSkin = nSkin;
+    look.nJob = nJob;
+    std::memcpy(look.aEquip, b, sizeof(b));
+    look.nWeaponStickerID = nWeaponStickerID;
+    look.nVehicleID = nVehicleID;
+    look.nGhostIndex = nGhostIndex;
+    look.nGatherToolID = nFinalGatherToolID;
+    look.nLarknessState = nLarknessState;
+    look.nMixedHairID = nMixedHairId;
+    look.nMixPercent = nMixPercent;
+    look.bDrawElfEar = bDrawElfEar;
+    look.bCashCape = bCashCape;
+    look.bZigZag = bZigZag;
+    look.bRemoveBody = bRemoveBody;
+    look.Seal();
+
+    if (m_characterFrameCache.FindAction(look, nLocalAction, apFE))
+        return;
+
     // --- Call inner load_character_action ---
     std::vector<ActionFrame> aCharacterFrame;
     load_character_action(
@@ -1901,6 +1894,9 @@ void ActionMan::LoadCharacterAction(
 
     // --- Convert to CharacterActionFrameEntry ---
     MergeCharacterSprite(aCharacterFrame, apFE);
+
+    if (!apFE.empty())
+        m_characterFrameCache.InsertAction(look, nLocalAction, apFE);
 }
 
 } // namespace ms
@@ -1,21 +1,12 @@
 #pragma once
 
 #include "ActionData.h"
-#include "ActionKey.h"
+#include "CharacterFrameCache.h"
 #include "CharacterImgEntry.h"
-#include "DragonAction.h"
-#include "EmployeeAction.h"
 #include "FaceLookEntry.h"
 #include "MeleeAttackAfterimage.h"
-#include "MobAction.h"
-#include "MobImgEntry.h"
-#include "MorphAction.h"
 #include "MoveActionChange.h"
-#include "NpcAction.h"
-#include "PetAction.h"
-#include "ShadowPartnerAction.h"
-#include "SkillPetAction.h"
-#include "SummonedAction.h"
+#include "util/FlatHashMap.h"
 #include "util/Singleton.h"
 
 #include <cstdint>
@@ -23,7 +14,6 @@
 #include <map>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace ms
@@ -44,9 +34,12 @@ public:
     [[nodiscard]] auto GetCharacterImgEntry(std::int32_t nItemID)
         -> std::shared_ptr<CharacterImgEntry>;
 
+    /// Static part comes from s_aActionSpec; pieces and delays are read
+    /// from WZ the first time an action is asked for.
     [[nodiscard]] auto GetActionData(std::int32_t nAction) const -> const ActionData*;
 
-    [[nodiscard]] auto GetActionName(std::int32_t nAction) const -> const std::string&;
+    /// Name from s_aActionSpec; empty for codes out of range
+    [[nodiscard]] auto GetActionName(std::int32_t nAction) const -> std::string_view;
 
     /// Get the emotion name string for the given emotion index (0–38).
     [[nodiscard]] static auto GetEmotionName(std::int32_t nEmotion) -> const std::string&;
@@ -84,6 +77,12 @@ public:
         std::int32_t nMixPercent = 0,
         std::int32_t nBattlePvPAvatar = 0);
 
+    /// Composited character frames shared by all avatars with the same look
+    [[nodiscard]] auto GetCharacterFrameCache() noexcept -> CharacterFrameCache&
+    {
+        return m_characterFrameCache;
+    }
+
     /// Load face look canvases for the given face/emotion/accessory combination.
     void LoadFaceLook(
         std::int32_t nSkin,
@@ -125,87 +124,39 @@ private:
         bool bRemoveBody = false) -> bool;
 
     /// Convert ActionFrame array to CharacterActionFrameEntry array.
-    /// Extracts anchor points and timing data from ActionFrame groups.
+    /// Extracts anchor points and timing data from ActionFrame groups and
+    /// composites each frame's sprites into under/over-face canvases.
     void MergeCharacterSprite(
         const std::vector<ActionFrame>& aFrame,
         std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE);
 
+    /// Fill the WZ-dependent part of one ActionData from the body image.
+    void LoadActionData(std::int32_t nAction, ActionData& action) const;
+
     void LoadRandomMoveActionChange();
     void LoadRandomMoveActionChangeInfo(std::int32_t nAction,
                                         const std::shared_ptr<WzProperty>& pRandomProp);
 
+    // Body image (item 2000) that action data is read from
+    std::shared_ptr<WzProperty> m_pBodyImg;
+
     // Character
     std::list<std::shared_ptr<CharacterImgEntry>> m_lCharacterImgEntry;
-    std::map<std::int32_t, std::shared_ptr<CharacterImgEntry>> m_mCharacterImgEntry;
+    TFlatHashMap<std::int32_t, std::shared_ptr<CharacterImgEntry>> m_mCharacterImgEntry;
 
     // FaceLook
     std::list<std::shared_ptr<FaceLookEntry>> m_lFaceLook;
-    std::map<FaceLookCodes, std::shared_ptr<FaceLookEntry>> m_mFaceLook;
-
-    // Character UOL
-    std::map<std::int32_t, std::string> m_msCharacterUOL;
+    TFlatHashMap<std::uint64_t, std::shared_ptr<FaceLookEntry>> m_mFaceLook; ///< FaceLookCodes::Pack
 
-    // Morph
-    std::list<std::shared_ptr<MorphImgEntry>> m_lMorphImgEntry;
-    std::map<std::int32_t, std::shared_ptr<MorphImgEntry>> m_mMorphImgEntry;
-    std::list<std::shared_ptr<MorphActionEntry>> m_lMorphAction;
-    std::map<std::uint32_t, std::shared_ptr<MorphActionEntry>> m_mMorphAction;
-
-    // Mob
-    std::list<std::shared_ptr<MobImgEntry>> m_lMobImgEntry;
-    std::map<std::int32_t, std::shared_ptr<MobImgEntry>> m_mMobImgEntry;
-    std::list<std::shared_ptr<MobActionEntry>> m_lMobAction;
-    std::map<std::uint32_t, std::shared_ptr<MobActionEntry>> m_mMobAction;
+    // Composited character frames
+    CharacterFrameCache m_characterFrameCache;
 
     // Afterimage
     std::map<std::string, std::shared_ptr<MeleeAttackAfterimage>> m_mAfterimage;
 
-    // NPC
-    std::list<std::shared_ptr<NpcImgEntry>> m_lNpcImgEntry;
-    std::map<std::int32_t, std::shared_ptr<NpcImgEntry>> m_mNpcImgEntry;
-    std::list<std::shared_ptr<NpcActionEntry>> m_lNpcAction;
-    std::map<std::int64_t, std::shared_ptr<NpcActionEntry>> m_mNpcAction;
-
-    // Pet
-    std::list<std::shared_ptr<PetImgEntry>> m_lPetImgEntry;
-    std::map<std::int32_t, std::shared_ptr<PetImgEntry>> m_mPetImgEntry;
-    std::list<std::shared_ptr<PetActionEntry>> m_lPetAction;
-    std::map<std::uint32_t, std::shared_ptr<PetActionEntry>> m_mPetAction;
-
-    // Employee
-    std::list<std::shared_ptr<EmployeeImgEntry>> m_lEmployeeImgEntry;
-    std::map<std::int32_t, std::shared_ptr<EmployeeImgEntry>> m_mEmployeeImgEntry;
-    std::list<std::shared_ptr<EmployeeActionEntry>> m_lEmployeeAction;
-    std::map<std::uint32_t, std::shared_ptr<EmployeeActionEntry>> m_mEmployeeAction;
-
-    // Summoned
-    std::list<std::shared_ptr<SummonedActionEntry>> m_lSummonedAction;
-    std::map<ActionKey, std::shared_ptr<SummonedActionEntry>> m_mSummonedAction;
-
-    // Shadow Partner
-    std::list<std::shared_ptr<ShadowPartnerActionEntry>> m_lShadowPartnerAction;
-    std::map<std::uint32_t, std::shared_ptr<ShadowPartnerActionEntry>> m_mShadowPartnerAction;
-
-    // Dragon
-    std::map<std::int32_t, std::map<std::int32_t, std::shared_ptr<DragonActionEntry>>> m_mDragonAction;
-
-    // Skill Pet
-    std::list<std::shared_ptr<SkillPetImgEntry>> m_lSkillPetImgEntry;
-    std::map<std::int32_t, std::shared_ptr<SkillPetImgEntry>> m_mSkillPetImgEntry;
-    std::list<std::shared_ptr<SkillPetActionEntry>> m_lSkillPetAction;
-    std::map<std::uint32_t, std::shared_ptr<SkillPetActionEntry>> m_mSkillPetAction;
-
-    // Cache sweep
-    std::int32_t m_tLastSweepCache{0};
-    std::uint32_t m_tLastMobSweepCache{0};
-
     // Move action change
-    std::map<std::int32_t, std::vector<MoveActionChange>> m_mMoveActionChange;
-
-    // Internal lookup
-    std::unordered_map<std::string, std::int32_t> m_nameToCode;
+    TFlatHashMap<std::int32_t, std::vector<MoveActionChange>> m_mMoveActionChange;
 
-    static const std::string s_sEmpty;
     static const std::string s_sEmptyEmotion;
 };
 
@@ -0,0 +1,1355 @@
+#pragma once
+
+#include "ActionData.h"
+#include "util/StaticPerfectHash.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ms
+{
+
+/// Fixed per-action metadata, indexed by action code
+struct ActionSpec
+{
+    std::string_view sName;
+    bool bZigzag{false};
+    bool bPieced{false};
+};
+
+inline constexpr std::array<ActionSpec, ACTIONDATA_COUNT> s_aActionSpec = {{
+    {"walk1", false, false},
+    {"walk2", false, false},
+    {"stand1", true, false},
+    {"stand2", true, false},
+    {"alert", true, false},
+    {"swingO1", false, false},
+    {"swingO2", false, false},
+    {"swingO3", false, false},
+    {"swingOF", false, false},
+    {"swingT1", false, false},
+    {"swingT2", false, false},
+    {"swingT3", false, false},
+    {"swingTF", false, false},
+    {"swingP1", false, false},
+    {"swingP2", false, false},
+    {"swingPF", false, false},
+    {"stabO1", false, false},
+    {"stabO2", false, false},
+    {"stabOF", false, false},
+    {"stabT1", false, false},
+    {"stabT2", false, false},
+    {"stabTF", false, false},
+    {"shoot1", false, false},
+    {"shoot2", false, false},
+    {"proneStab", false, false},
+    {"prone", false, false},
+    {"heal", false, false},
+    {"fly", false, false},
+    {"jump", false, false},
+    {"sit", false, false},
+    {"ladder", false, false},
+    {"rope", false, false},
+    {"dead", false, false},
+    {"blink", false, false},
+    {"rune", false, true},
+    {"runeAttack", false, true},
+    {"swingD1", false, true},
+    {"swingD2", false, true},
+    {"stabD1", false, true},
+    {"swingDb1", false, true},
+    {"swingDb2", false, true},
+    {"swingC1", false, true},
+    {"swingC2", false, true},
+    {"tripleBlow", false, true},
+    {"quadBlow", false, true},
+    {"deathBlow", false, true},
+    {"finishBlow", false, true},
+    {"finishAttack_link", false, true},
+    {"finishAttack_link2", false, true},
+    {"swingO1", false, false},
+    {"swingO2", false, false},
+    {"swingO3", false, false},
+    {"shootDb1", false, true},
+    {"shootF", false, false},
+    {"shotC1", false, true},
+    {"swingO1", false, false},
+    {"swingO3", false, false},
+    {"stabO1", false, false},
+    {"tired", false, false},
+    {"tank_prone", false, true},
+    {"proneStab_jaguar", false, true},
+    {"alert2", false, true},
+    {"alert3", false, true},
+    {"alert4", false, true},
+    {"alert5", false, true},
+    {"alert6", false, true},
+    {"alert7", false, true},
+    {"ladder2", false, true},
+    {"rope2", false, true},
+    {"shoot6", false, true},
+    {"magic1", false, true},
+    {"magic2", false, true},
+    {"magic3", false, true},
+    {"magic5", false, true},
+    {"magic6", false, true},
+    {"burster1", false, true},
+    {"burster2", false, true},
+    {"savage", false, true},
+    {"avenger", false, true},
+    {"assaulter", false, true},
+    {"prone2", false, true},
+    {"assassination", false, true},
+    {"assassinationS", false, true},
+    {"tornadoDash", false, true},
+    {"tornadoDashStop", false, true},
+    {"tornadoRush", false, true},
+    {"rush", false, true},
+    {"rush2", false, true},
+    {"brandish1", false, true},
+    {"brandish2", false, true},
+    {"braveslash1", false, true},
+    {"braveslash2", false, true},
+    {"braveslash3", false, true},
+    {"braveslash4", false, true},
+    {"darkImpale", false, true},
+    {"sanctuary", false, true},
+    {"meteor", false, true},
+    {"paralyze", false, true},
+    {"blizzard", false, true},
+    {"genesis", false, true},
+    {"chargeBlow", false, true},
+    {"ninjastorm", false, true},
+    {"blast", false, true},
+    {"holyshield", false, true},
+    {"showdown", false, true},
+    {"resurrection", false, true},
+    {"chainlightning", false, true},
+    {"smokeshell", false, true},
+    {"handgun", false, true},
+    {"somersault", false, true},
+    {"straight", false, true},
+    {"eburster", false, true},
+    {"backspin", false, true},
+    {"eorb", false, true},
+    {"screw", false, true},
+    {"doubleupper", false, true},
+    {"dragonstrike", false, true},
+    {"doublefire", false, true},
+    {"triplefire", false, true},
+    {"fake", false, true},
+    {"airstrike", false, true},
+    {"edrain", false, true},
+    {"octopus", false, true},
+    {"backstep", false, true},
+    {"shot", false, true},
+    {"recovery", false, true},
+    {"fireburner", false, true},
+    {"coolingeffect", false, true},
+    {"fist", false, true},
+    {"timeleap", false, true},
+    {"rapidfire", false, true},
+    {"homing", false, true},
+    {"ghostwalk", false, false},
+    {"ghoststand", true, false},
+    {"ghostjump", false, false},
+    {"ghostproneStab", false, false},
+    {"ghostfly", false, false},
+    {"ghostladder", false, false},
+    {"ghostrope", false, false},
+    {"ghostsit", false, false},
+    {"cannon", false, true},
+    {"torpedo", false, true},
+    {"darksight", false, true},
+    {"bamboo", false, true},
+    {"pyramid", false, true},
+    {"wave", false, true},
+    {"blade", false, true},
+    {"souldriver", false, true},
+    {"firestrike", false, true},
+    {"flamegear", false, true},
+    {"stormbreak", false, true},
+    {"vampire", false, true},
+    {"float", false, true},
+    {"swingT2PoleArm", false, true},
+    {"swingP1PoleArm", false, true},
+    {"swingP2PoleArm", false, true},
+    {"doubleSwing", false, true},
+    {"tripleSwing", false, true},
+    {"fullSwingDouble", false, true},
+    {"fullSwingTriple", false, true},
+    {"overSwingDouble", false, true},
+    {"overSwingTriple", false, true},
+    {"rollingSpin", false, true},
+    {"comboSmash", false, true},
+    {"comboFenrir", false, true},
+    {"comboTempest", false, true},
+    {"finalCharge", false, true},
+    {"combatStep", false, true},
+    {"finalBlow", false, true},
+    {"finalBlow2", false, true},
+    {"finalToss", false, true},
+    {"magicmissile", false, true},
+    {"lightingBolt", false, true},
+    {"dragonBreathe", false, true},
+    {"breathe_prepare", false, true},
+    {"dragonIceBreathe", false, true},
+    {"icebreathe_prepare", false, true},
+    {"blaze", false, true},
+    {"fireCircle", false, true},
+    {"illusion", false, true},
+    {"magicFlare", false, true},
+    {"elementalReset", false, true},
+    {"magicRegistance", false, true},
+    {"recoveryAura", false, true},
+    {"magicBooster", false, true},
+    {"magicShield", false, true},
+    {"flameWheel", false, true},
+    {"killingWing", false, true},
+    {"OnixBlessing", false, true},
+    {"Earthquake", false, true},
+    {"soulStone", false, true},
+    {"dragonThrust", false, true},
+    {"ghostLettering", false, true},
+    {"darkFog", false, true},
+    {"slow", false, true},
+    {"mapleHero", false, true},
+    {"Awakening", false, true},
+    {"flyingAssaulter", false, true},
+    {"tripleStab", false, true},
+    {"fatalBlow", false, true},
+    {"slashStorm1", false, true},
+    {"slashStorm2", false, true},
+    {"bloodyStorm", false, true},
+    {"flashBang", false, true},
+    {"upperStab", false, true},
+    {"bladeFury", false, true},
+    {"chainPull", false, true},
+    {"chainAttack", false, true},
+    {"owlDead", false, true},
+    {"monsterBombPrepare", false, true},
+    {"monsterBombThrow", false, true},
+    {"finalCut", false, true},
+    {"finalCutPrepare", false, true},
+    {"DBbladeAscension", false, true},
+    {"cyclone_pre", false, true},
+    {"cyclone", false, true},
+    {"cyclone_after", false, true},
+    {"doubleJump", false, true},
+    {"knockback", false, true},
+    {"darkTornado_pre", false, true},
+    {"darkTornado", false, true},
+    {"darkTornado_after", false, true},
+    {"dungdung", false, true},
+    {"rbooster_pre", false, true},
+    {"rbooster", false, true},
+    {"rbooster_after", false, true},
+    {"crossRoad", false, true},
+    {"nemesis", false, true},
+    {"wildbeast", false, true},
+    {"siege_pre", false, true},
+    {"siege", false, true},
+    {"siege_stand", false, true},
+    {"siege_after", false, true},
+    {"tank_pre", false, true},
+    {"tank", false, true},
+    {"tank_stand", false, true},
+    {"tank_after", false, true},
+    {"tank_walk", false, true},
+    {"tank_laser", false, true},
+    {"tank_siegepre", false, true},
+    {"tank_siegeattack", false, true},
+    {"tank_siegestand", false, true},
+    {"tank_siegeafter", false, true},
+    {"tank_hoverpre", false, true},
+    {"tank_hoverattack", false, true},
+    {"tank_hoverstand", false, true},
+    {"tank_hoverafter", false, true},
+    {"tank_hovermove", false, true},
+    {"tank_hovermRush", false, true},
+    {"sonicBoom", false, true},
+    {"revive", false, true},
+    {"darkLightning", false, true},
+    {"darkChain", false, true},
+    {"glacialChain", false, true},
+    {"flamethrower_pre", false, true},
+    {"flamethrower", false, true},
+    {"flamethrower_after", false, true},
+    {"flamethrower_pre2", false, true},
+    {"flamethrower2", false, true},
+    {"flamethrower_after2", false, true},
+    {"mbooster", false, true},
+    {"msummon", false, true},
+    {"msummon2", false, true},
+    {"gatlingshot", false, true},
+    {"gatlingshot2", false, true},
+    {"drillrush", false, true},
+    {"earthslug", false, true},
+    {"rpunch", false, true},
+    {"clawCut", false, true},
+    {"swallow_attack", false, true},
+    {"WHassistantHuntingUnit", false, true},
+    {"WHextendMagazine", false, true},
+    {"capture", false, true},
+    {"ride", false, true},
+    {"getoff", false, true},
+    {"ride2", false, true},
+    {"getoff2", false, true},
+    {"ride3", false, true},
+    {"getoff3", false, true},
+    {"mRush", false, true},
+    {"tank_msummon", false, true},
+    {"tank_msummon2", false, true},
+    {"tank_mRush", false, true},
+    {"tank_rbooster_pre", false, true},
+    {"tank_rbooster_after", false, true},
+    {"gather0", false, true},
+    {"gather1", false, true},
+    {"OnixProtection", false, true},
+    {"OnixWill", false, true},
+    {"phantomBlow", false, true},
+    {"comboJudgement", false, true},
+    {"arrowRain", false, true},
+    {"arrowEruption", false, true},
+    {"iceStrike", false, true},
+    {"explosion", false, true},
+    {"pvpko", false, true},
+    {"pvpko2", false, true},
+    {"swingT2Giant", false, true},
+    {"counterCannon", false, true},
+    {"cannonJump", false, true},
+    {"swiftShot", false, true},
+    {"slayerDoubleJump", false, true},
+    {"giganticBackstep", false, true},
+    {"mistEruption", false, true},
+    {"cannonSmash", false, true},
+    {"cannonSlam", false, true},
+    {"flamesplash", false, true},
+    {"piratebless", false, true},
+    {"rushBoom", false, true},
+    {"noiseWave", false, true},
+    {"noiseWave_pre", false, true},
+    {"noiseWave_ing", false, true},
+    {"monkeyBoomboom", false, true},
+    {"superCannon", false, true},
+    {"magneticCannon", false, true},
+    {"jShot", false, true},
+    {"demonSlasher", false, true},
+    {"bombExplosion", false, true},
+    {"cannonSpike", false, true},
+    {"speedDualShot", false, true},
+    {"strikeDual", false, true},
+    {"cannonBooster", false, true},
+    {"crossPiercing", false, true},
+    {"piercing", false, true},
+    {"spiritJump", false, true},
+    {"elfTornado", false, true},
+    {"immolation", false, true},
+    {"deathDraw", false, true},
+    {"healingAttack", false, true},
+    {"edgeSpiral", false, true},
+    {"windEffect", false, true},
+    {"elfrush", false, true},
+    {"elfrush2", false, true},
+    {"elfrush_final", false, true},
+    {"elfrush_final2", false, true},
+    {"demolitionElf", false, true},
+    {"dealingRush", false, true},
+    {"pirateSpirit", false, true},
+    {"maxForce0", false, true},
+    {"maxForce1", false, true},
+    {"maxForce2", false, true},
+    {"maxForce3", false, true},
+    {"demonGravity", false, true},
+    {"powerEndure", false, true},
+    {"darkThrust", false, true},
+    {"demonTrace", false, true},
+    {"demonTracePrep", false, true},
+    {"dualVulcanPrep", false, true},
+    {"dualVulcanLoop", false, true},
+    {"dualVulcanEnd", false, true},
+    {"darkSpin", false, true},
+    {"devilCry", false, true},
+    {"blessOfGaia", false, true},
+    {"darkDevilCry", false, true},
+    {"rollingElf", false, true},
+    {"bluntSmashPrep", false, true},
+    {"bluntSmashLoop", false, true},
+    {"bluntSmashEnd", false, true},
+    {"demonicBreathe_prep", false, true},
+    {"demonicBreathe", false, true},
+    {"demonicBreathe_end", false, true},
+    {"demonJumpUpward", false, true},
+    {"demonJumpFoward", false, true},
+    {"soulEater_prep", false, true},
+    {"soulEater", false, true},
+    {"soulEater_end", false, true},
+    {"devilishPower", false, true},
+    {"demonImpact", false, true},
+    {"demonbind", false, true},
+    {"provoc", false, true},
+    {"demonFly", false, true},
+    {"demonFly2", false, true},
+    {"reverseGravity", false, true},
+    {"reverseGravity2", false, true},
+    {"partyHealing", false, true},
+    {"fallDown_direction", false, true},
+    {"itemThrow1", false, true},
+    {"itemThrow2", false, true},
+    {"shurikenBurst", false, true},
+    {"tripleThrow", false, true},
+    {"quadrupleThrow", false, true},
+    {"windTalisman", false, true},
+    {"suddenRaid", false, true},
+    {"shadeSplit", false, true},
+    {"edgeCarnival", false, true},
+    {"HTultimateDrivePrep", false, true},
+    {"HTultimateDrive", false, true},
+    {"HTultimateDriveEnd", false, true},
+    {"HTtempestPrep", false, true},
+    {"HTtempest", false, true},
+    {"HTswiftPhantom", false, true},
+    {"doubleBarrel", false, true},
+    {"assembleCrew", false, true},
+    {"bulletSmash", false, true},
+    {"tornadoUpper", false, true},
+    {"HTluckOfMasterthief", false, true},
+    {"HTtwilightVanish", false, true},
+    {"HTtwilightFinish", false, true},
+    {"HTdoublePiercing", false, true},
+    {"HTcallOfFate", false, true},
+    {"HTknightEngaging", false, true},
+    {"HTcoatOfArms", false, true},
+    {"HTprotectMisfortune", false, true},
+    {"fusillade", false, true},
+    {"headShot", false, true},
+    {"HTphantomCharge", false, true},
+    {"HTphantomCharge2", false, true},
+    {"energyBlast", false, true},
+    {"fistEnrage", false, true},
+    {"wings", false, true},
+    {"doubleSpiral", false, true},
+    {"HTphantomship", false, true},
+    {"SharpSlash", false, true},
+    {"shiningChase", false, true},
+    {"ShiningRay", false, true},
+    {"ShiningBlast", false, true},
+    {"SoulSlash", false, true},
+    {"SoulAssault", false, true},
+    {"ragingBlow1", false, true},
+    {"ragingBlow2", false, true},
+    {"ragingBlow3", false, true},
+    {"ragingBlow4", false, true},
+    {"LMsylphidLancer", false, true},
+    {"LMnoxSphere", false, true},
+    {"LMmornigStarfall", false, true},
+    {"LMtwinkleFlash", false, true},
+    {"LMextendMana", false, true},
+    {"LMshineRedemption", false, true},
+    {"LMdarkFalling", false, true},
+    {"LMvoidPressurePrepare", false, true},
+    {"LMvoidPressureKeydown", false, true},
+    {"LMvoidPressureEnd", false, true},
+    {"LMinviolability", false, true},
+    {"LMabsoluteKill", false, true},
+    {"LMapocalypse", false, true},
+    {"LMdarkCresendo", false, true},
+    {"LMmagicBooster", false, true},
+    {"LMdarkScythe", false, true},
+    {"LMspectralLightPrepare", false, true},
+    {"LMspectralLightKeydown", false, true},
+    {"LMspectralLightEnd", false, true},
+    {"LMlightReflection", false, true},
+    {"LMarmageddon", false, true},
+    {"LMlightShadowGuard", false, true},
+    {"DKdragonUpper", false, true},
+    {"DKimpactWave", false, true},
+    {"DKburstUp", false, true},
+    {"DKdragonSlash0", false, true},
+    {"DKdragonSlash1", false, true},
+    {"DKdragonSlash2", false, true},
+    {"DKextraKnockback", false, true},
+    {"DKropeConnect0", false, true},
+    {"DKropeConnect1", false, true},
+    {"DKropeConnect2", false, true},
+    {"DKchainPulling", false, true},
+    {"DKflyingSword", false, true},
+    {"DKwingBeat", false, true},
+    {"DKpestopassing", false, true},
+    {"DKregainStr", false, true},
+    {"DKenterTheDragon", false, true},
+    {"DKmedusa", false, true},
+    {"DKsoulCharge", false, true},
+    {"DKgigaSlasher", false, true},
+    {"DKearthQuake0", false, true},
+    {"DKearthQuake1", false, true},
+    {"earthBreak", false, true},
+    {"ABsuccessor_prep", false, true},
+    {"ABsuccessor", false, true},
+    {"ABsuccessor_end", false, true},
+    {"ABbubbleStar", false, true},
+    {"ABlyricalCross", false, true},
+    {"ABstingExplosion", false, true},
+    {"ABstingExplosion_second", false, true},
+    {"ABpinkScud", false, true},
+    {"ABpowerTransfer", false, true},
+    {"ABsoulSeeker", false, true},
+    {"ABgiganticIcycle", false, true},
+    {"ABlandCrash", false, true},
+    {"ABcallOfAncient", false, true},
+    {"ABironLotus", false, true},
+    {"ABprimalRoar", false, true},
+    {"ABtrinity_first", false, true},
+    {"ABtrinity_second", false, true},
+    {"ABtrinity_third", false, true},
+    {"ABfatality", false, true},
+    {"ABsoulResonance_prep", false, true},
+    {"ABsoulResonance", false, true},
+    {"ABsoulResonance_end", false, true},
+    {"ABsoulGaze", false, true},
+    {"DAexGrandCross0", false, true},
+    {"DAexGrandCross1", false, true},
+    {"DAexGrandCross2", false, true},
+    {"DAexGrandCross3", false, true},
+    {"DAexGrandCross4", false, true},
+    {"DAexDemonStrike", false, true},
+    {"DAbatsSwarm", false, true},
+    {"DAreleaseOverload", false, true},
+    {"DAabyssalRage", false, true},
+    {"DAexMoonLightSlash0", false, true},
+    {"DAexMoonLightSlash1", false, true},
+    {"DAexMoonLightSlash2", false, true},
+    {"DAexMoonLightSlash3", false, true},
+    {"DAexMoonLightSlash4", false, true},
+    {"DAshieldCharge0", false, true},
+    {"DAshieldCharge1", false, true},
+    {"DAinhaleVitalityPrep", false, true},
+    {"DAinhaleVitality", false, true},
+    {"DAinhaleVitalityEnd", false, true},
+    {"DAexExecution0", false, true},
+    {"DAexExecution1", false, true},
+    {"DAexExecution2", false, true},
+    {"DAexExecution3", false, true},
+    {"DAexExecution4", false, true},
+    {"DAshieldChasing", false, true},
+    {"DAarmorBreak", false, true},
+    {"DAthousandSword0", false, true},
+    {"DAforbiddenContract", false, true},
+    {"DAdemonBind", false, true},
+    {"RTionThrusterPrep", false, true},
+    {"RTionThruster", false, true},
+    {"RTionThrusterEnd", false, true},
+    {"RTdiagonalChase", false, true},
+    {"RTlinearPerspective", false, true},
+    {"RTenergySpline", false, true},
+    {"RTcombatSwitchingUp", false, true},
+    {"RTcombatSwitchingLeft", false, true},
+    {"RTcombatSwitchingRight", false, true},
+    {"RTbladeDancingPrep", false, true},
+    {"RTbladeDancing", false, true},
+    {"RTbladeDancingEnd", false, true},
+    {"RTpillarScramble", false, true},
+    {"RTfuzzyLobMasUp", false, true},
+    {"RTfuzzyLobMasLeft", false, true},
+    {"RTfuzzyLobMasRight", false, true},
+    {"RTbooster", false, true},
+    {"RTquickSilverSwordUp", false, true},
+    {"RTquickSilverSwordLeft", false, true},
+    {"RTquickSilverSwordRight", false, true},
+    {"RThologramGraffiti", false, true},
+    {"RTconfineEntangle", false, true},
+    {"RTtimeCapsule", false, true},
+    {"RTtankAssult", false, true},
+    {"CKelementalSlash", false, true},
+    {"CKjourneyHome", false, true},
+    {"STflash", false, true},
+    {"STwaterWave", false, true},
+    {"STthunder", false, true},
+    {"STtornado", false, true},
+    {"STneedleCarapace", false, true},
+    {"STsharkUltimate", false, true},
+    {"STsharkSoryuken", false, true},
+    {"STthunderBolt", false, true},
+    {"STtypoon", false, true},
+    {"STsharkTooth", false, true},
+    {"STsharkKick", false, true},
+    {"STelectricCharge", false, true},
+    {"WBbreezeArrow", false, true},
+    {"WBwindWalk_land", false, true},
+    {"WBwindWalk_air", false, true},
+    {"WBpinPointPierce", false, true},
+    {"WBemeraldFlower", false, true},
+    {"WBalbatross", false, true},
+    {"WBgustShot", false, true},
+    {"WBfairyTurn", false, true},
+    {"WBdanceOfFrozenWindPrepare", false, true},
+    {"WBdanceOfFrozenWindKeydown", false, true},
+    {"WBdanceOfFrozenWindEnd", false, true},
+    {"RAwhiteHeatRush", false, true},
+    {"SMlightFlux", false, true},
+    {"SMsilentMove", false, true},
+    {"SMsolarPierce", false, true},
+    {"SMfallingMoonStand", false, true},
+    {"SMrisingSunStand", false, true},
+    {"SMfallingMoon", false, true},
+    {"SMrisingSun", false, true},
+    {"SMdanceOfMoon", false, true},
+    {"SMdanceOfMoonAir", false, true},
+    {"SMmoonShadow", false, true},
+    {"SMcresentDivide", false, true},
+    {"SMspeedingSunset", false, true},
+    {"SMspeedingSunsetAir", false, true},
+    {"SMmoonCross", false, true},
+    {"SMsunCross", false, true},
+    {"SMtripleSlash", false, true},
+    {"SMswordOfLight", false, true},
+    {"SMsoulPenetration", false, true},
+    {"SMsolunarTime", false, true},
+    {"SMsoulPledge", false, true},
+    {"SMloudRush", false, true},
+    {"SMtraceCut", false, true},
+    {"SMshadowBurn", false, true},
+    {"SMfallingMoonStand2", false, true},
+    {"SMrisingSunStand2", false, true},
+    {"SMfallingMoon2", false, true},
+    {"SMrisingSun2", false, true},
+    {"SMdanceOfMoon2", false, true},
+    {"SMdanceOfMoonAir2", false, true},
+    {"SMmoonShadow2", false, true},
+    {"SMcresentDivide2", false, true},
+    {"SMspeedingSunset2", false, true},
+    {"SMspeedingSunsetAir2", false, true},
+    {"SMmoonCross2", false, true},
+    {"SMsunCross2", false, true},
+    {"SMtripleSlash2", false, true},
+    {"SMswordOfLight2", false, true},
+    {"SMsoulPenetration2", false, true},
+    {"SMsolunarTime2", false, true},
+    {"SMsoulPledge2", false, true},
+    {"SMloudRush2", false, true},
+    {"SMtraceCut2", false, true},
+    {"SMshadowBurn2", false, true},
+    {"lamanchaSpearPrep", false, true},
+    {"lamanchaSpear", false, true},
+    {"lamanchaSpearEnd", false, true},
+    {"slashBlast", false, true},
+    {"slashBlast2", false, true},
+    {"brandishNew", false, true},
+    {"brandishNew2", false, true},
+    {"comboForce", false, true},
+    {"comboForce0", false, true},
+    {"weaponBooster", false, true},
+    {"furyNew", false, true},
+    {"shoutNew", false, true},
+    {"incising", false, true},
+    {"magicCrash", false, true},
+    {"stanceNew", false, true},
+    {"pageOrder", false, true},
+    {"restoration", false, true},
+    {"rushNew", false, true},
+    {"panic", false, true},
+    {"threat", false, true},
+    {"blastNew", false, true},
+    {"sanctuaryNew", false, true},
+    {"voidCharge", false, true},
+    {"guardianSpirit", false, true},
+    {"piercingThrough", false, true},
+    {"spearPulling", false, true},
+    {"ironWallNew", false, true},
+    {"gungnirDescent", false, true},
+    {"sacrifice", false, true},
+    {"energyBolt", false, true},
+    {"magicArmor", false, true},
+    {"flameArrow", false, true},
+    {"armorMeltingPrep", false, true},
+    {"armorMelting", false, true},
+    {"armorMeltingEnd", false, true},
+    {"thunderBolt", false, true},
+    {"flameHaze", false, true},
+    {"meteorNew", false, true},
+    {"viciousSlime", false, true},
+    {"poisonMist", false, true},
+    {"elementalAdapting", false, true},
+    {"blizzardNew", false, true},
+    {"holySymbol", false, true},
+    {"holyArrow", false, true},
+    {"invincible", false, true},
+    {"coldBeam", false, true},
+    {"thunderStorm", false, true},
+    {"chainLightningNew", false, true},
+    {"frozenOrb", false, true},
+    {"divineProtection", false, true},
+    {"angelRay", false, true},
+    {"createHalidom", false, true},
+    {"castNetThrowing", false, true},
+    {"advancedQuiver", false, true},
+    {"woundsShot", false, true},
+    {"retreatShotPre", false, true},
+    {"retreatShot", false, true},
+    {"retreatShotEnd", false, true},
+    {"steigeisenConnect0", false, true},
+    {"steigeisenConnect1", false, true},
+    {"steigeisenConnect2", false, true},
+    {"painKiller", false, true},
+    {"arrowIllusion", false, true},
+    {"resurrectionNew", false, true},
+    {"uncountableArrow", false, true},
+    {"boltRupture", false, true},
+    {"snipingNew", false, true},
+    {"genesisNew", false, true},
+    {"piercingNew", false, true},
+    {"ragingBlowNew", false, true},
+    {"shadeSplitNew", false, true},
+    {"showDownChallenge", false, true},
+    {"savageBlow", false, true},
+    {"assassinationNew", false, true},
+    {"energyTornado", false, true},
+    {"energyBuster", false, true},
+    {"energyBlastNew", false, true},
+    {"energyBlastMax", false, true},
+    {"wingsNew", false, true},
+    {"battleShipBomberPre", false, true},
+    {"battleShipBomber", false, true},
+    {"battleShipBomberEnd", false, true},
+    {"chargeBlow2", false, true},
+    {"assassinationNew2", false, true},
+    {"blastNew2", false, true},
+    {"shadowWeb", false, true},
+    {"zeroAurora", false, true},
+    {"returnTemple", false, true},
+    {"zeroDash", false, true},
+    {"zeroDash", false, true},
+    {"risingSlash", false, true},
+    {"earthStomp", false, true},
+    {"moonStrike", false, true},
+    {"pierceAttack", false, true},
+    {"shadowCrossing_pre", false, true},
+    {"shadowCrossing", false, true},
+    {"upperSlash", false, true},
+    {"adEarthStomp", false, true},
+    {"adEarthStomp_shockWave", false, true},
+    {"shadowCrossing_blade", false, true},
+    {"flashStrike", false, true},
+    {"spinCutter", false, true},
+    {"adSpinCutter", false, true},
+    {"adSpinCutter_blade", false, true},
+    {"turningSwing", false, true},
+    {"turningDrive", false, true},
+    {"whirlWind_pre", false, true},
+    {"whirlWind", false, true},
+    {"frontStrike", false, true},
+    {"throwingWeapon", false, true},
+    {"adThrowingWeapon", false, true},
+    {"windCutter", false, true},
+    {"windCrash", false, true},
+    {"stormBreak", false, true},
+    {"adStormBreak", false, true},
+    {"gigaStrike", false, true},
+    {"jumpingCrash", false, true},
+    {"jumpingCrash_shockWave", false, true},
+    {"earthBreak", false, true},
+    {"earthBreak_shockWave", false, true},
+    {"adEarthBreak", false, true},
+    {"adEarthBreak_shockWave", false, true},
+    {"rollingAssaulter", false, true},
+    {"adRollingAssaulter", false, true},
+    {"adRollingAssaulter_blade", false, true},
+    {"rollingStomp", false, true},
+    {"adRollingStomp", false, true},
+    {"adRollingStomp_blade", false, true},
+    {"shadowRain_beta", false, true},
+    {"shadowRain_alpha", false, true},
+    {"dropTime", false, true},
+    {"dropTime_beta", false, true},
+    {"hurricaneWind_pre", false, true},
+    {"hurricaneWind", false, true},
+    {"hurricaneWind_end", false, true},
+    {"timeDistotion", false, true},
+    {"RMbattleSpurt", false, true},
+    {"HY3212battleMaster", false, true},
+    {"CSmonkeyFurious", false, true},
+    {"HY6512superNova", false, true},
+    {"beyonder_first", false, true},
+    {"beyonder_second", false, true},
+    {"beyonder_third", false, true},
+    {"HY2112comboUnlimited", false, true},
+    {"HY6512finalContract", false, true},
+    {"HY6512soulExalt", false, true},
+    {"HY2312wrathOfEnlil", false, true},
+    {"HY6112prominence", false, true},
+    {"HY2412roseCarteFinale", false, true},
+    {"FrenziedSoul", false, true},
+    {"HY222lightningSphere_prep", false, true},
+    {"HY222lightningSphere", false, true},
+    {"HY222lightningSphere_end", false, true},
+    {"HY112rageUprising", false, true},
+    {"HY112valhalla", false, true},
+    {"HY122smite", false, true},
+    {"HY122sacrosanctity", false, true},
+    {"HY132darkSynthesis", false, true},
+    {"HY132darkThirst", false, true},
+    {"HY222iceAura", false, true},
+    {"HY212megiddoFlame", false, true},
+    {"HY212fireAura", false, true},
+    {"HY5112deadlyCharge", false, true},
+    {"HY5112sacredCube", false, true},
+    {"HY232vengenceOfAngel", false, true},
+    {"HY312stormArrowMovable", false, true},
+    {"HY312windOfFrey", false, true},
+    {"HY312preperation", false, true},
+    {"HY322longRangeTrueShot", false, true},
+    {"HY322bullseye", false, true},
+    {"HY412fourSeasons", false, true},
+    {"HY412bleedingToxin", false, true},
+    {"HY422veilOfShadow", false, true},
+    {"HY434asura_prep", false, true},
+    {"HY434asura", false, true},
+    {"HY434asura_end", false, true},
+    {"HY434hiddenBlade", false, true},
+    {"HY512unityOfPower", false, true},
+    {"HY512stimulate", false, true},
+    {"HY522bigFatBoy", false, true},
+    {"HY522unwearyingRum", false, true},
+    {"HY3112cerberus", false, true},
+    {"HY3112blueBlood", false, true},
+    {"HY3312rampageAsOne", false, true},
+    {"HY3312silentRampage", false, true},
+    {"HY3512distortionField", false, true},
+    {"HY3512tank_distortionField", false, true},
+    {"HY3512tank_siege_distortionField", false, true},
+    {"HY532rollingCannon_prep", false, true},
+    {"HY532rollingCannon", false, true},
+    {"HY532rollingCannon_end", false, true},
+    {"HY3212unionAura", false, true},
+    {"HY3212battleKingBar_first", false, true},
+    {"HY3212battleKingBar_second", false, true},
+    {"HY3212anotherBlow", false, true},
+    {"RTmeltdownExplosion", false, true},
+    {"HY1512godOfTheSea", false, true},
+    {"HY1512creationOfTheBeginning", false, true},
+    {"HY1312monsoon", false, true},
+    {"HY1312stormBringer", false, true},
+    {"HY1112crossTheStyx", false, true},
+    {"HY1112crossTheStyx_prep", false, true},
+    {"HY1112crossTheStyx_end", false, true},
+    {"HY1112soulForge", false, true},
+    {"HY1112crossTheStyx2", false, true},
+    {"HY1112crossTheStyx2_prep", false, true},
+    {"HY1112crossTheStyx2_end", false, true},
+    {"iceAttack1", false, true},
+    {"iceAttack2", false, true},
+    {"iceSmash", false, true},
+    {"iceDoubleJump", false, true},
+    {"iceTempest", false, true},
+    {"iceChop", false, true},
+    {"icePanic", false, true},
+    {"create0", false, true},
+    {"create1", false, true},
+    {"create2", false, false},
+    {"create2_s", false, false},
+    {"create2_f", false, false},
+    {"create3", false, false},
+    {"create3_s", false, false},
+    {"create3_f", false, false},
+    {"create4", false, false},
+    {"create4_s", false, false},
+    {"create4_f", false, false},
+    {"shockwave", false, true},
+    {"demolition", false, true},
+    {"snatch", false, true},
+    {"windspear", false, true},
+    {"windshot", false, true},
+    {"fly2", false, true},
+    {"fly2Move", false, true},
+    {"fly2Skill", false, true},
+    {"herbalism_jaguar", false, true},
+    {"mining_jaguar", false, true},
+    {"herbalism_mechanic", false, true},
+    {"mining_mechanic", false, true},
+    {"backward", false, true},
+    {"stand1_floating", false, true},
+    {"stand2_floating", false, true},
+    {"stand1_floating2", false, true},
+    {"stand2_floating2", false, true},
+    {"VampDeath", false, true},
+    {"hide", false, false},
+    {"MichaelLink", false, true},
+    {"setitem3", false, false},
+    {"setitem4", false, false},
+    {"soulSkillDragonRiderJP", false, true},
+    {"soulSkillBarlogJP", false, true},
+    {"soulSkillPinkbeanJP", false, true},
+    {"soulSkillVanLeonJP", false, true},
+    {"soulSkillAniJP", false, true},
+    {"soulSkillRockJP", false, true},
+    {"soulSkillMugongJP", false, true},
+    {"soulSkillZakumJP", false, true},
+    {"soulSkillHontailJP", false, true},
+    {"soulSkillRexJP", false, true},
+    {"fullSoulActionJP", false, true},
+    {"cappufire", false, true},
+    {"cappucut", false, true},
+    {"foodFight1", false, true},
+    {"wiping", false, true},
+    {"hekatonFlightAttack", false, true},
+    {"dance0", false, false},
+    {"dance1", false, false},
+    {"dance2", false, false},
+    {"dance3", false, false},
+    {"mesoRed", false, false},
+    {"mesoBlue", false, false},
+    {"mesoGreen", false, false},
+    {"mesoYellow", false, false},
+    {"mesoPink", false, false},
+    {"shockWavePunch0", false, true},
+    {"shockWavePunch1", false, true},
+    {"shockWavePunch2", false, true},
+    {"groundStrike0", false, true},
+    {"groundStrike1", false, true},
+    {"cancelBackStep", false, true},
+    {"deathMarker", false, true},
+    {"momentStep", false, true},
+    {"divisionSoulAttack", false, true},
+    {"summonSoulTent_pre", false, true},
+    {"summonSoulTent", false, true},
+    {"summonRedemption", false, true},
+    {"spiritClaw", false, true},
+    {"bombPunch0", false, true},
+    {"bombPunch1", false, true},
+    {"bombPunch2", false, true},
+    {"bombPunch3", false, true},
+    {"megaPunch0", false, true},
+    {"megaPunch1", false, true},
+    {"dragPulling_front", false, true},
+    {"dragPulling_turn", false, true},
+    {"dragPulling_down", false, true},
+    {"spiritBarrier", false, true},
+    {"bindArea", false, true},
+    {"spiritTransformation", false, true},
+    {"FWflameOrb", false, true},
+    {"FWflameWind", false, true},
+    {"FWflareBlink", false, true},
+    {"FWfireRelease", false, true},
+    {"FWblazingStrike", false, true},
+    {"FWcolossusBomb", false, true},
+    {"FWflameBall", false, true},
+    {"FWignition", false, true},
+    {"FWsoulProtection", false, true},
+    {"FWflameSprit", false, true},
+    {"FWburningRegion", false, true},
+    {"FWultimateBurnout", false, true},
+    {"FWdragonSlavePrep", false, true},
+    {"FWdragonSlave", false, true},
+    {"FWdragonSlaveLast", false, true},
+    {"NWrapidEvasion", false, true},
+    {"NWdarknessOmen", false, true},
+    {"NWdarknessOmenPre", false, true},
+    {"HY1412Dominion", false, true},
+    {"NWshadowStitchPrepare", false, true},
+    {"NWtripleThrow", false, true},
+    {"NWtripleThrow2", false, true},
+    {"NWquadrupleThrow", false, true},
+    {"NWquadrupleThrow2", false, true},
+    {"NWstardust", false, true},
+    {"NWdarknessAscension", false, true},
+    {"NWquintupleThrow", false, true},
+    {"NWquintupleThrow2", false, true},
+    {"NWshadowStitch", false, true},
+    {"HY1412Shadowillusion", false, true},
+    {"NWluckySeven", false, true},
+    {"NWshadowServant", false, true},
+    {"dance_starP0", false, false},
+    {"dance_starP1", false, false},
+    {"dance_starP2", false, false},
+    {"dance_starP3", false, false},
+    {"dance_starP4", false, false},
+    {"dance_starP5", false, false},
+    {"dance_star_ev0", false, false},
+    {"dance_star_ev1", false, false},
+    {"dance_star_ev2", false, false},
+    {"dance_star_ev3", false, false},
+    {"dance_star_ev4", false, false},
+    {"dance_star_ev5", false, false},
+    {"crawl", false, true},
+    {"boost1", false, true},
+    {"boost2", false, true},
+    {"plane_die", false, true},
+    {"wakeup_swing", false, true},
+    {"WHdoubleShot", false, true},
+    {"WHtripleShot", false, true},
+    {"WHwildShot", false, true},
+    {"WHdrillContainer", false, true},
+    {"WHwildVulcan", false, true},
+    {"WHsummonJaguar", false, true},
+    {"advancedgatling", false, true},
+    {"homingmissile", false, true},
+    {"focusFire", false, true},
+    {"tank_focusFire", false, true},
+    {"multiFire_pre", false, true},
+    {"multiFire", false, true},
+    {"multiFire_after", false, true},
+    {"tank_multiFire", false, true},
+    {"tank_getoff2", false, true},
+    {"tank_ride2", false, true},
+    {"tank_rbooster", false, true},
+    {"tank_jump", false, true},
+    {"tank_ladder", false, true},
+    {"tank_rope", false, true},
+    {"tank_herbalism_mechanic", false, true},
+    {"tank_mining_mechanic", false, true},
+    {"georg_attack1", false, true},
+    {"hideBody", false, false},
+    {"PBwalk1", false, false},
+    {"PBstand1", false, false},
+    {"PBstand2", false, false},
+    {"PBstand3", false, false},
+    {"PBstand4", false, false},
+    {"PBstand5", false, false},
+    {"PBstand6", false, false},
+    {"PBstand7", false, false},
+    {"PBstand8", false, false},
+    {"PBstand9", false, false},
+    {"PBstand10", false, false},
+    {"PBstand11", false, false},
+    {"PBstand12", false, false},
+    {"PBalert", false, false},
+    {"PBswingO1", false, false},
+    {"PBswingT1", false, false},
+    {"PBswingTF", false, false},
+    {"PBswingP1", false, false},
+    {"PBswingPF", false, false},
+    {"PBswingT2Giant", false, false},
+    {"PBstabO1", false, false},
+    {"PBstabT1", false, false},
+    {"PBstabTF", false, false},
+    {"PBproneStab", false, false},
+    {"PBprone", false, false},
+    {"PBheal", false, false},
+    {"PBfly", false, false},
+    {"PBflySkill", false, false},
+    {"PBjump", false, false},
+    {"PBsit", false, false},
+    {"PBladder", false, false},
+    {"PBrope", false, false},
+    {"PBdead", false, false},
+    {"PBdead2", false, false},
+    {"PBblink", false, false},
+    {"PBAttack1", false, false},
+    {"PBAttack2A", false, false},
+    {"PBAttack2B", false, false},
+    {"PBAttack3A", false, false},
+    {"PBAttack3B", false, false},
+    {"PBAttack4A", false, false},
+    {"PBAttack4B", false, false},
+    {"PBUmbrella", false, false},
+    {"PBUmbrella_loop", false, false},
+    {"PBSummon", false, false},
+    {"PBRollingAttackPrep", false, false},
+    {"PBRollingAttack1", false, false},
+    {"PBRollingAttack2", false, false},
+    {"PBRollingAttackEnd", false, false},
+    {"PBRollingAttackAir", false, false},
+    {"PBOgoStickPrep", false, false},
+    {"PBOgoStickKeydown", false, false},
+    {"PBOgoStickGaugeMax", false, false},
+    {"PBOgoStick_sky_repeat", false, false},
+    {"PBOgoStickEnd", false, false},
+    {"PBOgoStickAttackafter", false, false},
+    {"PBYoyo1", false, false},
+    {"PBYoyo2", false, false},
+    {"PBPinkGenesis", false, false},
+    {"PBMusic1", false, false},
+    {"PBMusic2", false, false},
+    {"PBMusic3", false, false},
+    {"PBRelaxA", false, false},
+    {"PBRelaxB", false, false},
+    {"PBRelaxC", false, false},
+    {"PBRelaxD", false, false},
+    {"PBRelaxE", false, false},
+    {"PBCheer", false, false},
+    {"PBmangchi", false, false},
+    {"PBCheer", false, false},
+    {"PVPA1_walk", false, false},
+    {"PVPA1_stand", false, false},
+    {"PVPA1_rope", false, false},
+    {"PVPA1_prone", false, false},
+    {"PVPA1_proneStab", false, false},
+    {"PVPA1_jump", false, false},
+    {"PVPA1_die", false, false},
+    {"PVPA1_attack1", false, false},
+    {"PVPA1_attack2", false, false},
+    {"PVPA1_tripleAttack", false, false},
+    {"PVPA1_ankleAttack", false, false},
+    {"PVPA1_balogAttack", false, false},
+    {"PVPA1_ultimate", false, false},
+    {"PVPA2_walk", false, false},
+    {"PVPA2_stand", false, false},
+    {"PVPA2_rope", false, false},
+    {"PVPA2_prone", false, false},
+    {"PVPA2_proneStab", false, false},
+    {"PVPA2_jump", false, false},
+    {"PVPA2_die", false, false},
+    {"PVPA2_dummy", false, false},
+    {"PVPA2_attack1", false, false},
+    {"PVPA2_attack2", false, false},
+    {"PVPA2_bugle", false, true},
+    {"PVPA2_giantClub", false, true},
+    {"PVPA3_walk", false, false},
+    {"PVPA3_stand", false, false},
+    {"PVPA3_rope", false, false},
+    {"PVPA3_prone", false, false},
+    {"PVPA3_proneStab", false, false},
+    {"PVPA3_jump", false, false},
+    {"PVPA3_die", false, false},
+    {"PVPA3_dummy", false, false},
+    {"PVPA3_attack1", false, false},
+    {"PVPA3_attack2", false, false},
+    {"PVPA3_tomb", false, true},
+    {"PVPA3_bigdagger", false, true},
+    {"PVPA3_bet", false, true},
+    {"PVPA4_walk", false, false},
+    {"PVPA4_stand", false, false},
+    {"PVPA4_rope", false, false},
+    {"PVPA4_prone", false, false},
+    {"PVPA4_proneStab", false, false},
+    {"PVPA4_jump", false, false},
+    {"PVPA4_die", false, false},
+    {"PVPA4_dummy", false, false},
+    {"PVPA4_attack", false, true},
+    {"PVPA4_typoon", false, true},
+    {"PVPA4_meteo", false, true},
+    {"PVPA5_walk", false, false},
+    {"PVPA5_stand", false, false},
+    {"PVPA5_rope", false, false},
+    {"PVPA5_prone", false, false},
+    {"PVPA5_proneStab", false, false},
+    {"PVPA5_jump", false, false},
+    {"PVPA5_die", false, false},
+    {"PVPA5_dummy", false, false},
+    {"PVPA5_attack", false, true},
+    {"PVPA5_attack2", false, true},
+    {"PVPA5_heaveyKick", false, true},
+    {"PVPA5_swingKick", false, true},
+    {"PVPA5_somerSault", false, true},
+    {"PVPA6_walk", false, false},
+    {"PVPA6_stand", false, false},
+    {"PVPA6_rope", false, false},
+    {"PVPA6_prone", false, false},
+    {"PVPA6_proneStab", false, false},
+    {"PVPA6_jump", false, false},
+    {"PVPA6_die", false, false},
+    {"PVPA6_dummy", false, false},
+    {"PVPA6_attack", false, true},
+    {"PVPA6_stabShot", false, true},
+    {"PVPA6_iceArrow", false, true},
+    {"PVPA6_focusShot", false, true},
+    {"PVPA7_walk", false, false},
+    {"PVPA7_stand", false, false},
+    {"PVPA7_rope", false, false},
+    {"PVPA7_prone", false, false},
+    {"PVPA7_proneStab", false, false},
+    {"PVPA7_jump", false, false},
+    {"PVPA7_die", false, false},
+    {"PVPA7_dummy", false, false},
+    {"PVPA7_attack", false, true},
+    {"PVPA7_attack1", false, true},
+    {"PVPA7_gangan", false, true},
+    {"PVPA7_teleport", false, true},
+    {"PVPA7_shield", false, true},
+    {"PVPA7_soulAttack", false, true},
+    {"PVPA8_walk", false, false},
+    {"PVPA8_stand", false, false},
+    {"PVPA8_rope", false, false},
+    {"PVPA8_prone", false, false},
+    {"PVPA8_proneStab", false, false},
+    {"PVPA8_jump", false, false},
+    {"PVPA8_die", false, false},
+    {"PVPA8_dummy", false, false},
+    {"PVPA8_attack", false, true},
+    {"PVPA8_attack1", false, true},
+    {"PVPA8_rolling", false, true},
+    {"PVPA8_absorb", false, true},
+    {"PVPA8_destroy", false, true},
+    {"wireShot", false, true},
+    {"SNW_swing", false, true},
+    {"reactor0", false, true},
+    {"dash", false, true},
+    {"FS_Guitar_Stand_M", false, false},
+    {"FS_Guitar_Stroke_M", false, false},
+    {"FS_Guitar_Stand_W", false, false},
+    {"FS_Guitar_Stroke_W", false, false},
+    {"mangchi", false, true},
+    {"OpenTheBox", false, true},
+    {"royalGuard", false, true},
+    {"royalGuardAttack", false, true},
+    {"shiningCross", false, true},
+    {"dead_riding", false, false},
+    {"KSPsychicAttack", false, true},
+    {"KSPsychicForce", false, true},
+    {"KSPsychicForceH", false, true},
+    {"KSPsychicGrab", false, true},
+    {"KSPsychicSmash", false, true},
+    {"KSPsychicShoot", false, true},
+    {"KSPsychicShield", false, true},
+    {"KSPsychicWar", false, true},
+    {"KSbackHome", false, true},
+    {"KSPsychickDrain", false, true},
+    {"KSMadCrash", false, true},
+    {"KSPurePower", false, true},
+    {"KSUltimateTrain", false, true},
+    {"KSPsychicGround", false, true},
+    {"KSStrengthofMental", false, true},
+    {"KSPsychicMove", false, true},
+    {"KSPsychoBrake", false, true},
+    {"KSSpiritPurge", false, true},
+    {"KSUltimateFist", false, true},
+    {"KSEverPsychic", false, true},
+    {"KSPsychoMetry", false, true},
+    {"KSPsychicOver", false, true},
+    {"KSDeepImpact", false, true},
+    {"KSDeepImpact1", false, true},
+    {"KSMaterial", false, true},
+    {"KSCrash", false, true},
+    {"slashStance_KR", false, true},
+    {"kenjiBatdo_KR", false, true},
+    {"kenjiSwing1_KR", false, true},
+    {"kenjiSwing2_KR", false, true},
+    {"kenjiSwing3_KR", false, true},
+    {"kenjikaze_KR", false, true},
+    {"kenjiRush_KR", false, true},
+    {"kenjiJumpAttack_KR", false, true},
+    {"kenjiAssualt_KR", false, true},
+    {"kenjiHighJump_KR", false, true},
+    {"kenjiRanMu_KR", false, true},
+    {"kenjirainKatana_KR", false, true},
+    {"kenjidashAttack1_KR", false, true},
+    {"kenjidashAttack2_KR", false, true},
+    {"kenjidashAttack3_KR", false, true},
+    {"kenjidashAttack4_KR", false, true},
+    {"kenjiitsen_KR", false, true},
+    {"kenjiDraw_KR", false, true},
+    {"kenjiHighJumpEnd_KR", false, true},
+    {"kenjiTornado_KR", false, true},
+    {"kenjiBlink_KR", false, false},
+    {"kenjiHiryuzan_KR", false, true},
+    {"kenjiHiryuzan2_KR", false, true},
+    {"kannaAlert3_KR", false, true},
+    {"kannaBlood_KR", false, true},
+    {"kannaDraw_KR", false, true},
+    {"kannaDraw2_KR", false, true},
+    {"kannaBind_KR", false, true},
+    {"kannaSoloAttack_KR", false, true},
+    {"kannaNineTale_KR", false, true},
+    {"kannaSummonGhost_KR", false, true},
+    {"kannaOniAttack_KR", false, true},
+    {"kannaSikikami_KR", false, true},
+    {"kannaSikikami2_KR", false, true},
+    {"kannaSikikami3_KR", false, true},
+    {"kannaSakura_KR", false, true},
+    {"kannaAssualt_KR", false, true},
+    {"kannaAlert_KR", false, true},
+    {"kannaDoubleDraw_KR", false, true},
+    {"kannaOrochi_KR", false, true},
+    {"kannaFoxHeal_KR", false, true},
+    {"kannaFoxFireBarrier_KR", false, true},
+    {"kannaFoxBless_KR", false, true},
+    {"kannaFoxGetsoku_KR", false, true},
+    {"kannaSummonKami_KR", false, true},
+    {"kannaSoloAttackPre_KR", false, true},
+    {"kannaSoloEnd_KR", false, true},
+    {"kannaHikami_KR", false, true},
+    {"AyameCombo1_KR", false, true},
+    {"AyameCombo2_KR", false, true},
+    {"AyameCombo3_KR", false, true},
+    {"AyameCombo4_KR", false, true},
+    {"AyamePiercingShoot_KR", false, true},
+    {"AyamePowerShoot_KR", false, true},
+    {"AyameDropShoot_KR", false, true},
+    {"AyameFlashJump_KR", false, true},
+    {"AyameFeverShoot_KR", false, true},
+    {"AyameFeverMode_KR", false, true},
+    {"EVhome", false, true},
+    {"EVcircleMana", false, true},
+    {"EVcircleMana2", false, true},
+    {"EVcircleMana3", false, true},
+    {"EVcircleMana4", false, true},
+    {"EVcircleWind", false, true},
+    {"EVcircleThunder", false, true},
+    {"EVcircleEarth", false, true},
+    {"EVbooster", false, true},
+    {"EVelemental", false, true},
+    {"EVmagicRemains", false, true},
+    {"EVbless", false, true},
+    {"EVdragonBack", false, true},
+    {"EVdragonMasterPrapare", false, true},
+    {"EVdragonMasterKeydown", false, true},
+    {"EVdragonMasterKeydowned", false, true},
+    {"EVcircleWindMix", false, true},
+    {"EVcircleThunderMix", false, true},
+    {"EVcircleEarthMix", false, true},
+    {"smashSwing", false, true},
+    {"smashSwing1", false, true},
+    {"smashSwing2", false, true},
+    {"aeroSwing", false, true},
+    {"smashWave", false, true},
+    {"comboJudgement_side", false, true},
+    {"gatheringCatcher", false, true},
+    {"boostEnd_sof", false, true},
+    {"boostEnd_sof0", false, true},
+    {"boostEnd_ht", false, true},
+    {"boostEnd_ht0", false, true},
+    {"boostEnd_htPrepare", false, true},
+    {"HY2112zoneOfMaha", false, true},
+    {"backtoRien", false, true},
+    {"finalBlowS", false, true},
+    {"RWgauntletPunch", false, true},
+    {"RWpileBunker", false, true},
+    {"RWexplosionJump", false, true},
+    {"RWexplosionJumpUp", false, true},
+    {"RWdoubleFang", false, true},
+    {"RWduckingDash", false, true},
+    {"RWduckingDashCh", false, true},
+    {"RWchoppingHammer", false, true},
+    {"RWchoppingHammerCh", false, true},
+    {"RWsway", false, true},
+    {"RWswayCh", false, true},
+    {"RWliftPress", false, true},
+    {"RWliftPressMagnum", false, true},
+    {"RWshockWavePunch", false, true},
+    {"RWswayBlow", false, true},
+    {"RWrollingHurricane", false, true},
+    {"RWrollingHurricanePre", false, true},
+    {"RWrollingHurricaneEnd", false, true},
+    {"RWpileBunkerBind", false, true},
+    {"RWpileBunkerBindEnd", false, true},
+    {"RWsuperHeal", false, true},
+    {"HY3712maximizeCanon", false, true},
+    {"HY3712hyperMagnumPre", false, true},
+    {"HY3712hyperMagnumPre2", false, true},
+    {"HY3712hyperMagnumPre3", false, true},
+    {"HY3712hyperMagnum", false, true},
+}};
+
+namespace detail
+{
+constexpr auto MakeActionNames() -> std::array<std::string_view, ACTIONDATA_COUNT>
+{
+    std::array<std::string_view, ACTIONDATA_COUNT> asName{};
+    for (std::size_t i = 0; i < ACTIONDATA_COUNT; ++i)
+        asName[i] = s_aActionSpec[i].sName;
+    return asName;
+}
+} // namespace detail
+
+/// Action name -> code, built by the compiler
+inline constexpr TStaticPerfectHash<ACTIONDATA_COUNT> s_actionNameHash{detail::MakeActionNames()};
+
+/// Matches get_action_code_from_name; -1 for unknown names
+constexpr auto get_action_code_from_name(std::string_view sName) noexcept -> std::int32_t
+{
+    return s_actionNameHash.Find(sName);
+}
+
+} // namespace ms
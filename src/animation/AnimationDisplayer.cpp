@@ -85,7 +85,16 @@ auto AnimationDisplayer::RegisterOneTimeAnimation(
     std::uint32_t dwOwner
 ) -> OneTimeInfo&
 {
-    m_lOneTime.emplace_back();
+    // Reuse a finished record's list node; every field is set below
+    if (m_lOneTimeFree.empty())
+    {
+        m_lOneTime.emplace_back();
+        ++m_nOneTimeAlloc;
+    }
+    else
+    {
+        m_lOneTime.splice(m_lOneTime.end(), m_lOneTimeFree, m_lOneTimeFree.begin());
+    }
     auto& info = m_lOneTime.back();
 
     info.pLayer = pLayer;
@@ -102,6 +111,7 @@ auto AnimationDisplayer::RegisterOneTimeAnimation(
     info.pRelOffsetParam = pRelOffsetParam;
     info.sSoundUOL = sSoundUOL;
     info.nAnimationType = 0;
+    info.movingInfo = {};
 
     // If there's a start delay, make layer transparent and mark waiting
     if (tDelayBeforeStart != 0)
@@ -221,8 +231,8 @@ void AnimationDisplayer::Effect_General(
     if (!pLayer)
         return;
 
-    // Start animation (GA_STOP = play once through and stop)
-    pLayer->Animate(Gr2DAnimationType::Stop);
+    // Play once through from the first frame; Update() retires it after
+    pLayer->Animate(Gr2DAnimationType::First);
 
     // Register as a one-time animation so Update() drives playback
     RegisterOneTimeAnimation(
@@ -230,6 +240,27 @@ void AnimationDisplayer::Effect_General(
         nullptr, {}, 0, 0);
 }
 
+void AnimationDisplayer::Effect_DamageNumber(
+    std::int32_t nValue,
+    DamageStyle eStyle,
+    Point2D pt,
+    std::int32_t tDelay)
+{
+    // Above the field, below the windows
+    constexpr std::int32_t DamageNumberZ = 100;
+
+    if (!m_pDamageNumber)
+    {
+        m_pDamageNumber = std::make_shared<DamageNumberRenderer>(DamageNumberZ);
+        m_pDamageNumber->LoadBasicEff();
+        get_gr().AddRenderSource(m_pDamageNumber);
+    }
+
+    const auto tCur = static_cast<std::int32_t>(
+        Application::GetInstance().GetUpdateTime());
+    m_pDamageNumber->Add(nValue, eStyle, pt.x, pt.y, tCur + tDelay);
+}
+
 // ========== AnimationDisplayer ==========
 
 void AnimationDisplayer::Update()
@@ -250,12 +281,60 @@ void AnimationDisplayer::Update()
             RemovePrepareAnimation(pInfo->dwCharacterID);
     }
 
+    UpdateOneTimeAnimation(tCur);
     NonFieldUpdate(tCur);
     UpdateMoveRandSprayEffect(tCur);
     UpdateUpDownEffect(tCur);
     UpdateDelaySetViewEffect();
 }
 
+void AnimationDisplayer::UpdateOneTimeAnimation(std::int32_t tCur)
+{
+    auto& gr = get_gr();
+
+    for (auto it = m_lOneTime.begin(); it != m_lOneTime.end(); )
+    {
+        auto& info = *it;
+
+        if (info.bWaiting)
+        {
+            // Delayed start: the layer stays transparent until its time
+            if (tCur - info.tDelayBeforeStart >= 0)
+            {
+                if (info.pLayer)
+                    info.pLayer->put_color(0xFFFFFFFF);
+                info.bWaiting = 0;
+            }
+            ++it;
+            continue;
+        }
+
+        if (info.pLayer && info.pLayer->IsAnimating())
+        {
+            if (info.pFlipOrigin)
+                info.pLayer->put_flip(info.pFlipOrigin->get_flip());
+            ++it;
+            continue;
+        }
+
+        // Finished: hand the layer and the record back for the next effect
+        if (info.nMovingType == 2 || info.nMovingType == 5)
+        {
+            auto itBlade = m_mBladeMovingEffect.find(info.dwOwner);
+            if (itBlade != m_mBladeMovingEffect.end() && itBlade->second == info.pLayer)
+                m_mBladeMovingEffect.erase(itBlade);
+        }
+        if (info.pLayer)
+            gr.RecycleLayer(std::move(info.pLayer));
+        info.pLayer.reset();
+        info.pFlipOrigin.reset();
+        info.pRelOffsetParam.reset();
+
+        auto itDone = it++;
+        m_lOneTimeFree.splice(m_lOneTimeFree.end(), m_lOneTime, itDone);
+    }
+}
+
 void AnimationDisplayer::UpdateWeaponHeadEffect(
     [[maybe_unused]] std::int32_t tCur)
 {
@@ -293,29 +372,98 @@ void AnimationDisplayer::RemovePrepareAnimation(
     });
 }
 
+// ========== Effect templates ==========
+
+auto AnimationDisplayer::LoadEffectTemplate(const std::shared_ptr<WzProperty>& prop)
+    -> std::shared_ptr<const EffectTemplate>
+{
+    if (!prop || !prop->HasChildren())
+        return nullptr;
+
+    auto pEffect = std::make_shared<EffectTemplate>();
+
+    // Frames come from the clip cache, so a property already playing
+    // somewhere shares its canvases with this template
+    pEffect->pClip = get_gr().GetClipCache().Get(prop);
+
+    if (auto zProp = prop->GetChild("z"))
+        pEffect->nZ = zProp->GetInt(0);
+    if (auto blendProp = prop->GetChild("blendMode"))
+        pEffect->nBlend = blendProp->GetInt(0);
+    if (auto a0Prop = prop->GetChild("a0"))
+        pEffect->nAlpha0 = a0Prop->GetInt(-1);
+
+    pEffect->canvasInfo.nZ = pEffect->nZ.value_or(0);
+    for (std::size_t i = 0;; ++i)
+    {
+        auto frameProp = prop->GetChild(std::to_string(i));
+        if (!frameProp)
+            break;
+        if (!frameProp->GetCanvas())
+            continue;
+
+        LoadCanvasInfo(frameProp, pEffect->canvasInfo.aInfo.emplace_back());
+    }
+
+    return pEffect;
+}
+
+auto AnimationDisplayer::GetEffectTemplate(const std::shared_ptr<WzProperty>& prop)
+    -> std::shared_ptr<const EffectTemplate>
+{
+    // Templates keep their canvases alive; a session that has cycled
+    // through this many distinct effects starts over rather than growing
+    constexpr std::size_t MaxEffectTemplates = 2048;
+
+    if (!prop)
+        return nullptr;
+
+    auto& mTemplate = GetInstance().m_mEffectTemplate;
+    if (auto it = mTemplate.find(prop.get());
+        it != mTemplate.end() && it->second.pSource.lock() == prop)
+    {
+        return it->second.pEffect;
+    }
+
+    if (mTemplate.size() >= MaxEffectTemplates)
+        mTemplate.clear();
+
+    auto pEffect = LoadEffectTemplate(prop);
+    mTemplate.insert_or_assign(prop.get(), EffectTemplateEntry{prop, pEffect});
+    return pEffect;
+}
+
+auto AnimationDisplayer::GetEffectTemplate(const std::string& sUOL)
+    -> std::shared_ptr<const EffectTemplate>
+{
+    return GetEffectTemplate(WzResMan::GetInstance().GetProperty(sUOL));
+}
+
+void AnimationDisplayer::ClearEffectTemplates()
+{
+    m_mEffectTemplate.clear();
+}
+
 // Overload 1: UOL string wrapper
 auto AnimationDisplayer::LoadLayer(
     const std::string& layerUOL,
     std::int32_t flip,
     Point2D origin,
     std::int32_t rx, std::int32_t ry,
-    std::shared_ptr<WzGr2DLayer> pOverlay,
+    [[maybe_unused]] std::shared_ptr<WzGr2DLayer> pOverlay,
     std::int32_t z,
     std::int32_t alpha,
-    std::int32_t magLevel,
+    [[maybe_unused]] std::int32_t magLevel,
     LayerCanvasInfo* pCanvasInfo,
-    std::int32_t nZoom0, std::int32_t nZoom1,
-    bool bPostRender
+    [[maybe_unused]] std::int32_t nZoom0, [[maybe_unused]] std::int32_t nZoom1,
+    [[maybe_unused]] bool bPostRender
 ) -> std::shared_ptr<WzGr2DLayer>
 {
-    auto& resMan = WzResMan::GetInstance();
-    auto prop = resMan.GetProperty(layerUOL);
-    if (!prop || !prop->HasChildren())
+    auto pEffect = GetEffectTemplate(layerUOL);
+    if (!pEffect)
         return nullptr;
 
-    return LoadLayer(prop, flip, origin, rx, ry,
-                     std::move(pOverlay), z, alpha, magLevel,
-                     pCanvasInfo, nZoom0, nZoom1, bPostRender);
+    return LoadLayer(*pEffect, flip, origin, rx, ry, z, alpha, pCanvasInfo);
 }
 
 // Overload 2: Property-based (from decompiled inner LoadLayer)
@@ -324,32 +472,47 @@ auto AnimationDisplayer::LoadLayer(
     std::int32_t flip,
     Point2D origin,
     std::int32_t rx, std::int32_t ry,
-    std::shared_ptr<WzGr2DLayer> pOverlay,
+    [[maybe_unused]] std::shared_ptr<WzGr2DLayer> pOverlay,
     std::int32_t z,
     std::int32_t alpha,
-    std::int32_t magLevel,
+    [[maybe_unused]] std::int32_t magLevel,
     LayerCanvasInfo* pCanvasInfo,
-    std::int32_t nZoom0, std::int32_t nZoom1,
+    [[maybe_unused]] std::int32_t nZoom0, [[maybe_unused]] std::int32_t nZoom1,
     [[maybe_unused]] bool bPostRender
 ) -> std::shared_ptr<WzGr2DLayer>
 {
-    (void)magLevel; // Caller-side concern, not applied to layer
+    auto pEffect = GetEffectTemplate(prop);
+    if (!pEffect)
+        return nullptr;
+
+    return LoadLayer(*pEffect, flip, origin, rx, ry, z, alpha, pCanvasInfo);
+}
 
+// Template instantiation: only per-spawn state is set here.
+// magLevel, overlay and zoom are caller-side concerns that the layer does
+// not support yet (WzGr2DLayer::InsertCanvas ignores zoom).
+auto AnimationDisplayer::LoadLayer(
+    const EffectTemplate& effect,
+    std::int32_t flip,
+    Point2D origin,
+    std::int32_t rx, std::int32_t ry,
+    std::int32_t z,
+    std::int32_t alpha,
+    LayerCanvasInfo* pCanvasInfo
+) -> std::shared_ptr<WzGr2DLayer>
+{
     auto& gr = get_gr();
-    auto layer = gr.CreateLayer(0, 0, 0, 0, 0);
+    auto layer = gr.CreateEffectLayer(0, 0, 0, 0, 0);
 
     // Set flip
     layer->put_flip(flip);
 
-    // Read "z" property to override z-order
-    if (auto zProp = prop->GetChild("z"))
-        layer->put_z(zProp->GetInt(z));
-    else
-        layer->put_z(z);
+    // "z" property overrides the requested z-order
+    layer->put_z(effect.nZ.value_or(z));
 
-    // Read "blendMode" property
-    if (auto blendProp = prop->GetChild("blendMode"))
-        layer->put_blend(blendProp->GetInt(0));
+    // "blendMode" property
+    if (effect.nBlend)
+        layer->put_blend(*effect.nBlend);
 
     // Set color with alpha
     layer->put_color((static_cast<std::uint32_t>(alpha) << 24) | 0x00FFFFFF);
@@ -362,39 +525,23 @@ auto AnimationDisplayer::LoadLayer(
     // Visibility
     layer->put_visible(true);
 
-    // Frame loop: iterate numbered children "0", "1", "2", ...
-    int i = 0;
-    while (auto frameProp = prop->GetChild(std::to_string(i)))
-    {
-        auto wzCanvas = frameProp->GetCanvas();
-        if (!wzCanvas)
-            break;
-        ++i;
-
-        LayerCanvasInfoSingle infoSingle;
-        LoadCanvas(layer, frameProp, pOverlay, nZoom0, nZoom1,
-                   pCanvasInfo ? &infoSingle : nullptr);
-
-        if (pCanvasInfo)
-            pCanvasInfo->aInfo.push_back(std::move(infoSingle));
-    }
+    // Frames: shared canvases, per-layer playback
+    layer->InsertClip(effect.pClip);
 
-    // Read "a0" property - alpha animation
-    if (auto a0Prop = prop->GetChild("a0"))
+    // "a0" property - alpha animation
+    if (effect.nAlpha0 && alpha == 255 && *effect.nAlpha0 >= 0)
     {
-        auto a0 = a0Prop->GetInt(-1);
-        if (alpha == 255 && a0 >= 0)
-        {
-            a0 = std::clamp(a0, 0, 255);
-            layer->get_alpha()->RelMove(a0, 255, 0, 0);
-        }
+        const auto a0 = std::clamp(*effect.nAlpha0, 0, 255);
+        layer->get_alpha()->RelMove(a0, 255, 0, 0);
     }
 
-    // Store z in canvas info
     if (pCanvasInfo)
     {
-        if (auto zProp = prop->GetChild("z"))
-            pCanvasInfo->nZ = zProp->GetInt(0);
+        pCanvasInfo->aInfo.insert(pCanvasInfo->aInfo.end(),
+                                  effect.canvasInfo.aInfo.begin(),
+                                  effect.canvasInfo.aInfo.end());
+        if (effect.nZ)
+            pCanvasInfo->nZ = *effect.nZ;
     }
 
     return layer;
@@ -458,105 +605,57 @@ auto AnimationDisplayer::InsertLayer(
         return pLayer;
     }
 
-    // Existing layer — append frames from prop's numbered children
-    int i = 0;
-    while (auto frameProp = prop->GetChild(std::to_string(i)))
-    {
-        auto wzCanvas = frameProp->GetCanvas();
-        if (!wzCanvas)
-            break;
-
-        // TODO: original calls IWzCanvas::put_mag(magLevel) when magLevel > 0
-        // WzGr2DCanvas does not yet support magnification
-
-        LoadCanvas(pLayer, frameProp, nullptr, 0, 0, nullptr);
-        ++i;
-    }
+    auto pEffect = GetEffectTemplate(prop);
+    if (!pEffect)
+        return nullptr;
 
+    // TODO: original calls IWzCanvas::put_mag(magLevel) when magLevel > 0
+    // WzGr2DCanvas does not yet support magnification
+    pLayer->InsertClip(pEffect->pClip);
     return pLayer;
 }
 
-// LoadCanvas helper (from decompiled CAnimationDisplayer::LoadCanvas)
-void AnimationDisplayer::LoadCanvas(
-    const std::shared_ptr<WzGr2DLayer>& layer,
+// LoadCanvasInfo helper (info half of decompiled CAnimationDisplayer::LoadCanvas;
+// the canvas itself comes from the effect's clip)
+void AnimationDisplayer::LoadCanvasInfo(
     const std::shared_ptr<WzProperty>& frameProp,
-    [[maybe_unused]] const std::shared_ptr<WzGr2DLayer>& overlay,
-    std::int32_t globalZoom0, std::int32_t globalZoom1,
-    LayerCanvasInfoSingle* pInfoSingle
+    LayerCanvasInfoSingle& infoSingle
 )
 {
-    // Read canvas from frameProp
-    auto wzCanvas = frameProp->GetCanvas();
-    auto canvas = std::make_shared<WzGr2DCanvas>(wzCanvas);
-
-    // Read origin
-    if (auto originProp = frameProp->GetChild("origin"))
-    {
-        auto vec = originProp->GetVector();
-        canvas->SetOrigin({vec.x, vec.y});
-    }
-
-    // Read per-frame properties
-    int delay = 100;
+    infoSingle.nDelay = 100;
     if (auto delayProp = frameProp->GetChild("delay"))
-        delay = delayProp->GetInt(100);
-
-    int a0 = 255;
-    int a1 = 255;
-    if (auto a0Prop = frameProp->GetChild("a0"))
-        a0 = std::clamp(a0Prop->GetInt(255), 0, 255);
-    if (auto a1Prop = frameProp->GetChild("a1"))
-        a1 = std::clamp(a1Prop->GetInt(255), 0, 255);
-
-    int z0 = globalZoom0;
-    int z1 = globalZoom1;
-    if (auto z0Prop = frameProp->GetChild("z0"))
-        z0 = z0Prop->GetInt(globalZoom0);
-    if (auto z1Prop = frameProp->GetChild("z1"))
-        z1 = z1Prop->GetInt(globalZoom1);
-
-    // Insert canvas into layer with per-frame params
-    layer->InsertCanvas(canvas, delay,
-                        static_cast<std::uint8_t>(a0),
-                        static_cast<std::uint8_t>(a1),
-                        z0, z1);
-
-    // Fill pInfoSingle if requested
-    if (pInfoSingle)
-    {
-        pInfoSingle->nDelay = delay;
-        pInfoSingle->bView = true;
+        infoSingle.nDelay = delayProp->GetInt(100);
+    infoSingle.bView = true;
 
-        // Read headCount for multi-head direction info
-        if (auto headProp = frameProp->GetChild("headCount"))
+    // Read headCount for multi-head direction info
+    if (auto headProp = frameProp->GetChild("headCount"))
+    {
+        int headCount = headProp->GetInt(0);
+        for (int h = 0; h < headCount; ++h)
         {
-            int headCount = headProp->GetInt(0);
-            for (int h = 0; h < headCount; ++h)
+            std::string frontKey = headCount == 1
+                ? "front"
+                : "front" + std::to_string(h);
+            std::string rearKey = headCount == 1
+                ? "rear"
+                : "rear" + std::to_string(h);
+
+            auto frontProp = frameProp->GetChild(frontKey);
+            auto rearProp = frameProp->GetChild(rearKey);
+
+            Point2D front{};
+            Point2D rear{};
+            if (frontProp)
+            {
+                auto v = frontProp->GetVector();
+                front = {v.x, v.y};
+            }
+            if (rearProp)
             {
-                std::string frontKey = headCount == 1
-                    ? "front"
-                    : "front" + std::to_string(h);
-                std::string rearKey = headCount == 1
-                    ? "rear"
-                    : "rear" + std::to_string(h);
-
-                auto frontProp = frameProp->GetChild(frontKey);
-                auto rearProp = frameProp->GetChild(rearKey);
-
-                Point2D front{};
-                Point2D rear{};
-                if (frontProp)
-                {
-                    auto v = frontProp->GetVector();
-                    front = {v.x, v.y};
-                }
-                if (rearProp)
-                {
-                    auto v = rearProp->GetVector();
-                    rear = {v.x, v.y};
-                }
-                pInfoSingle->aptDir.emplace_back(front, rear);
+                auto v = rearProp->GetVector();
+                rear = {v.x, v.y};
             }
+            infoSingle.aptDir.emplace_back(front, rear);
         }
     }
 }
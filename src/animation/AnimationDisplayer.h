@@ -1,15 +1,19 @@
 #pragma once
 
+#include "animation/DamageNumberRenderer.h"
 #include "app/IGObj.h"
 #include "graphics/WzGr2DTypes.h"
 #include "util/Point.h"
 #include "util/Singleton.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ms
@@ -17,6 +21,7 @@ namespace ms
 
 class Gr2DVector;
 class WzCanvas;
+class WzGr2DAnimationClip;
 class WzGr2DLayer;
 class WzProperty;
 
@@ -408,6 +413,16 @@ public:
         std::int32_t z,
         std::int32_t nMagLevel);
 
+    /**
+     * @brief Show a floating damage number with its bottom centre at pt (world)
+     * @param tDelay ms until it appears; multi-hit lines are staggered this way
+     *
+     * Numbers are drawn by a DamageNumberRenderer from one glyph atlas,
+     * loaded from Effect/BasicEff.img on first use.
+     */
+    void Effect_DamageNumber(std::int32_t nValue, DamageStyle eStyle,
+                             Point2D pt, std::int32_t tDelay = 0);
+
     // ========== IGObj ==========
 
     void Update() override;
@@ -427,6 +442,37 @@ public:
         std::vector<LayerCanvasInfoSingle> aInfo;
     };
 
+    /**
+     * @brief Everything LoadLayer reads from an effect property, parsed once
+     *
+     * Spawning from a template only sets up the layer's playback state;
+     * the frames come from the shared clip and nothing walks the property
+     * tree again.
+     */
+    struct EffectTemplate
+    {
+        std::shared_ptr<const WzGr2DAnimationClip> pClip;
+        std::optional<std::int32_t> nZ;      ///< "z"
+        std::optional<std::int32_t> nBlend;  ///< "blendMode"
+        std::optional<std::int32_t> nAlpha0; ///< "a0", layer fade-in start
+        LayerCanvasInfo canvasInfo;          ///< Per-frame delay and head directions
+    };
+
+    /// Parse an effect property; null if it has no children
+    [[nodiscard]] static auto LoadEffectTemplate(const std::shared_ptr<WzProperty>& prop)
+        -> std::shared_ptr<const EffectTemplate>;
+
+    /// Template for an effect property, parsed on first use and cached, misses included
+    [[nodiscard]] static auto GetEffectTemplate(const std::shared_ptr<WzProperty>& prop)
+        -> std::shared_ptr<const EffectTemplate>;
+
+    /// Template for the property an effect UOL resolves to
+    [[nodiscard]] static auto GetEffectTemplate(const std::string& sUOL)
+        -> std::shared_ptr<const EffectTemplate>;
+
+    /// Drop cached templates, e.g. after the WZ data was reloaded
+    void ClearEffectTemplates();
+
     /// Overload 1: UOL string path - resolves property, delegates to overload 2
     static auto LoadLayer(
         const std::string& layerUOL,
@@ -500,7 +546,12 @@ public:
         std::uint32_t dwOwner
     ) -> OneTimeInfo&;
 
+    [[nodiscard]] auto GetOneTimeCount() const noexcept -> std::size_t { return m_lOneTime.size(); }
+    /// OneTimeInfo records created because none was free to reuse
+    [[nodiscard]] auto GetOneTimeAllocCount() const noexcept -> std::uint64_t { return m_nOneTimeAlloc; }
+
 private:
+    void UpdateOneTimeAnimation(std::int32_t tCur);
     void UpdateWeaponHeadEffect(std::int32_t tCur);
     void NonFieldUpdate(std::int32_t tCur);
     void UpdateMoveRandSprayEffect(std::int32_t tCur);
@@ -508,13 +559,21 @@ private:
     void UpdateDelaySetViewEffect();
     void RemovePrepareAnimation(std::uint32_t dwCharacterID);
 
-    /// Insert a single canvas frame into a layer (from decompiled LoadCanvas)
-    static void LoadCanvas(
-        const std::shared_ptr<WzGr2DLayer>& layer,
+    /// Set up a layer from a parsed effect (the body of the decompiled LoadLayer)
+    static auto LoadLayer(
+        const EffectTemplate& effect,
+        std::int32_t flip,
+        Point2D origin,
+        std::int32_t rx, std::int32_t ry,
+        std::int32_t z,
+        std::int32_t alpha,
+        LayerCanvasInfo* pCanvasInfo
+    ) -> std::shared_ptr<WzGr2DLayer>;
+
+    /// Per-frame info of one frame (the info half of the decompiled LoadCanvas)
+    static void LoadCanvasInfo(
         const std::shared_ptr<WzProperty>& frameProp,
-        const std::shared_ptr<WzGr2DLayer>& overlay,
-        std::int32_t globalZoom0, std::int32_t globalZoom1,
-        LayerCanvasInfoSingle* pInfoSingle
+        LayerCanvasInfoSingle& infoSingle
     );
 
     // ========== Members ==========
@@ -522,7 +581,18 @@ private:
     TrembleCtx m_tremble;
     std::list<std::shared_ptr<PrepareInfo>> m_lPrepare;
     std::list<OneTimeInfo> m_lOneTime;
+    std::list<OneTimeInfo> m_lOneTimeFree; ///< Finished records, spliced back in by RegisterOneTimeAnimation
+    std::uint64_t m_nOneTimeAlloc{0};
     std::map<std::uint32_t, std::shared_ptr<WzGr2DLayer>> m_mBladeMovingEffect;
+
+    /// Source held weakly: a property reloaded at a recycled address is not the old one
+    struct EffectTemplateEntry
+    {
+        std::weak_ptr<WzProperty> pSource;
+        std::shared_ptr<const EffectTemplate> pEffect;
+    };
+    std::unordered_map<const WzProperty*, EffectTemplateEntry> m_mEffectTemplate;
+    std::shared_ptr<DamageNumberRenderer> m_pDamageNumber;
 };
 
 } // namespace ms
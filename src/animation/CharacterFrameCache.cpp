@@ -0,0 +1,344 @@
+#include "CharacterFrameCache.h"
+#include "CharacterActionFrameEntry.h"
+#include "SpriteInstance.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "util/Point.h"
+#include "wz/WzCanvas.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace ms
+{
+
+namespace
+{
+
+constexpr std::uint64_t FnvOffset = 14695981039346656037ull;
+constexpr std::uint64_t FnvPrime = 1099511628211ull;
+
+void HashMix(std::uint64_t& h, std::uint32_t value) noexcept
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        h ^= (value >> (i * 8)) & 0xFFu;
+        h *= FnvPrime;
+    }
+}
+
+/// Pixels a sprite contributes, or null when it has nothing to draw
+auto GetSpritePixels(const SpriteInstance& sprite) -> const WzCanvas*
+{
+    if (!sprite.m_bVisible || !sprite.m_pSource || !sprite.m_pSource->m_pSprite)
+        return nullptr;
+
+    const auto& pCanvas = sprite.m_pSource->m_pSprite->GetCanvas();
+    if (!pCanvas || pCanvas->GetWidth() <= 0 || pCanvas->GetHeight() <= 0)
+        return nullptr;
+
+    const auto nNeed = static_cast<std::size_t>(pCanvas->GetWidth())
+                     * static_cast<std::size_t>(pCanvas->GetHeight()) * 4;
+    if (pCanvas->GetPixelData().size() < nNeed)
+        return nullptr;
+
+    return pCanvas.get();
+}
+
+/// Source-over of one RGBA32 pixel, same arithmetic as ActionMan's face blit
+inline void BlendPixel(std::uint8_t* pDst, const std::uint8_t* pSrc) noexcept
+{
+    const std::uint32_t sa = pSrc[3];
+    if (sa == 0)
+        return;
+    if (sa == 255 || pDst[3] == 0)
+    {
+        std::memcpy(pDst, pSrc, 4);
+        return;
+    }
+
+    const std::uint32_t dw = pDst[3] * (255 - sa) / 255;
+    const std::uint32_t outA = sa + dw;
+    for (int c = 0; c < 3; ++c)
+        pDst[c] = static_cast<std::uint8_t>((pSrc[c] * sa + pDst[c] * pDst[3] * (255 - sa) / 255) / outA);
+    pDst[3] = static_cast<std::uint8_t>(outA);
+}
+
+/**
+ * Flatten sprites [first, last) into one canvas. Returns null when none of
+ * them has pixels.
+ */
+auto Flatten(const std::vector<std::shared_ptr<SpriteInstance>>& aSprite,
+             std::size_t first, std::size_t last) -> std::shared_ptr<WzGr2DCanvas>
+{
+    Rect rc;
+    bool bAny = false;
+    for (auto i = first; i < last; ++i)
+    {
+        const auto* pPixels = GetSpritePixels(*aSprite[i]);
+        if (!pPixels)
+            continue;
+
+        const auto& pt = aSprite[i]->m_pt;
+        const Rect rcSprite = Rect::FromXYWH(pt.x, pt.y, pPixels->GetWidth(), pPixels->GetHeight());
+        if (!bAny)
+        {
+            rc = rcSprite;
+            bAny = true;
+            continue;
+        }
+        rc.left = std::min(rc.left, rcSprite.left);
+        rc.top = std::min(rc.top, rcSprite.top);
+        rc.right = std::max(rc.right, rcSprite.right);
+        rc.bottom = std::max(rc.bottom, rcSprite.bottom);
+    }
+
+    if (!bAny)
+        return nullptr;
+
+    const auto nStride = static_cast<std::size_t>(rc.Width()) * 4;
+    std::vector<std::uint8_t> aPixel(nStride * static_cast<std::size_t>(rc.Height()), 0);
+
+    for (auto i = first; i < last; ++i)
+    {
+        const auto* pPixels = GetSpritePixels(*aSprite[i]);
+        if (!pPixels)
+            continue;
+
+        const auto& aSrc = pPixels->GetPixelData();
+        const auto nSrcStride = static_cast<std::size_t>(pPixels->GetWidth()) * 4;
+        const auto x0 = static_cast<std::size_t>(aSprite[i]->m_pt.x - rc.left);
+        const auto y0 = static_cast<std::size_t>(aSprite[i]->m_pt.y - rc.top);
+
+        for (std::size_t y = 0; y < static_cast<std::size_t>(pPixels->GetHeight()); ++y)
+        {
+            auto* pDst = aPixel.data() + (y0 + y) * nStride + x0 * 4;
+            const auto* pSrc = aSrc.data() + y * nSrcStride;
+            for (std::size_t x = 0; x < nSrcStride; x += 4)
+                BlendPixel(pDst + x, pSrc + x);
+        }
+    }
+
+    auto pResult = std::make_shared<WzGr2DCanvas>(
+        std::make_shared<WzCanvas>(rc.Width(), rc.Height(), std::move(aPixel)));
+    pResult->SetOrigin({-rc.left, -rc.top});
+    return pResult;
+}
+
+auto CanvasBytes(const std::shared_ptr<WzGr2DCanvas>& pCanvas) -> std::size_t
+{
+    if (!pCanvas)
+        return 0;
+    return static_cast<std::size_t>(pCanvas->GetWidth())
+         * static_cast<std::size_t>(pCanvas->GetHeight()) * 4;
+}
+
+} // namespace
+
+// === CharacterLook ===
+
+void CharacterLook::Seal() noexcept
+{
+    auto h = FnvOffset;
+    HashMix(h, static_cast<std::uint32_t>(nSkin));
+    HashMix(h, static_cast<std::uint32_t>(nJob));
+    for (auto nItemID : aEquip)
+        HashMix(h, static_cast<std::uint32_t>(nItemID));
+    HashMix(h, static_cast<std::uint32_t>(nWeaponStickerID));
+    HashMix(h, static_cast<std::uint32_t>(nVehicleID));
+    HashMix(h, static_cast<std::uint32_t>(nGhostIndex));
+    HashMix(h, static_cast<std::uint32_t>(nGatherToolID));
+    HashMix(h, static_cast<std::uint32_t>(nLarknessState));
+    HashMix(h, static_cast<std::uint32_t>(nMixedHairID));
+    HashMix(h, static_cast<std::uint32_t>(nMixPercent));
+    HashMix(h, (bDrawElfEar ? 1u : 0u) | (bCashCape ? 2u : 0u)
+             | (bZigZag ? 4u : 0u) | (bRemoveBody ? 8u : 0u));
+    uHash = h;
+}
+
+auto CharacterLook::operator==(const CharacterLook& other) const noexcept -> bool
+{
+    return uHash == other.uHash
+        && nSkin == other.nSkin
+        && nJob == other.nJob
+        && std::equal(std::begin(aEquip), std::end(aEquip), std::begin(other.aEquip))
+        && nWeaponStickerID == other.nWeaponStickerID
+        && nVehicleID == other.nVehicleID
+        && nGhostIndex == other.nGhostIndex
+        && nGatherToolID == other.nGatherToolID
+        && nLarknessState == other.nLarknessState
+        && nMixedHairID == other.nMixedHairID
+        && nMixPercent == other.nMixPercent
+        && bDrawElfEar == other.bDrawElfEar
+        && bCashCape == other.bCashCape
+        && bZigZag == other.bZigZag
+        && bRemoveBody == other.bRemoveBody;
+}
+
+// === CharacterFrameCache ===
+
+auto CharacterFrameCache::KeyHash::operator()(const Key& key) const noexcept -> std::size_t
+{
+    auto h = key.look.uHash;
+    HashMix(h, static_cast<std::uint32_t>(key.nAction));
+    HashMix(h, static_cast<std::uint32_t>(key.nFrame));
+    return static_cast<std::size_t>(h);
+}
+
+void CharacterFrameCache::Composite(const std::vector<std::shared_ptr<SpriteInstance>>& aSprite,
+                                    std::int32_t nFaceZ,
+                                    CharacterActionFrameEntry& entry)
+{
+    // Sprites are sorted by z: everything before the first one at or above
+    // the face goes under it
+    std::size_t nSplit = 0;
+    while (nSplit < aSprite.size()
+        && (!aSprite[nSplit] || !aSprite[nSplit]->m_pSource
+            || aSprite[nSplit]->m_pSource->m_z < nFaceZ))
+    {
+        ++nSplit;
+    }
+
+    entry.pCanvasUnderFace = Flatten(aSprite, 0, nSplit);
+    entry.pCanvasOverFace = Flatten(aSprite, nSplit, aSprite.size());
+
+    if (entry.pCanvasUnderFace)
+        entry.pCanvasUnderFace->SetDelay(entry.tDelay);
+    if (entry.pCanvasOverFace)
+        entry.pCanvasOverFace->SetDelay(entry.tDelay);
+}
+
+auto CharacterFrameCache::FindAction(const CharacterLook& look, std::int32_t nAction,
+                                     std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE) -> bool
+{
+    std::lock_guard lock(m_lock);
+
+    Key key{look, nAction, 0};
+    auto it = m_mNode.find(key);
+    if (it == m_mNode.end())
+    {
+        ++m_nMiss;
+        return false;
+    }
+
+    const auto nFrameCount = it->second->nFrameCount;
+    std::vector<NodeIter> aNode;
+    aNode.reserve(static_cast<std::size_t>(nFrameCount));
+    aNode.push_back(it->second);
+
+    for (std::int32_t i = 1; i < nFrameCount; ++i)
+    {
+        key.nFrame = i;
+        auto itFrame = m_mNode.find(key);
+        if (itFrame == m_mNode.end())
+        {
+            ++m_nMiss;
+            return false;
+        }
+        aNode.push_back(itFrame->second);
+    }
+
+    apFE.clear();
+    apFE.reserve(aNode.size());
+    for (auto itNode : aNode)
+    {
+        m_lNode.splice(m_lNode.begin(), m_lNode, itNode);
+        apFE.push_back(itNode->pEntry);
+    }
+
+    ++m_nHit;
+    return true;
+}
+
+void CharacterFrameCache::InsertAction(const CharacterLook& look, std::int32_t nAction,
+                                       const std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE)
+{
+    std::lock_guard lock(m_lock);
+
+    const auto nFrameCount = static_cast<std::int32_t>(apFE.size());
+    for (std::int32_t i = 0; i < nFrameCount; ++i)
+    {
+        const auto& pEntry = apFE[static_cast<std::size_t>(i)];
+        if (!pEntry)
+            continue;
+
+        Key key{look, nAction, i};
+        const auto uBytes = CanvasBytes(pEntry->pCanvasUnderFace) + CanvasBytes(pEntry->pCanvasOverFace);
+
+        if (auto it = m_mNode.find(key); it != m_mNode.end())
+        {
+            m_uBytes -= it->second->uBytes;
+            it->second->pEntry = pEntry;
+            it->second->uBytes = uBytes;
+            it->second->nFrameCount = nFrameCount;
+            m_lNode.splice(m_lNode.begin(), m_lNode, it->second);
+        }
+        else
+        {
+            m_lNode.push_front(Node{key, pEntry, uBytes, nFrameCount});
+            m_mNode.emplace(std::move(key), m_lNode.begin());
+        }
+        m_uBytes += uBytes;
+    }
+
+    Evict();
+}
+
+void CharacterFrameCache::Evict()
+{
+    // Keep at least the most recent frame so an oversized action still hits
+    while (m_uBytes > m_uBudget && m_lNode.size() > 1)
+    {
+        auto& node = m_lNode.back();
+        m_uBytes -= node.uBytes;
+        m_mNode.erase(node.key);
+        m_lNode.pop_back();
+    }
+}
+
+void CharacterFrameCache::Clear()
+{
+    std::lock_guard lock(m_lock);
+    m_mNode.clear();
+    m_lNode.clear();
+    m_uBytes = 0;
+}
+
+void CharacterFrameCache::SetBudget(std::size_t uBytes)
+{
+    std::lock_guard lock(m_lock);
+    m_uBudget = uBytes;
+    Evict();
+}
+
+auto CharacterFrameCache::GetBudget() const -> std::size_t
+{
+    std::lock_guard lock(m_lock);
+    return m_uBudget;
+}
+
+auto CharacterFrameCache::GetFrameCount() const -> std::size_t
+{
+    std::lock_guard lock(m_lock);
+    return m_lNode.size();
+}
+
+auto CharacterFrameCache::GetByteSize() const -> std::size_t
+{
+    std::lock_guard lock(m_lock);
+    return m_uBytes;
+}
+
+auto CharacterFrameCache::GetHitCount() const -> std::size_t
+{
+    std::lock_guard lock(m_lock);
+    return m_nHit;
+}
+
+auto CharacterFrameCache::GetMissCount() const -> std::size_t
+{
+    std::lock_guard lock(m_lock);
+    return m_nMiss;
+}
+
+} // namespace ms
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ms
+{
+
+class SpriteInstance;
+struct CharacterActionFrameEntry;
+
+/**
+ * @brief Everything LoadCharacterAction's output depends on, after the
+ *        equipment array has been normalised
+ *
+ * Two characters with equal looks produce identical frames, so the look is
+ * what the frame cache is keyed on. The hash is computed once by Seal().
+ */
+struct CharacterLook
+{
+    std::int32_t nSkin{0};
+    std::int32_t nJob{0};
+    std::int32_t aEquip[32]{};
+    std::int32_t nWeaponStickerID{0};
+    std::int32_t nVehicleID{0};
+    std::int32_t nGhostIndex{0};
+    std::int32_t nGatherToolID{0};
+    std::int32_t nLarknessState{0};
+    std::int32_t nMixedHairID{0};
+    std::int32_t nMixPercent{0};
+    bool bDrawElfEar{false};
+    bool bCashCape{false};
+    bool bZigZag{false};
+    bool bRemoveBody{false};
+
+    std::uint64_t uHash{0};
+
+    /// Compute uHash from the fields above; call after the last change
+    void Seal() noexcept;
+
+    [[nodiscard]] auto operator==(const CharacterLook& other) const noexcept -> bool;
+};
+
+/**
+ * @brief Flattened character frames shared by every avatar with the same look
+ *
+ * MergeCharacterSprite composites the part sprites of a frame (body, head,
+ * hair, equips...) into one canvas below the face z and one above it, so an
+ * avatar draws two quads per frame instead of a dozen. The result only
+ * depends on (look, action, frame), so it is cached here and handed out to
+ * every user wearing the same look.
+ *
+ * Entries are evicted least-recently-used once the composited pixels exceed
+ * the byte budget. Eviction only drops the cache's reference; avatars that
+ * still hold a frame keep it alive. Thread-safe.
+ */
+class CharacterFrameCache
+{
+public:
+    /// Default budget for composited pixels (bytes)
+    static constexpr std::size_t DefaultBudget = 64u * 1024u * 1024u;
+
+    CharacterFrameCache() = default;
+
+    CharacterFrameCache(const CharacterFrameCache&) = delete;
+    auto operator=(const CharacterFrameCache&) -> CharacterFrameCache& = delete;
+
+    /**
+     * @brief Composite visible sprites into entry.pCanvasUnderFace/OverFace
+     *
+     * aSprite is in ascending z order with positions relative to the frame
+     * origin (as ActionFrame keeps them). Sprites below nFaceZ go to the
+     * under-face canvas, the rest to the over-face canvas; either stays null
+     * when it would be empty. Each canvas is cropped to its sprites and its
+     * origin is the frame origin, so anchors need no adjustment.
+     */
+    static void Composite(const std::vector<std::shared_ptr<SpriteInstance>>& aSprite,
+                          std::int32_t nFaceZ,
+                          CharacterActionFrameEntry& entry);
+
+    /**
+     * @brief Fetch all frames of an action
+     * @return false (apFE untouched) unless every frame is cached
+     */
+    auto FindAction(const CharacterLook& look, std::int32_t nAction,
+                    std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE) -> bool;
+
+    /// Store all frames of an action, evicting old frames past the budget
+    void InsertAction(const CharacterLook& look, std::int32_t nAction,
+                      const std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE);
+
+    void Clear();
+
+    void SetBudget(std::size_t uBytes);
+
+    [[nodiscard]] auto GetBudget() const -> std::size_t;
+    [[nodiscard]] auto GetFrameCount() const -> std::size_t;
+    [[nodiscard]] auto GetByteSize() const -> std::size_t;
+    [[nodiscard]] auto GetHitCount() const -> std::size_t;
+    [[nodiscard]] auto GetMissCount() const -> std::size_t;
+
+private:
+    struct Key
+    {
+        CharacterLook look;
+        std::int32_t nAction{0};
+        std::int32_t nFrame{0};
+
+        [[nodiscard]] auto operator==(const Key& other) const noexcept -> bool
+        {
+            return nAction == other.nAction && nFrame == other.nFrame && look == other.look;
+        }
+    };
+
+    struct KeyHash
+    {
+        [[nodiscard]] auto operator()(const Key& key) const noexcept -> std::size_t;
+    };
+
+    struct Node
+    {
+        Key key;
+        std::shared_ptr<CharacterActionFrameEntry> pEntry;
+        std::size_t uBytes{0};
+        std::int32_t nFrameCount{0};    // Frames in the whole action
+    };
+
+    using NodeIter = std::list<Node>::iterator;
+
+    void Evict();
+
+    mutable std::mutex m_lock;
+
+    // Most recently used at the front
+    std::list<Node> m_lNode;
+    std::unordered_map<Key, NodeIter, KeyHash> m_mNode;
+
+    std::size_t m_uBudget{DefaultBudget};
+    std::size_t m_uBytes{0};
+    std::size_t m_nHit{0};
+    std::size_t m_nMiss{0};
+};
+
+} // namespace ms
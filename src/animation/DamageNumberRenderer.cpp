@@ -0,0 +1,214 @@
+#include "DamageNumberRenderer.h"
+
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "util/Logger.h"
+#include "wz/WzProperty.h"
+#include "wz/WzResMan.h"
+
+#include <algorithm>
+#include <string>
+
+namespace ms
+{
+
+namespace
+{
+
+/// Queue a glyph from a canvas child of prop; -1 if there is none
+auto AddGlyph(WzGr2DGlyphAtlas& atlas, const std::shared_ptr<WzProperty>& prop,
+              const std::string& sName) -> std::int16_t
+{
+    if (!prop)
+        return -1;
+
+    auto pChild = prop->GetChild(sName);
+    if (!pChild)
+        return -1;
+
+    Point2D origin{};
+    if (auto originProp = pChild->GetChild("origin"))
+    {
+        auto vec = originProp->GetVector();
+        origin = {vec.x, vec.y};
+    }
+    return static_cast<std::int16_t>(atlas.Add(pChild->GetCanvas(), origin));
+}
+
+} // anonymous namespace
+
+void DamageNumberRenderer::LoadStyle(DamageStyle eStyle,
+                                     const std::shared_ptr<WzProperty>& pSmall,
+                                     const std::shared_ptr<WzProperty>& pLarge)
+{
+    auto& style = m_aStyle[static_cast<std::size_t>(eStyle)];
+    for (std::size_t d = 0; d < 10; ++d)
+    {
+        style.anSmall[d] = AddGlyph(m_atlas, pSmall, std::to_string(d));
+        style.anLarge[d] = AddGlyph(m_atlas, pLarge, std::to_string(d));
+    }
+    style.nMiss = AddGlyph(m_atlas, pSmall, "Miss");
+    style.nEffect = AddGlyph(m_atlas, pLarge, "effect");
+    style.bWarnedMissing = false;
+}
+
+void DamageNumberRenderer::LoadBasicEff()
+{
+    static constexpr std::array<const char*, static_cast<std::size_t>(DamageStyle::Count)> asSet{
+        "NoRed", "NoCri", "NoViolet", "NoBlue"};
+
+    auto& resMan = WzResMan::GetInstance();
+    m_atlas.Clear();
+    for (std::size_t i = 0; i < asSet.size(); ++i)
+    {
+        const std::string sPath = std::string("Effect/BasicEff.img/") + asSet[i];
+        LoadStyle(static_cast<DamageStyle>(i),
+                  resMan.GetProperty(sPath + "0"),
+                  resMan.GetProperty(sPath + "1"));
+    }
+    Build();
+}
+
+void DamageNumberRenderer::Build()
+{
+    m_atlas.Build();
+}
+
+void DamageNumberRenderer::Add(std::int32_t nValue, DamageStyle eStyle,
+                               std::int32_t x, std::int32_t y, std::int32_t tSpawn)
+{
+    m_aNumber.push_back({nValue, tSpawn, x, y, eStyle});
+}
+
+auto DamageNumberRenderer::GetRise(std::int32_t nAge) noexcept -> float
+{
+    const auto t = std::clamp(static_cast<float>(nAge) / static_cast<float>(Lifetime), 0.0F, 1.0F);
+    return static_cast<float>(RiseDistance) * (1.0F - (1.0F - t) * (1.0F - t));
+}
+
+auto DamageNumberRenderer::GetAlpha(std::int32_t nAge) noexcept -> std::uint8_t
+{
+    if (nAge <= FadeStart)
+        return 255;
+    if (nAge >= Lifetime)
+        return 0;
+    return static_cast<std::uint8_t>(255 * (Lifetime - nAge) / (Lifetime - FadeStart));
+}
+
+void DamageNumberRenderer::AppendGlyph(WzGr2DRenderList& list, SDL_Texture* texture,
+                                       std::int16_t nGlyph, float x, float baseY,
+                                       std::uint32_t color) const
+{
+    const auto& glyph = m_atlas.GetGlyph(static_cast<std::size_t>(nGlyph));
+    const RenderBounds bounds{x, baseY - static_cast<float>(glyph.origin.y),
+                              glyph.source.w, glyph.source.h};
+    list.AppendRegion(m_nZ, bounds, texture, glyph.source,
+                      static_cast<float>(m_atlas.GetWidth()), static_cast<float>(m_atlas.GetHeight()),
+                      color, 0);
+}
+
+auto DamageNumberRenderer::AppendGlyphs(WzGr2DRenderList& list, SDL_Texture* texture,
+                                        std::int32_t tCur,
+                                        std::int32_t offsetX, std::int32_t offsetY) -> std::size_t
+{
+    std::erase_if(m_aNumber, [tCur](const Number& n) { return tCur - n.tSpawn >= Lifetime; });
+
+    const auto nBefore = list.GetCount();
+    for (const auto& number : m_aNumber)
+    {
+        const auto nAge = tCur - number.tSpawn;
+        if (nAge < 0)
+            continue;
+
+        auto& style = m_aStyle[static_cast<std::size_t>(number.eStyle)];
+        const auto color = (static_cast<std::uint32_t>(GetAlpha(nAge)) << 24) | 0x00FFFFFF;
+        const auto cx = static_cast<float>(number.x + offsetX);
+        const auto baseY = static_cast<float>(number.y + offsetY) - GetRise(nAge);
+
+        if (number.nValue <= 0)
+        {
+            if (style.nMiss >= 0)
+            {
+                const auto w = m_atlas.GetGlyph(static_cast<std::size_t>(style.nMiss)).source.w;
+                AppendGlyph(list, texture, style.nMiss, cx - w * 0.5F, baseY, color);
+            }
+            continue;
+        }
+
+        // Digits most significant first; the leading one from the large set
+        std::array<std::size_t, 10> anDigit{};
+        std::size_t nDigit = 0;
+        for (auto v = number.nValue; v > 0; v /= 10)
+            anDigit[nDigit++] = static_cast<std::size_t>(v % 10);
+        std::reverse(anDigit.begin(), anDigit.begin() + static_cast<std::ptrdiff_t>(nDigit));
+
+        std::array<std::int16_t, 10> anGlyph{};
+        for (std::size_t k = 0; k < nDigit; ++k)
+            anGlyph[k] = style.anSmall[anDigit[k]];
+        if (style.anLarge[anDigit[0]] >= 0)
+            anGlyph[0] = style.anLarge[anDigit[0]];
+
+        float fWidth = 0.0F;
+        bool bComplete = true;
+        for (std::size_t k = 0; k < nDigit; ++k)
+        {
+            bComplete = bComplete && anGlyph[k] >= 0;
+            if (anGlyph[k] >= 0)
+                fWidth += m_atlas.GetGlyph(static_cast<std::size_t>(anGlyph[k])).source.w;
+        }
+        if (!bComplete)
+        {
+            // Once per style, so missing WZ digits don't flood the log
+            if (!style.bWarnedMissing)
+            {
+                LOG_WARN("DamageNumberRenderer: style {} lacks a digit of {}; such numbers are not drawn",
+                         static_cast<std::int32_t>(number.eStyle), number.nValue);
+                style.bWarnedMissing = true;
+            }
+            continue;
+        }
+
+        auto x = cx - fWidth * 0.5F;
+
+        // Critical burst behind the leading digit
+        if (style.nEffect >= 0)
+        {
+            const auto wFirst = m_atlas.GetGlyph(static_cast<std::size_t>(anGlyph[0])).source.w;
+            const auto wEffect = m_atlas.GetGlyph(static_cast<std::size_t>(style.nEffect)).source.w;
+            AppendGlyph(list, texture, style.nEffect, x + (wFirst - wEffect) * 0.5F, baseY, color);
+        }
+
+        for (std::size_t k = 0; k < nDigit; ++k)
+        {
+            AppendGlyph(list, texture, anGlyph[k], x, baseY, color);
+            x += m_atlas.GetGlyph(static_cast<std::size_t>(anGlyph[k])).source.w;
+        }
+    }
+    return list.GetCount() - nBefore;
+}
+
+void DamageNumberRenderer::CollectRenderItems(WzGr2DRenderList& list, SDL_Renderer* renderer,
+                                              std::int32_t tCur,
+                                              std::int32_t offsetX, std::int32_t offsetY)
+{
+    const auto& pCanvas = m_atlas.GetCanvas();
+    if (m_aNumber.empty() || !pCanvas)
+        return;
+
+    // Same texture path as a layer's canvas: created here when the
+    // renderer is at hand, otherwise by the render thread for a later frame
+    auto* texture = pCanvas->GetTexture();
+    if (!texture && renderer)
+        texture = pCanvas->CreateTexture(renderer);
+    if (!texture)
+    {
+        if (!renderer)
+            get_gr().RequestTexture(*pCanvas);
+        std::erase_if(m_aNumber, [tCur](const Number& n) { return tCur - n.tSpawn >= Lifetime; });
+        return;
+    }
+
+    AppendGlyphs(list, texture, tCur, offsetX, offsetY);
+}
+
+} // namespace ms
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "graphics/IWzGr2DRenderSource.h"
+#include "graphics/WzGr2DGlyphAtlas.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct SDL_Texture;
+
+namespace ms
+{
+
+class WzProperty;
+
+/// Digit sprite set of a damage number (Effect/BasicEff.img/No<set>0 and 1)
+enum class DamageStyle : std::uint8_t
+{
+    Normal,   ///< NoRed: damage dealt
+    Critical, ///< NoCri: critical hit, with the burst behind the first digit
+    Received, ///< NoViolet: damage taken
+    Party,    ///< NoBlue: damage dealt by party members
+    Count,
+};
+
+/**
+ * @brief Floating damage numbers drawn straight from a glyph atlas
+ *
+ * A live number is a small record (value, style, spawn time, position)
+ * instead of a layer per digit with its own tweening vectors. Rise and
+ * fade are functions of the age, evaluated when the frame is built; all
+ * digits of all styles sit in one atlas texture, so a screen full of
+ * numbers is a single render batch.
+ *
+ * Registered with WzGr2D as a render source; used on the simulation thread.
+ */
+class DamageNumberRenderer : public IWzGr2DRenderSource
+{
+public:
+    static constexpr std::int32_t Lifetime = 1000;    ///< ms from spawn until gone
+    static constexpr std::int32_t FadeStart = 500;    ///< ms after spawn the fade begins
+    static constexpr std::int32_t RiseDistance = 40;  ///< px risen over the lifetime
+
+    struct Number
+    {
+        std::int32_t nValue{};
+        std::int32_t tSpawn{};
+        std::int32_t x{};   ///< World position of the bottom centre
+        std::int32_t y{};
+        DamageStyle eStyle{DamageStyle::Normal};
+    };
+
+    explicit DamageNumberRenderer(std::int32_t z = 0) noexcept : m_nZ(z) {}
+
+    /**
+     * @brief Queue the glyphs of one style
+     * @param pSmall Digits "0".."9" (and "Miss") after the first
+     * @param pLarge Leading digits "0".."9" (and the critical "effect")
+     *
+     * Takes effect with the next Build().
+     */
+    void LoadStyle(DamageStyle eStyle,
+                   const std::shared_ptr<WzProperty>& pSmall,
+                   const std::shared_ptr<WzProperty>& pLarge);
+
+    /// LoadStyle every style from Effect/BasicEff.img, then Build()
+    void LoadBasicEff();
+
+    /// Pack the loaded glyphs into the atlas
+    void Build();
+
+    [[nodiscard]] auto IsLoaded() const noexcept -> bool { return m_atlas.GetCanvas() != nullptr; }
+
+    /**
+     * @brief Show a number
+     * @param tSpawn When it appears; later than now to stagger multi-hit lines
+     *
+     * A value of 0 or less shows "Miss" where the style has it.
+     */
+    void Add(std::int32_t nValue, DamageStyle eStyle,
+             std::int32_t x, std::int32_t y, std::int32_t tSpawn);
+
+    void Clear() noexcept { m_aNumber.clear(); }
+    [[nodiscard]] auto GetCount() const noexcept -> std::size_t { return m_aNumber.size(); }
+
+    /// Pixels risen at an age (ease-out)
+    [[nodiscard]] static auto GetRise(std::int32_t nAge) noexcept -> float;
+    /// Opacity at an age
+    [[nodiscard]] static auto GetAlpha(std::int32_t nAge) noexcept -> std::uint8_t;
+
+    /**
+     * @brief Drop expired numbers and append the glyphs of the others
+     * @return Number of quads appended
+     */
+    auto AppendGlyphs(WzGr2DRenderList& list, SDL_Texture* texture, std::int32_t tCur,
+                      std::int32_t offsetX, std::int32_t offsetY) -> std::size_t;
+
+    // === IWzGr2DRenderSource ===
+    [[nodiscard]] auto GetZ() const -> std::int32_t override { return m_nZ; }
+    void CollectRenderItems(WzGr2DRenderList& list, SDL_Renderer* renderer,
+                            std::int32_t tCur,
+                            std::int32_t offsetX, std::int32_t offsetY) override;
+
+private:
+    struct StyleGlyphs
+    {
+        std::array<std::int16_t, 10> anSmall{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+        std::array<std::int16_t, 10> anLarge{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+        std::int16_t nMiss{-1};
+        std::int16_t nEffect{-1};
+        bool bWarnedMissing{false};  // Logged a number it had no digits for
+    };
+
+    void AppendGlyph(WzGr2DRenderList& list, SDL_Texture* texture, std::int16_t nGlyph,
+                     float x, float baseY, std::uint32_t color) const;
+
+    std::array<StyleGlyphs, static_cast<std::size_t>(DamageStyle::Count)> m_aStyle{};
+    WzGr2DGlyphAtlas m_atlas;
+    std::vector<Number> m_aNumber;
+    std::int32_t m_nZ;
+};
+
+} // namespace ms
@@ -29,6 +29,14 @@ struct FaceLookCodes
             && m_nEmotion == o.m_nEmotion
             && m_nAcc == o.m_nAcc;
     }
+
+    /// Lossless for face IDs below 2^24 and emotion indices below 256
+    [[nodiscard]] auto Pack() const noexcept -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(m_nAcc)) << 32)
+            | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(m_nFace) & 0xFFFFFFu) << 8)
+            | static_cast<std::uint8_t>(m_nEmotion);
+    }
 };
 
 /// Matches FACELOOKENTRY from the client (__cppobj : ZRefCounted).
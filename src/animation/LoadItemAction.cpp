@@ -196,7 +196,7 @@ auto BuildPiecedImgAction(
 
         if (!isFace)
         {
-            auto sActionName = actionMan.GetActionName(piece.m_nAction);
+            const std::string sActionName(actionMan.GetActionName(piece.m_nAction));
             if (!sActionName.empty())
             {
                 pPieceAction = pImg->GetChild(sActionName);
@@ -242,7 +242,7 @@ auto GetImgAction(
     std::int32_t nGhostIndex) -> std::shared_ptr<WzProperty>
 {
     auto& actionMan = ActionMan::GetInstance();
-    auto sActionName = actionMan.GetActionName(nAction);
+    const std::string sActionName(actionMan.GetActionName(nAction));
     if (sActionName.empty())
         return nullptr;
 
@@ -446,7 +446,7 @@ void LoadEquipmentSprites(
             && pImgEntry->m_bExtendFrame
             && nVehicleID != 0)
         {
-            auto sActionName = actionMan.GetActionName(nAction);
+            const std::string sActionName(actionMan.GetActionName(nAction));
             auto pVehDefault = pImgEntry->m_pVehicleDefaultFrame->GetChild(sActionName);
             if (pVehDefault && pVehDefault->GetInt(0) != 0)
             {
@@ -722,7 +722,7 @@ void LoadItemActionExtendFrame(
     auto& actionMan = ActionMan::GetInstance();
 
     // Look up the action property within pProp (weeklyImg)
-    auto sActionName = actionMan.GetActionName(nAction);
+    const std::string sActionName(actionMan.GetActionName(nAction));
     if (sActionName.empty())
         return;
 
@@ -20,6 +20,7 @@
 
 #include <SDL3/SDL.h>
 #include <filesystem>
+#include <thread>
 
 namespace ms
 {
@@ -59,6 +60,8 @@ auto Application::Initialize(int argc, char* argv[]) -> bool
     // Parse command line arguments
     // Usage: --wz-path <path> or -w <path>
     //        --offline - Run in offline mode with sample worlds
+    //        --threaded-render - Simulate and render on separate threads
+    //        --bake-static-layers - Draw static tiles/objects from cached chunks
     for (int i = 1; i < argc; ++i)
     {
         std::string arg = argv[i];
@@ -72,6 +75,24 @@ auto Application::Initialize(int argc, char* argv[]) -> bool
             config.SetOfflineMode(true);
             LOG_INFO("Offline mode enabled");
         }
+        else if (arg == "--threaded-render")
+        {
+            config.SetThreadedRender(true);
+            LOG_INFO("Threaded rendering enabled");
+        }
+        else if (arg == "--bake-static-layers")
+        {
+            config.SetStaticLayerBaking(true);
+            LOG_INFO("Static layer baking enabled");
+        }
+    }
+
+    // Chunks are baked into render targets during LoadMap, which runs on the
+    // simulation thread in threaded mode
+    if (config.IsStaticLayerBakingEnabled() && config.IsThreadedRenderEnabled())
+    {
+        LOG_WARN("--bake-static-layers is ignored with --threaded-render");
+        config.SetStaticLayerBaking(false);
     }
 
     // Create WvsContext singleton
@@ -144,6 +165,12 @@ void Application::Run()
     //   3. GenerateAutoKeyDown → ISMsgProc
     //   4. PreUpdate / CallUpdate / PostUpdate / Render
 
+    if (Configuration::GetInstance().IsThreadedRenderEnabled())
+    {
+        RunThreaded();
+        return;
+    }
+
     SDL_Event event;
 
     while (m_bIsRunning && !m_bIsTerminating)
@@ -162,18 +189,8 @@ void Application::Run()
             input.ProcessEvent(event);
         }
 
-        // 2. Drain ISMSG queue → dispatch via ISMsgProc
-        ISMSG msg{};
-        while (input.GetISMessage(&msg))
-        {
-            ISMsgProc(msg.message, msg.wParam, msg.lParam);
-        }
-
-        // 3. Generate auto-repeat key events
-        if (input.GenerateAutoKeyDown(&msg))
-        {
-            ISMsgProc(msg.message, msg.wParam, msg.lParam);
-        }
+        // 2-3. Dispatch ISMSGs and auto-repeat keys
+        DispatchInput();
 
         // --- Per-frame update/render (mirrors CWvsApp::Run idle branch) ---
         auto& gr = get_gr();
@@ -195,6 +212,85 @@ void Application::Run()
     }
 }
 
+void Application::RunThreaded()
+{
+    // Same loop as Run(), split in two: this thread owns the window and the
+    // renderer (SDL wants events and drawing on the thread that created them)
+    // and only polls events and presents frames; the simulation thread runs
+    // input dispatch, the fixed-step updates and frame building. Neither
+    // waits for the other: frames go through WzGr2D's triple buffer.
+    auto& gr = get_gr();
+    gr.SetThreadedRender(true);
+
+    std::thread simulation(&Application::SimulationMain, this);
+
+    SDL_Event event;
+    while (m_bIsRunning && !m_bIsTerminating)
+    {
+        {
+            std::lock_guard lock(m_mtxEvent);
+            while (SDL_PollEvent(&event))
+            {
+                if (event.type == SDL_EVENT_QUIT)
+                {
+                    m_bIsTerminating = true;
+                    break;
+                }
+                m_aEvent.push_back(event);
+            }
+        }
+
+        // Present blocks on vsync; only idle when there was nothing new
+        if (!gr.PresentLatestFrame())
+        {
+            SDL_Delay(1);
+        }
+    }
+
+    m_bIsTerminating = true;
+    simulation.join();
+
+    gr.SetThreadedRender(false);
+}
+
+void Application::SimulationMain()
+{
+    std::vector<SDL_Event> aEvent;
+
+    while (m_bIsRunning && !m_bIsTerminating)
+    {
+        auto& input = InputSystem::GetInstance();
+
+        // 1. Events polled by the main thread since the last iteration
+        {
+            std::lock_guard lock(m_mtxEvent);
+            aEvent.swap(m_aEvent);
+        }
+        for (const auto& event : aEvent)
+        {
+            input.ProcessEvent(event);
+        }
+        aEvent.clear();
+
+        // 2-3. Dispatch ISMSGs and auto-repeat keys
+        DispatchInput();
+
+        // 4. Update phases, then publish a frame instead of drawing it
+        auto& gr = get_gr();
+
+        UpdateManager::s_PreUpdate();
+
+        const auto tCurTime = static_cast<std::uint64_t>(gr.GetNextRenderTime());
+        CallUpdate(tCurTime);
+
+        UpdateManager::s_PostUpdate();
+
+        Render();
+
+        SDL_Delay(1);
+    }
+}
+
 void Application::Shutdown()
 {
     m_bIsRunning = false;
@@ -317,6 +413,24 @@ void Application::ISMsgProc(std::uint32_t message, std::uint32_t wParam,
     }
 }
 
+void Application::DispatchInput()
+{
+    auto& input = InputSystem::GetInstance();
+
+    // Drain ISMSG queue → dispatch via ISMsgProc
+    ISMSG msg{};
+    while (input.GetISMessage(&msg))
+    {
+        ISMsgProc(msg.message, msg.wParam, msg.lParam);
+    }
+
+    // Generate auto-repeat key events
+    if (input.GenerateAutoKeyDown(&msg))
+    {
+        ISMsgProc(msg.message, msg.wParam, msg.lParam);
+    }
+}
+
 void Application::ProcessInput()
 {
     // Legacy path — no longer used.
@@ -371,8 +485,15 @@ void Application::Render()
         g_pStage->Draw();
     }
 
-    // Render all layers and present
-    (void)gr.RenderFrame(tCur);
+    // Render all layers and present, or hand them to the render thread
+    if (gr.IsThreadedRender())
+    {
+        (void)gr.PublishFrame(tCur);
+    }
+    else
+    {
+        (void)gr.RenderFrame(tCur);
+    }
 }
 
 } // namespace ms
@@ -2,12 +2,16 @@
 
 #include "util/Singleton.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 struct SDL_Window;
 struct SDL_Renderer;
+union SDL_Event;
 
 namespace ms
 {
@@ -52,7 +56,8 @@ public:
     /**
      * @brief Main game loop
      *
-     * Based on CWvsApp::Run
+     * Based on CWvsApp::Run. With Configuration::IsThreadedRenderEnabled()
+     * the simulation moves to its own thread (see RunThreaded).
      */
     void Run();
 
@@ -131,9 +136,14 @@ private:
 
     // Main loop components
     void ProcessInput();
+    void DispatchInput();
     void CallUpdate(std::uint64_t tCurTime);
     void Render();
 
+    // Threaded mode: this thread polls events and draws, the other simulates
+    void RunThreaded();
+    void SimulationMain();
+
     /// CWvsApp::ISMsgProc — routes ISMSG to CWndMan::ProcessKey/ProcessMouse
     void ISMsgProc(std::uint32_t message, std::uint32_t wParam,
                    std::int32_t lParam);
@@ -155,9 +165,13 @@ private:
     bool m_bFirstUpdate = true;
 
     // State
-    bool m_bIsTerminating = false;
+    std::atomic<bool> m_bIsTerminating{false};
     bool m_bIsRunning = false;
 
+    // Threaded mode: SDL events polled on the main thread for the simulation
+    std::mutex m_mtxEvent;
+    std::vector<SDL_Event> m_aEvent;
+
     // Command line
     std::string m_sCmdLine;
 
@@ -60,6 +60,10 @@ public:
     // Graphics settings
     [[nodiscard]] auto IsShaderEnabled() const noexcept -> bool { return m_bEnabledShader; }
     [[nodiscard]] auto IsDX9Enabled() const noexcept -> bool { return m_bEnabledDX9; }
+    [[nodiscard]] auto IsStaticLayerBakingEnabled() const noexcept -> bool { return m_bBakeStaticLayers; }
+    void SetStaticLayerBaking(bool enable) noexcept { m_bBakeStaticLayers = enable; }
+    [[nodiscard]] auto IsThreadedRenderEnabled() const noexcept -> bool { return m_bThreadedRender; }
+    void SetThreadedRender(bool enable) noexcept { m_bThreadedRender = enable; }
 
     // Path settings
     [[nodiscard]] auto GetExecPath() const noexcept -> const std::string& { return m_sExecPath; }
@@ -87,6 +91,8 @@ private:
     // Graphics settings
     bool m_bEnabledShader{true};
     bool m_bEnabledDX9{false};
+    bool m_bBakeStaticLayers{false}; // Bake tiles/static objects into chunks
+    bool m_bThreadedRender{false};   // Simulate and render on separate threads
 
     // Path settings
     std::string m_sExecPath;
@@ -294,48 +294,50 @@ Manager::Manager()
 Manager::~Manager()
 {
     UpdateManager::s_Detach(static_cast<IUpdatable*>(this));
-    m_queueCmds.clear();
-    m_ScaleCmds.clear();
-    m_pCmd.reset();
+    m_queueCmds.Clear();
+    m_cmd.reset();
 }
 
 void Manager::Update()
 {
-    if (m_pCmd)
+    if (m_cmd)
     {
         // Current command in progress — tick it
-        if (m_pCmd->Update())
+        if (std::visit([](auto& cmd) { return cmd.Update(); }, *m_cmd))
         {
-            m_pCmd.reset();
+            m_cmd.reset();
             // Original calls g_gr->raw_forceFilter(-1) to reset filter
         }
     }
-    else if (!m_queueCmds.empty())
+    else
     {
         // No active command — pop next from queue
-        auto& front = m_queueCmds.front();
-        if (front->Begin() && !front->Update())
+        AnyCommand next;
+        if (!m_queueCmds.TryPop(next))
+        {
+            return;
+        }
+
+        const auto bStarted = std::visit(
+            [](auto& cmd) { return cmd.Begin() && !cmd.Update(); }, next);
+        if (bStarted)
         {
             // Command started and not yet finished — make it current
-            m_pCmd = front;
+            m_cmd = std::move(next);
             // Original calls g_gr->raw_forceFilter(2) to set bilinear filter
         }
-        m_queueCmds.pop_front();
     }
 }
 
-void Manager::QueueCommand(std::shared_ptr<Command> pCmd)
+auto Manager::QueueCommand(const AnyCommand& cmd) -> bool
 {
-    if (pCmd)
-    {
-        m_queueCmds.push_back(std::move(pCmd));
-    }
+    return m_queueCmds.TryPush(cmd);
 }
 
 void Manager::OnSetField()
 {
-    m_pCmd.reset();
-    m_queueCmds.clear();
+    m_cmd.reset();
+    m_queueCmds.Clear();
     // Original also calls g_gr->raw_forceFilter(-1) here
 }
 
@@ -3,10 +3,11 @@
 #include "app/IUpdatable.h"
 #include "util/Point.h"
 #include "util/Singleton.h"
+#include "util/SpscRing.h"
 
 #include <cstdint>
-#include <deque>
-#include <memory>
+#include <optional>
+#include <variant>
 
 namespace ms
 {
@@ -62,13 +63,14 @@ namespace CameraCtrl
  *
  * Original: CameraCtrl::Command : ZRefCounted (52 bytes).
  * vtable: { ~Command, Update } — Begin is non-virtual.
+ *
+ * Here commands are plain values held in AnyCommand, so each kind's
+ * Update() is picked by std::visit instead of through a vtable.
  */
 struct Command
 {
-    virtual ~Command() = default;
-
     /// Called per update tick. Returns true when the command is finished.
-    virtual auto Update() -> bool { return true; }
+    auto Update() -> bool { return true; }
 
     /// Called once when the command starts (non-virtual).
     /// Validates type, backs up camera state, sets tStart.
@@ -94,25 +96,25 @@ struct Command
 struct AbsMoveCommand : Command
 {
     Point2D ptDest;
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct RelMoveCommand : Command
 {
     Point2D ptOffset;
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct ReturnToUserCommand : Command
 {
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct ScaleCommand : Command
 {
     std::int32_t nStartScale{};
     std::int32_t nEndScale{};
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct ScaleAbsMoveCommand : Command
@@ -120,7 +122,7 @@ struct ScaleAbsMoveCommand : Command
     Point2D ptDest;
     std::int32_t nStartScale{};
     std::int32_t nEndScale{};
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct ScaleRelMoveCommand : Command
@@ -128,24 +130,29 @@ struct ScaleRelMoveCommand : Command
     Point2D ptOffset;
     std::int32_t nStartScale{};
     std::int32_t nEndScale{};
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct FloatCommand : Command
 {
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct FreeFromUserCommand : Command
 {
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
 struct StickToUserCommand : Command
 {
-    auto Update() -> bool override;
+    auto Update() -> bool;
 };
 
+/// Any camera command, by value
+using AnyCommand = std::variant<AbsMoveCommand, RelMoveCommand, ReturnToUserCommand,
+                                ScaleCommand, ScaleAbsMoveCommand, ScaleRelMoveCommand,
+                                FloatCommand, FreeFromUserCommand, StickToUserCommand>;
+
 // -----------------------------------------------------------------------
 // CameraCtrl::Manager
 // -----------------------------------------------------------------------
@@ -157,6 +164,10 @@ struct StickToUserCommand : Command
  *
  * Attaches itself to UpdateManager::m_slUpdates on construction,
  * detaches on destruction (matching original ctor/dtor).
+ *
+ * Commands arrive through a fixed-size SPSC ring: one producer thread
+ * (field scripts or the packet handler) queues them and the game thread
+ * starts them from Update(), with no lock or allocation on either side.
  */
 class Manager final : public IUpdatable, public Singleton<Manager>
 {
@@ -168,22 +179,29 @@ public:
     // IUpdatable
     void Update() override;
 
+    /// Commands that can wait in the queue at once
+    static constexpr std::size_t QueueCapacity = 64;
+
     [[nodiscard]] auto IsWorking() const noexcept -> bool
     {
-        return m_pCmd != nullptr;
+        return m_cmd.has_value();
     }
 
-    void QueueCommand(std::shared_ptr<Command> pCmd);
+    /**
+     * @brief Queue a command; safe to call from one producer thread
+     * @return false if the queue is full and the command was dropped
+     */
+    auto QueueCommand(const AnyCommand& cmd) -> bool;
 
-    /// Called on field/stage transition. Clears current command and queue.
+    /// Called on field/stage transition, on the game thread.
+    /// Clears current command and queue.
     void OnSetField();
 
 private:
     Manager();
 
-    std::shared_ptr<Command> m_pCmd;
-    std::deque<std::shared_ptr<Command>> m_ScaleCmds;
-    std::deque<std::shared_ptr<Command>> m_queueCmds;
+    std::optional<AnyCommand> m_cmd;
+    TSpscRing<AnyCommand, QueueCapacity> m_queueCmds;
 };
 
 } // namespace CameraCtrl
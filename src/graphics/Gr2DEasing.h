@@ -0,0 +1,247 @@
+#pragma once
+
+#include "Gr2DVector.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+
+namespace ms
+{
+
+/**
+ * @brief Easing kernels behind EasingNode and RotateNode
+ *
+ * Each node stores its mode when its parameters are set (UpdateMode, from
+ * bounce/pingpong or from the rotation parameters) and each call runs the
+ * kernel specialised for that mode at compile time, so the per-call path
+ * carries no mode branches. The kernels only read the node;
+ * EasingNode::evaluatePos / RotateNode::evaluateAngle apply the result and
+ * commit state.
+ *
+ * Position easing is integer fixed-point: elapsed * delta / period in 64
+ * bits, truncated toward zero. This matches the double arithmetic of the
+ * original client exactly for deltas below 2^22 pixels. Bounce modes skip
+ * whole periods in closed form rather than stepping one period at a time,
+ * so a tween that went unevaluated for minutes costs the same as any other.
+ */
+namespace Gr2DEasing
+{
+
+/// Value-initialised nodes are Once / Stopped, which matches their defaults
+enum class EaseMode : std::uint8_t
+{
+    Once,       ///< Move by (dx, dy) once, then complete
+    Repeat,     ///< bounce: keep adding (dx, dy) every period
+    PingPong,   ///< bounce + pingpong: go back and forth
+    Count
+};
+
+enum class TurnMode : std::uint8_t
+{
+    Stopped,    ///< Continuous spin with no period: completes at once
+    Spin,       ///< Continuous spin at 360 degrees per period
+    SpinEased,  ///< Continuous spin with a quadratic ease-in
+    Linear,     ///< Finite turn at constant speed
+    Eased,      ///< Finite turn: ease-in, coast, ease-out
+    Count
+};
+
+/// Result of one EasingNode sample
+struct EaseSample
+{
+    std::int32_t x = 0, y = 0;              ///< Offset to add to the position
+    std::int32_t accumX = 0, accumY = 0;    ///< State after period skipping
+    std::int32_t dx = 0, dy = 0;
+    std::int32_t startTime = 0, endTime = 0;
+    bool cycled = false;                    ///< At least one period end was passed
+    bool moving = false;                    ///< Frame lies inside the active window
+};
+
+[[nodiscard]] inline auto ModeOf(const EasingNode& node) -> EaseMode
+{
+    if (!node.bounce)
+        return EaseMode::Once;
+    return node.pingpong ? EaseMode::PingPong : EaseMode::Repeat;
+}
+
+[[nodiscard]] inline auto ModeOf(const RotateNode& node) -> TurnMode
+{
+    if (std::fabs(node.totalAngle) < 1.0e-10)
+    {
+        if (node.period == 0)
+            return TurnMode::Stopped;
+        return node.easeFrames > 0 ? TurnMode::SpinEased : TurnMode::Spin;
+    }
+    return node.easeFrames == 0 ? TurnMode::Linear : TurnMode::Eased;
+}
+
+/**
+ * @brief Accumulated offset after n >= 1 ping-pong half-periods
+ *
+ * The client toggles the accumulator every period: a zero accumulator takes
+ * the current delta, a non-zero one resets to zero, and the delta flips
+ * sign each time. That only depends on the parity of n.
+ */
+[[nodiscard]] constexpr auto PingPongAccum(std::int32_t accum, std::int32_t delta,
+                                           std::int64_t n) -> std::int32_t
+{
+    if (accum == 0)
+        return (n & 1) ? delta : 0;
+    return (n & 1) ? 0 : -delta;
+}
+
+template <EaseMode Mode>
+auto Ease(const EasingNode& node, std::int32_t frame, EaseSample& s) -> int
+{
+    s.x = 0;
+    s.y = 0;
+    s.cycled = false;
+    s.moving = false;
+    s.accumX = node.accum_x;
+    s.accumY = node.accum_y;
+    s.dx = node.dx;
+    s.dy = node.dy;
+    s.startTime = node.startTime;
+    s.endTime = node.endTime;
+
+    const std::int64_t period = static_cast<std::int64_t>(s.endTime) - s.startTime;
+    if (period <= 0)
+    {
+        s.x = s.dx;
+        s.y = s.dy;
+        return 1;
+    }
+
+    if (frame >= s.endTime)
+    {
+        if constexpr (Mode == EaseMode::Once)
+        {
+            s.x = s.dx;
+            s.y = s.dy;
+            return 1;
+        }
+        else
+        {
+            const std::int64_t cycles = (static_cast<std::int64_t>(frame) - s.endTime) / period + 1;
+            if constexpr (Mode == EaseMode::Repeat)
+            {
+                s.accumX = static_cast<std::int32_t>(s.accumX + cycles * s.dx);
+                s.accumY = static_cast<std::int32_t>(s.accumY + cycles * s.dy);
+            }
+            else
+            {
+                s.accumX = PingPongAccum(s.accumX, s.dx, cycles);
+                s.accumY = PingPongAccum(s.accumY, s.dy, cycles);
+                if (cycles & 1)
+                {
+                    s.dx = -s.dx;
+                    s.dy = -s.dy;
+                }
+            }
+            s.startTime = static_cast<std::int32_t>(s.endTime + (cycles - 1) * period);
+            s.endTime = static_cast<std::int32_t>(s.startTime + period);
+            s.cycled = true;
+        }
+    }
+
+    if (frame > s.startTime)
+    {
+        const std::int64_t elapsed = static_cast<std::int64_t>(frame) - s.startTime;
+        s.x = s.accumX + static_cast<std::int32_t>(s.dx * elapsed / period);
+        s.y = s.accumY + static_cast<std::int32_t>(s.dy * elapsed / period);
+        s.moving = true;
+    }
+    return 0;
+}
+
+template <TurnMode Mode>
+auto Turn(const RotateNode& node, std::int32_t frame, double& angle) -> int
+{
+    if constexpr (Mode == TurnMode::Stopped)
+    {
+        (void)node; (void)frame; (void)angle;
+        return 1;
+    }
+    else if constexpr (Mode == TurnMode::Spin || Mode == TurnMode::SpinEased)
+    {
+        const std::int32_t elapsed = frame - node.startTime;
+        const double pd = static_cast<double>(node.period);
+
+        if constexpr (Mode == TurnMode::SpinEased)
+        {
+            if (elapsed < node.easeFrames)
+            {
+                angle += 360.0 / pd / static_cast<double>(node.easeFrames)
+                       * static_cast<double>(elapsed) * static_cast<double>(elapsed) * 0.5;
+                return 0;
+            }
+            angle += static_cast<double>(elapsed % node.period - node.easeFrames / 2) * 360.0 / pd;
+        }
+        else
+        {
+            angle += static_cast<double>(elapsed % node.period) * 360.0 / pd;
+        }
+        return 0;
+    }
+    else
+    {
+        if (frame >= node.period)
+        {
+            angle += node.totalAngle;
+            return 1;
+        }
+
+        const std::int32_t elapsed = frame - node.startTime;
+        const std::int32_t dur = node.period - node.startTime;
+
+        if constexpr (Mode == TurnMode::Linear)
+        {
+            angle += node.totalAngle * static_cast<double>(elapsed) / static_cast<double>(dur);
+        }
+        else
+        {
+            const std::int32_t coastDur = dur - 2 * node.easeFrames;
+            const double easeD = static_cast<double>(node.easeFrames);
+            const double rate = node.totalAngle / static_cast<double>(coastDur + node.easeFrames);
+            const double easeInContrib = easeD * rate * 0.5;
+
+            if (elapsed < node.easeFrames)
+            {
+                angle += rate / easeD * static_cast<double>(elapsed)
+                       * static_cast<double>(elapsed) * 0.5;
+            }
+            else if (elapsed < coastDur + node.easeFrames)
+            {
+                angle += rate * static_cast<double>(elapsed - node.easeFrames) + easeInContrib;
+            }
+            else
+            {
+                const double t = static_cast<double>(elapsed - coastDur - node.easeFrames);
+                angle += (-rate / easeD * t + 2.0 * rate) * t * 0.5
+                       + static_cast<double>(coastDur) * rate
+                       + easeInContrib;
+            }
+        }
+        return 0;
+    }
+}
+
+using EaseKernel = auto (*)(const EasingNode&, std::int32_t, EaseSample&) -> int;
+using TurnKernel = auto (*)(const RotateNode&, std::int32_t, double&) -> int;
+
+/// Kernels indexed by EaseMode
+inline constexpr EaseKernel EaseKernels[] = {
+    &Ease<EaseMode::Once>, &Ease<EaseMode::Repeat>, &Ease<EaseMode::PingPong>};
+
+/// Kernels indexed by TurnMode
+inline constexpr TurnKernel TurnKernels[] = {
+    &Turn<TurnMode::Stopped>, &Turn<TurnMode::Spin>, &Turn<TurnMode::SpinEased>,
+    &Turn<TurnMode::Linear>, &Turn<TurnMode::Eased>};
+
+static_assert(std::size(EaseKernels) == static_cast<std::size_t>(EaseMode::Count));
+static_assert(std::size(TurnKernels) == static_cast<std::size_t>(TurnMode::Count));
+
+} // namespace Gr2DEasing
+
+} // namespace ms
@@ -1,6 +1,8 @@
 #include "Gr2DVector.h"
+#include "Gr2DEasing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -18,7 +20,8 @@ namespace ms
 
 namespace
 {
-    std::int32_t g_currentTime = 0;
+    // Atomic so layer updates running on worker threads may read it
+    std::atomic<std::int32_t> g_currentTime{0};
 
     // Round-to-nearest with symmetric negative handling (matches original binary)
     auto roundToInt(double v) -> std::int32_t
@@ -47,15 +50,53 @@ namespace Gr2DTime
 {
     auto GetCurrentTime() -> std::int32_t
     {
-        return g_currentTime;
+        return g_currentTime.load(std::memory_order_relaxed);
     }
 
     void SetCurrentTime(std::int32_t t)
     {
-        g_currentTime = t;
+        g_currentTime.store(t, std::memory_order_relaxed);
     }
 }
 
+// =============================================================================
+// AnimNodePool
+// =============================================================================
+
+AnimNodePool::AnimNodePool()
+{
+    for (auto i = InlineSlots; i-- > 0;)
+        pushFree(&m_aInline[i]);
+}
+
+void AnimNodePool::pushFree(Slot* slot)
+{
+    slot->nextFree = m_pFree;
+    m_pFree = slot;
+}
+
+auto AnimNodePool::acquire() -> void*
+{
+    if (!m_pFree)
+    {
+        auto& block = m_aBlock.emplace_back(std::make_unique<Slot[]>(BlockSlots));
+        for (auto i = BlockSlots; i-- > 0;)
+            pushFree(&block[i]);
+    }
+
+    Slot* slot = m_pFree;
+    m_pFree = slot->nextFree;
+    ++m_nLive;
+    return slot->storage;
+}
+
+void AnimNodePool::destroy(AnimNode* node)
+{
+    node->~AnimNode();
+    pushFree(reinterpret_cast<Slot*>(node));
+    --m_nLive;
+}
+
 // =============================================================================
 // AnimChain
 // =============================================================================
@@ -71,7 +112,7 @@ void AnimChain::clearNodes()
     while (cur)
     {
         AnimNode* nx = cur->next;
-        delete cur;
+        node_pool.destroy(cur);
         cur = nx;
     }
     head = tail = nullptr;
@@ -85,7 +126,7 @@ void AnimChain::removeNode(AnimNode* node)
     if (node->next) node->next->prev = node->prev;
     else            tail = node->prev;
     node->prev = node->next = nullptr;
-    delete node;
+    node_pool.destroy(node);
 }
 
 // Insert sorted by phase ascending (lower phase first = closer to head)
@@ -335,95 +376,39 @@ void AnimChain::evaluate(std::int32_t frame, bool commit)
 // EasingNode::evaluatePos — reimplements sub_153412310
 // =============================================================================
 
+void EasingNode::UpdateMode() noexcept
+{
+    mode = Gr2DEasing::ModeOf(*this);
+}
+
 auto EasingNode::evaluatePos(std::int32_t& x, std::int32_t& y,
                               std::int32_t frame, bool commit) -> int
 {
-    std::int32_t ax = accum_x, ay = accum_y;
-    std::int32_t st = startTime, et = endTime;
-    std::int32_t curDx = dx, curDy = dy;
+    Gr2DEasing::EaseSample s;
+    const int ret = Gr2DEasing::EaseKernels[static_cast<std::size_t>(mode)](*this, frame, s);
 
-    // Instant animation
-    if (et - st <= 0)
-    {
-        x += curDx;
-        y += curDy;
-        return 1;
-    }
+    x += s.x;
+    y += s.y;
+    if (ret == 1 || !commit)
+        return ret;
 
-    std::int32_t loose = 0;
+    // Ping-pong flips direction each period; other modes keep dx/dy
+    dx = s.dx;
+    dy = s.dy;
 
-    if (frame >= et)
+    if (s.moving)
     {
-        // Past end time
-        if (!bounce)
+        std::int32_t loose = 0;
+        if (frame - looseTimer >= 30)
         {
-            x += curDx;
-            y += curDy;
-            return 1;
+            loose = looseLevel;
+            looseTimer = frame;
         }
-
-        if (pingpong)
-        {
-            // Alternate direction each cycle
-            do
-            {
-                if (ax != 0) { ax = 0; }
-                else         { ax = curDx; }
-                if (ay != 0) { ay = 0; }
-                else         { ay = curDy; }
-
-                std::int32_t period = et - st;
-                curDx = -curDx;
-                curDy = -curDy;
-                st = et;
-                et += period;
-            } while (frame >= et);
-
-            if (commit)
-            {
-                dx = curDx;
-                dy = curDy;
-            }
-        }
-        else
-        {
-            // Accumulate each cycle
-            do
-            {
-                ax += curDx;
-                ay += curDy;
-                std::int32_t period = et - st;
-                st = et;
-                et += period;
-            } while (frame >= et);
-        }
-        // Fall through to interpolation
+        startTime = s.startTime;
+        endTime   = s.endTime - loose;
+        accum_x   = s.accumX;
+        accum_y   = s.accumY;
     }
-
-    if (frame > st)
-    {
-        // Interpolate current progress
-        x += ax;
-        y += ay;
-        double progress = static_cast<double>(frame - st);
-        double total    = static_cast<double>(et - st);
-        x += static_cast<std::int32_t>(static_cast<double>(curDx) * progress / total);
-        y += static_cast<std::int32_t>(static_cast<double>(curDy) * progress / total);
-
-        if (commit)
-        {
-            if (frame - looseTimer >= 30)
-            {
-                loose = looseLevel;
-                looseTimer = frame;
-            }
-            startTime = st;
-            endTime   = et - loose;
-            accum_x   = ax;
-            accum_y   = ay;
-        }
-    }
-
     return 0;
 }
 
@@ -564,82 +549,15 @@ auto WrapClipNode::evaluatePos(std::int32_t& x, std::int32_t& y,
 // RotateNode::evaluateAngle — reimplements sub_153412B30
 // =============================================================================
 
+void RotateNode::UpdateMode() noexcept
+{
+    mode = Gr2DEasing::ModeOf(*this);
+}
+
 auto RotateNode::evaluateAngle(double& angle, std::int32_t frame,
                                 bool /*commit*/) -> int
 {
-    if (std::fabs(totalAngle) < 1.0e-10)
-    {
-        // Continuous rotation
-        if (period == 0) return 1;
-
-        std::int32_t elapsed = frame - startTime;
-        double pd = static_cast<double>(period);
-
-        if (easeFrames > 0 && elapsed < easeFrames)
-        {
-            // Quadratic ease-in
-            angle += 360.0 / pd / static_cast<double>(easeFrames)
-                   * static_cast<double>(elapsed) * static_cast<double>(elapsed) * 0.5;
-            return 0;
-        }
-
-        double cyclePos;
-        if (easeFrames > 0)
-        {
-            cyclePos = static_cast<double>(elapsed % period - easeFrames / 2) * 360.0;
-        }
-        else
-        {
-            cyclePos = static_cast<double>(elapsed % period) * 360.0;
-        }
-        angle += cyclePos / pd;
-        return 0;
-    }
-
-    // Finite rotation
-    if (frame >= period)
-    {
-        angle += totalAngle;
-        return 1;
-    }
-
-    std::int32_t elapsed = frame - startTime;
-    std::int32_t dur     = period - startTime;
-
-    if (easeFrames == 0)
-    {
-        // Linear
-        angle += totalAngle * static_cast<double>(elapsed) / static_cast<double>(dur);
-        return 0;
-    }
-
-    // 3-phase ease-in / coast / ease-out
-    std::int32_t coastDur = dur - 2 * easeFrames;
-    double ease_d = static_cast<double>(easeFrames);
-    double rate   = totalAngle / static_cast<double>(coastDur + easeFrames);
-
-    if (elapsed < easeFrames)
-    {
-        // Ease-in: quadratic acceleration
-        angle += rate / ease_d * static_cast<double>(elapsed)
-               * static_cast<double>(elapsed) * 0.5;
-    }
-    else if (elapsed < coastDur + easeFrames)
-    {
-        // Coast: constant speed
-        double easeInContrib = ease_d * rate * 0.5;
-        angle += rate * static_cast<double>(elapsed - easeFrames) + easeInContrib;
-    }
-    else
-    {
-        // Ease-out: quadratic deceleration
-        double easeInContrib = ease_d * rate * 0.5;
-        double t = static_cast<double>(elapsed - coastDur - easeFrames);
-        angle += (-rate / ease_d * t + 2.0 * rate) * t * 0.5
-               + static_cast<double>(coastDur) * rate
-               + easeInContrib;
-    }
-    return 0;
+    return Gr2DEasing::TurnKernels[static_cast<std::size_t>(mode)](*this, frame, angle);
 }
 
 // =============================================================================
@@ -883,13 +801,14 @@ void Gr2DVector::RelMove(std::int32_t x, std::int32_t y,
     std::int32_t now = Gr2DTime::GetCurrentTime();
 
     // Create easing node
-    auto* node = new EasingNode();
+    auto* node = c->createNode<EasingNode>();
     node->dx = x - cur_rx;
     node->dy = y - cur_ry;
     node->startTime = (startTime != 0) ? startTime : now;
     node->endTime = (endTime != 0) ? endTime : now;
     node->bounce = bounce;
     node->pingpong = pingpong;
+    node->UpdateMode();
     node->looseTimer = now;
 
     // Optionally remove existing easing nodes
@@ -925,7 +844,7 @@ void Gr2DVector::RelOffset(std::int32_t dx, std::int32_t dy,
     AnimChain* c = ensureChain();
     std::int32_t now = Gr2DTime::GetCurrentTime();
 
-    auto* node = new EasingNode();
+    auto* node = c->createNode<EasingNode>();
     node->dx = dx;
     node->dy = dy;
     node->startTime = (startTime != 0) ? startTime : now;
@@ -941,11 +860,12 @@ void Gr2DVector::Rotate(double angle, std::int32_t period, std::int32_t easeFram
     AnimChain* c = ensureChain();
     std::int32_t now = Gr2DTime::GetCurrentTime();
 
-    auto* node = new RotateNode();
+    auto* node = c->createNode<RotateNode>();
     node->totalAngle = angle;
     node->startTime  = now;
     node->period     = period;
     node->easeFrames = easeFrames;
+    node->UpdateMode();
 
     c->insertNode(node);
     c->evaluated = false;
@@ -959,7 +879,7 @@ void Gr2DVector::Ratio(IWzVector2D* target,
 
     AnimChain* c = ensureChain();
 
-    auto* node = new RatioNode();
+    auto* node = c->createNode<RatioNode>();
     node->target = target;
     node->base_x = target->GetX();
     node->base_y = target->GetY();
@@ -979,7 +899,7 @@ void Gr2DVector::WrapClip(IWzVector2D* bounds,
 {
     AnimChain* c = ensureChain();
 
-    auto* node = new WrapClipNode();
+    auto* node = c->createNode<WrapClipNode>();
     node->bounds    = bounds;
     node->left      = x;
     node->top       = y;
@@ -998,7 +918,7 @@ void Gr2DVector::Fly(const std::vector<FlyKeyframe>& keyframes,
 
     AnimChain* c = ensureChain();
 
-    auto* node = new FlyNode();
+    auto* node = c->createNode<FlyNode>();
     node->keyframes  = keyframes;
     node->completion = completionTarget;
 
@@ -2,9 +2,13 @@
 
 #include "IWzVector2D.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cmath>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 namespace ms
@@ -13,6 +17,12 @@ namespace ms
 class Gr2DVector;
 struct AnimChain;
 
+namespace Gr2DEasing
+{
+enum class EaseMode : std::uint8_t;
+enum class TurnMode : std::uint8_t;
+}
+
 /**
  * @brief Global time management for Gr2D animations
  */
@@ -69,9 +79,13 @@ struct EasingNode : public AnimNode
     std::int32_t startTime = 0, endTime = 0;
     bool bounce = false;
     bool pingpong = false;
+    Gr2DEasing::EaseMode mode{};  ///< Kernel for bounce/pingpong (see UpdateMode)
     std::int32_t looseLevel = 0;
     std::int32_t looseTimer = 0;
 
+    /// Pick the easing kernel; call whenever bounce/pingpong change
+    void UpdateMode() noexcept;
+
     [[nodiscard]] auto type() const -> std::uint32_t override { return 0x00000001; }
     auto evaluatePos(std::int32_t& x, std::int32_t& y,
                     std::int32_t frame, bool commit) -> int override;
@@ -137,15 +151,83 @@ struct RotateNode : public AnimNode
     std::int32_t startTime = 0;
     std::int32_t period = 0;
     std::int32_t easeFrames = 0;
+    Gr2DEasing::TurnMode mode{};  ///< Kernel for the parameters above (see UpdateMode)
+
+    /// Pick the rotation kernel; call whenever the parameters change
+    void UpdateMode() noexcept;
 
     [[nodiscard]] auto type() const -> std::uint32_t override { return 0x00280003; }
     auto evaluateAngle(double& angle, std::int32_t frame, bool commit) -> int override;
 };
 
+/**
+ * @brief Typed slot allocator for the AnimNodes of one chain
+ *
+ * Every node type fits one fixed-size slot. The first InlineSlots slots live
+ * inside the pool itself, which covers the usual one- or two-node chain
+ * (a RelMove plus a Rotate) without touching the heap. Beyond that, slots
+ * are carved from heap blocks of BlockSlots that stay with the pool until
+ * it dies. Released slots go on a freelist, so a vector that keeps starting
+ * and finishing tweens reuses the same memory.
+ */
+class AnimNodePool
+{
+public:
+    static constexpr std::size_t InlineSlots = 2;
+    static constexpr std::size_t BlockSlots = 8;
+
+    static constexpr std::size_t SlotSize = std::max({
+        sizeof(EasingNode), sizeof(RatioNode), sizeof(FlyNode),
+        sizeof(WrapClipNode), sizeof(RotateNode)});
+    static constexpr std::size_t SlotAlign = std::max({
+        alignof(EasingNode), alignof(RatioNode), alignof(FlyNode),
+        alignof(WrapClipNode), alignof(RotateNode)});
+
+    AnimNodePool();
+    ~AnimNodePool() = default;
+
+    // Slots point into the pool itself
+    AnimNodePool(const AnimNodePool&) = delete;
+    auto operator=(const AnimNodePool&) -> AnimNodePool& = delete;
+
+    template <typename T>
+    auto create() -> T*
+    {
+        static_assert(std::is_base_of_v<AnimNode, T>);
+        static_assert(sizeof(T) <= SlotSize && alignof(T) <= SlotAlign);
+        return ::new (acquire()) T();
+    }
+
+    /// Destroy a node made by create() and return its slot to the freelist
+    void destroy(AnimNode* node);
+
+    /// Nodes currently alive
+    [[nodiscard]] auto liveCount() const -> std::size_t { return m_nLive; }
+
+    /// Heap blocks allocated so far (0 while the inline slots suffice)
+    [[nodiscard]] auto blockCount() const -> std::size_t { return m_aBlock.size(); }
+
+private:
+    union Slot
+    {
+        Slot* nextFree;
+        alignas(SlotAlign) std::byte storage[SlotSize];
+    };
+
+    auto acquire() -> void*;
+    void pushFree(Slot* slot);
+
+    Slot m_aInline[InlineSlots];
+    std::vector<std::unique_ptr<Slot[]>> m_aBlock;
+    Slot* m_pFree = nullptr;
+    std::size_t m_nLive = 0;
+};
+
 /**
  * @brief Animation chain evaluator
  *
- * Maintains a linked list of AnimNodes sorted by phase.
+ * Maintains a linked list of AnimNodes sorted by phase. Nodes are
+ * allocated from and released to the chain's own node_pool.
  * Evaluates all nodes using a 9-step pipeline from source.
  */
 struct AnimChain
@@ -175,10 +257,16 @@ struct AnimChain
     double total_angle_cache = 0.0;
     double parent_angle_cache = 0.0;
 
+    AnimNodePool node_pool;
+
     AnimChain() = default;
     AnimChain(std::int32_t x, std::int32_t y) : base_x(x), base_y(y) {}
     ~AnimChain();
 
+    /// Allocate an unlinked node from this chain's pool; hand it to insertNode
+    template <typename T>
+    auto createNode() -> T* { return node_pool.create<T>(); }
+
     void insertNode(AnimNode* node);
     void removeNode(AnimNode* node);
     void clearNodes();
@@ -259,6 +347,8 @@ public:
     void Fly(const std::vector<FlyKeyframe>& keyframes,
              IWzVector2D* completionTarget = nullptr) override;
 
+    [[nodiscard]] auto GetResolveTarget() -> Gr2DVector* override { return this; }
+
     // === Non-interface methods ===
     void Serialize(const char* data);
 
@@ -268,11 +358,18 @@ public:
     [[nodiscard]] auto Chain() const -> AnimChain* { return m_chain.get(); }
 
 private:
+    friend class Gr2DVectorResolver;
+
     auto ensureChain() -> AnimChain*;
 
     std::int32_t m_x = 0;
     std::int32_t m_y = 0;
     std::unique_ptr<AnimChain> m_chain;
+
+    // Gr2DVectorResolver bookkeeping: generation of the last pass that
+    // visited this vector and its slot in that pass (-1 while visiting)
+    std::uint32_t m_uResolveGeneration = 0;
+    std::int32_t m_nResolveSlot = -1;
 };
 
 } // namespace ms
@@ -0,0 +1,126 @@
+#include "Gr2DVectorResolver.h"
+#include "Gr2DVector.h"
+
+#include <atomic>
+
+namespace ms
+{
+
+namespace
+{
+    // Shared by all resolvers so two passes never stamp the same number;
+    // 0 is never handed out and marks an unvisited vector
+    std::atomic<std::uint32_t> g_nextGeneration{1};
+} // anonymous namespace
+
+void Gr2DVectorResolver::Clear() noexcept
+{
+    m_aRoot.clear();
+}
+
+void Gr2DVectorResolver::Add(Gr2DVector* vec)
+{
+    if (vec)
+        m_aRoot.push_back(vec);
+}
+
+void Gr2DVectorResolver::Add(IWzVector2D* vec)
+{
+    if (vec)
+        Add(vec->GetResolveTarget());
+}
+
+void Gr2DVectorResolver::Resolve(std::int32_t tCur)
+{
+    Gr2DTime::SetCurrentTime(tCur);
+
+    m_uGeneration = g_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+    if (m_uGeneration == 0)
+        m_uGeneration = g_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+
+    m_aOrder.clear();
+    m_aResolved.clear();
+    for (auto* vec : m_aRoot)
+        Visit(vec);
+
+    // Dependencies are already cached when their dependents evaluate, so
+    // each chain's parent query is a cache hit rather than a cascade
+    for (std::size_t i = 0; i < m_aOrder.size(); ++i)
+    {
+        auto& out = m_aResolved[i];
+        m_aOrder[i]->GetSnapshot(&out.x, &out.y, nullptr, nullptr,
+                                 nullptr, nullptr, &out.a, nullptr);
+        out.flipX = m_aOrder[i]->GetFlipX();
+    }
+}
+
+auto Gr2DVectorResolver::Find(const Gr2DVector& vec) const -> const ResolvedVector*
+{
+    if (vec.m_uResolveGeneration != m_uGeneration || vec.m_nResolveSlot < 0)
+        return nullptr;
+    return &m_aResolved[static_cast<std::size_t>(vec.m_nResolveSlot)];
+}
+
+auto Gr2DVectorResolver::IsComplete(const Gr2DVector& vec) const -> bool
+{
+    const auto* resolved = Find(vec);
+    return resolved && resolved->complete;
+}
+
+// Depth-first, appending in post-order. A vector met again while still on
+// the stack (an origin cycle) is left where it is rather than looping, and
+// counts as incomplete. Returns whether vec is complete.
+auto Gr2DVectorResolver::Visit(Gr2DVector* vec) -> bool
+{
+    if (vec->m_uResolveGeneration == m_uGeneration)
+        return vec->m_nResolveSlot >= 0
+            && m_aResolved[static_cast<std::size_t>(vec->m_nResolveSlot)].complete;
+
+    vec->m_uResolveGeneration = m_uGeneration;
+    vec->m_nResolveSlot = -1;
+
+    bool complete = true;
+    if (const AnimChain* c = vec->Chain())
+    {
+        complete &= VisitDependency(c->parent_ref);
+        for (const AnimNode* n = c->head; n; n = n->next)
+        {
+            switch (n->type())
+            {
+            case 0x000A0001:  // RatioNode
+                complete &= VisitDependency(static_cast<const RatioNode*>(n)->target);
+                break;
+            case 0x00140002:  // WrapClipNode
+                complete &= VisitDependency(static_cast<const WrapClipNode*>(n)->bounds);
+                break;
+            case 0x00320000:  // FlyNode
+            {
+                const auto* fly = static_cast<const FlyNode*>(n);
+                for (const auto& key : fly->keyframes)
+                    complete &= VisitDependency(key.point);
+                complete &= VisitDependency(fly->completion);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    vec->m_nResolveSlot = static_cast<std::int32_t>(m_aOrder.size());
+    m_aOrder.push_back(vec);
+    m_aResolved.push_back({.complete = complete});
+    return complete;
+}
+
+auto Gr2DVectorResolver::VisitDependency(IWzVector2D* dep) -> bool
+{
+    if (!dep)
+        return true;
+
+    // Opaque implementations (VecCtrl, ...) are evaluated by whoever reads them
+    auto* vec = dep->GetResolveTarget();
+    return vec && Visit(vec);
+}
+
+} // namespace ms
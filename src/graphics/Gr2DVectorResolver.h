@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ms
+{
+
+class Gr2DVector;
+class IWzVector2D;
+
+/**
+ * @brief Transform of one vector as evaluated by a resolver pass
+ */
+struct ResolvedVector
+{
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    double a = 0.0;
+    bool flipX = false;
+    bool complete = true;  ///< Everything the vector reads was ordered by the pass
+};
+
+/**
+ * @brief Once-per-frame evaluation of a set of Gr2DVectors and their origins
+ *
+ * Consumers reach the same parents from many places (layer -> avatar
+ * origin -> VecCtrl -> camera), and each of them used to walk the origin
+ * chain through virtual GetX/GetY calls. Resolve() instead orders every
+ * added vector together with everything it reads (origin, Ratio/WrapClip
+ * targets, Fly points) so that dependencies come first, then evaluates
+ * each exactly once in that order into a flat array.
+ *
+ * Each pass takes a new generation number, stamped on the vectors it
+ * visits; that doubles as the visited mark, so building the order needs no
+ * lookup table. Afterwards GetX/GetY on any visited vector hit the chain
+ * cache, and Find() reads the pass result directly. Results describe the
+ * vectors as of Resolve(); later edits are not reflected in them.
+ *
+ * Dependencies that are not Gr2DVectors (VecCtrl, ...) can't be ordered and
+ * are evaluated by whoever reads them. Vectors that reach one, directly or
+ * through another vector, are marked incomplete: reading them still walks
+ * into the opaque parent, so they must not be read from several threads.
+ *
+ * Storage is reused across frames.
+ */
+class Gr2DVectorResolver
+{
+public:
+    /// Drop the vectors added for the previous pass (keeps capacity)
+    void Clear() noexcept;
+
+    /// Add a vector to resolve; null is ignored
+    void Add(Gr2DVector* vec);
+
+    /// Add the Gr2DVector behind an interface pointer, if it has one
+    void Add(IWzVector2D* vec);
+
+    /**
+     * @brief Set Gr2DTime to tCur and evaluate every added vector
+     *
+     * Runs on one thread; FlyNode completions and other committed changes
+     * happen here, not in later readers.
+     */
+    void Resolve(std::int32_t tCur);
+
+    /// Result for vec from the latest pass, or nullptr if it was not part of it
+    [[nodiscard]] auto Find(const Gr2DVector& vec) const -> const ResolvedVector*;
+
+    /// Whether vec was part of the latest pass and reads nothing opaque
+    [[nodiscard]] auto IsComplete(const Gr2DVector& vec) const -> bool;
+
+    /// Vectors of the latest pass, dependencies before dependents
+    [[nodiscard]] auto GetOrder() const noexcept -> const std::vector<Gr2DVector*>& { return m_aOrder; }
+
+    /// Results of the latest pass, parallel to GetOrder()
+    [[nodiscard]] auto GetResolved() const noexcept -> const std::vector<ResolvedVector>& { return m_aResolved; }
+
+    [[nodiscard]] auto GetGeneration() const noexcept -> std::uint32_t { return m_uGeneration; }
+
+private:
+    auto Visit(Gr2DVector* vec) -> bool;
+    auto VisitDependency(IWzVector2D* dep) -> bool;
+
+    std::vector<Gr2DVector*> m_aRoot;
+    std::vector<Gr2DVector*> m_aOrder;
+    std::vector<ResolvedVector> m_aResolved;
+    std::uint32_t m_uGeneration = 0;
+};
+
+} // namespace ms
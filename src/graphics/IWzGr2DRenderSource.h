@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+struct SDL_Renderer;
+
+namespace ms
+{
+
+class WzGr2DRenderList;
+
+/**
+ * @brief Something that draws straight into the frame's render list
+ *
+ * For content that is not worth a layer per item (floating damage numbers
+ * and the like): the source writes its quads itself, once per frame, in
+ * the layer z-order. See WzGr2D::AddRenderSource.
+ */
+class IWzGr2DRenderSource
+{
+public:
+    virtual ~IWzGr2DRenderSource() = default;
+
+    /// Drawn after the layers whose z is not above this
+    [[nodiscard]] virtual auto GetZ() const -> std::int32_t = 0;
+
+    /**
+     * @brief Append this frame's quads
+     * @param renderer SDL renderer, or nullptr when building off the render thread
+     * @param tCur Frame time
+     * @param offsetX World to screen offset
+     * @param offsetY World to screen offset
+     */
+    virtual void CollectRenderItems(WzGr2DRenderList& list, SDL_Renderer* renderer,
+                                    std::int32_t tCur,
+                                    std::int32_t offsetX, std::int32_t offsetY) = 0;
+};
+
+} // namespace ms
@@ -10,6 +10,7 @@ namespace ms
 
 // Forward declare for FlyKeyframe
 class IWzVector2D;
+class Gr2DVector;
 
 /**
  * @brief Keyframe for Fly (cubic Hermite spline) animation
@@ -102,6 +103,12 @@ public:
     // --- Fly (spline animation) ---
     virtual void Fly(const std::vector<FlyKeyframe>& keyframes,
                      IWzVector2D* completionTarget = nullptr) = 0;
+
+    // --- Not in the original interface ---
+
+    /// Gr2DVector holding this vector's state, so Gr2DVectorResolver can
+    /// order it; nullptr for implementations it must treat as opaque
+    [[nodiscard]] virtual auto GetResolveTarget() -> Gr2DVector* { return nullptr; }
 };
 
 } // namespace ms
@@ -1,12 +1,20 @@
 #include "VecCtrl.h"
 
 #include "app/Application.h"
+#include "physics/VecCtrlWorld.h"
 
 namespace ms
 {
 
 VecCtrl::VecCtrl() = default;
 
+VecCtrl::~VecCtrl()
+{
+    // Cleared by the world when it goes first, e.g. during static destruction
+    if (m_bInWorld)
+        VecCtrlWorld::GetInstance().Unregister(this);
+}
+
 // =============================================================================
 // IWzShape2D — CVecCtrl manages its own position via AbsPosEx
 // =============================================================================
@@ -87,10 +95,11 @@ void VecCtrl::Scale(std::int32_t sx, std::int32_t divx,
     Move(newX, newY);
 }
 
-// CVecCtrl::raw_Init — delegates to Move
+// CVecCtrl::raw_Init — delegates to Move; from here on the world steps it
 void VecCtrl::Init(std::int32_t x, std::int32_t y)
 {
     Move(x, y);
+    VecCtrlWorld::GetInstance().Register(this);
 }
 
 // =============================================================================
@@ -33,13 +33,13 @@ class VecCtrl : public IWzVector2D
 {
 public:
     VecCtrl();
-    ~VecCtrl() override = default;
+    ~VecCtrl() override;
 
-    // Non-copyable, movable
+    // Non-copyable, non-movable: VecCtrlWorld holds it by address
     VecCtrl(const VecCtrl&) = delete;
     auto operator=(const VecCtrl&) -> VecCtrl& = delete;
-    VecCtrl(VecCtrl&&) noexcept = default;
-    auto operator=(VecCtrl&&) noexcept -> VecCtrl& = default;
+    VecCtrl(VecCtrl&&) = delete;
+    auto operator=(VecCtrl&&) -> VecCtrl& = delete;
 
     // === Inner types ===
 
@@ -167,6 +167,7 @@ public:
     // === Core state ===
     std::int32_t m_bActive{};
     IWzVector2D* m_pVecAlternate{};
+    bool m_bInWorld{}; ///< Registered with VecCtrlWorld (set by it)
 
     // === Position ===
     AbsPosEx m_ap;
@@ -1,6 +1,7 @@
 #include "WzGr2D.h"
 #include "WzGr2DLayer.h"
 #include "WzGr2DCanvas.h"
+#include "util/JobSystem.h"
 
 #ifdef MS_DEBUG_CANVAS
 #include "debug/DebugOverlay.h"
@@ -8,6 +9,7 @@
 
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <iterator>
 
 namespace ms
 {
@@ -100,6 +102,8 @@ auto WzGr2D::Initialize(std::uint32_t width, std::uint32_t height,
     // Set blend mode for alpha blending
     SDL_SetRenderDrawBlendMode(m_pRenderer, SDL_BLENDMODE_BLEND);
 
+    UpdateViewport();
+
     m_bInitialized = true;
     m_tCurrent = static_cast<std::int32_t>(SDL_GetTicks());
     m_tLastFrame = m_tCurrent;
@@ -123,6 +127,10 @@ void WzGr2D::Shutdown()
     // Clear all layers
     RemoveAllLayers();
 
+    // Textures still queued between the threads go before the renderer
+    m_bThreadedRender = false;
+    FlushTextureQueues();
+
     // Destroy renderer
     if (m_pRenderer)
     {
@@ -183,25 +191,112 @@ auto WzGr2D::CreateLayer(std::int32_t left, std::int32_t top,
     }
 
     // Insert layer maintaining Z-order
-    m_layers.push_back(layer);
-    m_bLayersDirty = true;
+    const LayerKey key{z, m_nLayerSerial++};
+    m_layers.emplace(key, layer);
+    m_mLayerKey.emplace(layer.get(), key);
+    ++m_nLayerVersion;
 
     return layer;
 }
 
 void WzGr2D::RemoveLayer(const std::shared_ptr<WzGr2DLayer>& layer)
 {
-    auto it = std::find(m_layers.begin(), m_layers.end(), layer);
-    if (it != m_layers.end())
+    auto itKey = m_mLayerKey.find(layer.get());
+    if (itKey == m_mLayerKey.end())
+    {
+        return;
+    }
+
+    m_layers.erase(itKey->second);
+    m_mLayerKey.erase(itKey);
+    ++m_nLayerVersion;
+}
+
+auto WzGr2D::CreateEffectLayer(std::int32_t left, std::int32_t top,
+                               std::uint32_t width, std::uint32_t height,
+                               std::int32_t z) -> std::shared_ptr<WzGr2DLayer>
+{
+    auto layer = m_layerPool.Acquire(left, top, width, height, z);
+    const LayerKey key{z, m_nLayerSerial++};
+
+    if (m_aFreeLayerNode.empty() || m_aFreeLayerKeyNode.empty())
+    {
+        m_layers.emplace(key, layer);
+        m_mLayerKey.emplace(layer.get(), key);
+    }
+    else
+    {
+        auto node = std::move(m_aFreeLayerNode.back());
+        m_aFreeLayerNode.pop_back();
+        node.key() = key;
+        node.mapped() = layer;
+        m_layers.insert(std::move(node));
+
+        auto keyNode = std::move(m_aFreeLayerKeyNode.back());
+        m_aFreeLayerKeyNode.pop_back();
+        keyNode.key() = layer.get();
+        keyNode.mapped() = key;
+        m_mLayerKey.insert(std::move(keyNode));
+    }
+    ++m_nLayerVersion;
+
+    return layer;
+}
+
+void WzGr2D::RecycleLayer(std::shared_ptr<WzGr2DLayer> layer)
+{
+    auto keyNode = m_mLayerKey.extract(layer.get());
+    if (keyNode.empty())
+    {
+        return;
+    }
+
+    auto node = m_layers.extract(keyNode.mapped());
+    node.mapped().reset();
+    ++m_nLayerVersion;
+
+    if (m_layerPool.Release(std::move(layer)))
+    {
+        m_aFreeLayerNode.push_back(std::move(node));
+        m_aFreeLayerKeyNode.push_back(std::move(keyNode));
+    }
+}
+
+void WzGr2D::AddRenderSource(std::shared_ptr<IWzGr2DRenderSource> pSource)
+{
+    if (!pSource)
     {
-        m_layers.erase(it);
+        return;
     }
+
+    const auto z = pSource->GetZ();
+    auto it = std::upper_bound(m_apRenderSource.begin(), m_apRenderSource.end(), z,
+                               [](std::int32_t nZ, const auto& p) { return nZ < p->GetZ(); });
+    m_apRenderSource.insert(it, std::move(pSource));
+}
+
+void WzGr2D::RemoveRenderSource(const IWzGr2DRenderSource* pSource)
+{
+    std::erase_if(m_apRenderSource, [pSource](const auto& p) { return p.get() == pSource; });
+}
+
+void WzGr2D::RefreshLayerZ(const std::shared_ptr<WzGr2DLayer>& layer)
+{
+    auto itKey = m_mLayerKey.find(layer.get());
+    if (itKey == m_mLayerKey.end() || itKey->second.z == layer->GetZ())
+    {
+        return;
+    }
+
+    RekeyLayer(m_layers.find(itKey->second));
 }
 
 void WzGr2D::RemoveAllLayers()
 {
     m_layers.clear();
-    m_bLayersDirty = false;
+    m_mLayerKey.clear();
+    m_aZChanged.clear();
+    ++m_nLayerVersion;
 }
 
 auto WzGr2D::GetLayerCount() const noexcept -> std::size_t
@@ -225,19 +320,73 @@ auto WzGr2D::RenderFrame(std::int32_t tCur) -> bool
         return false;
     }
 
-    // Sort layers if needed
-    SortLayers();
+    // Same path as the threaded mode, with both ends on this thread
+    UpdateViewport();
+    BuildFrame(tCur, m_pRenderer, m_frameBuffer.BeginWrite());
+    m_frameBuffer.Publish();
+    DrawFrame(*m_frameBuffer.AcquireLatest());
+    return true;
+}
 
-    // Clear screen with background color
-    auto alpha = static_cast<std::uint8_t>((m_dwBackColor >> 24) & 0xFF);
-    auto red = static_cast<std::uint8_t>((m_dwBackColor >> 16) & 0xFF);
-    auto green = static_cast<std::uint8_t>((m_dwBackColor >> 8) & 0xFF);
-    auto blue = static_cast<std::uint8_t>(m_dwBackColor & 0xFF);
+void WzGr2D::SetThreadedRender(bool enable)
+{
+    if (m_bThreadedRender == enable)
+    {
+        return;
+    }
 
-    SDL_SetRenderDrawColor(m_pRenderer, red, green, blue, alpha);
-    SDL_RenderClear(m_pRenderer);
+    m_bThreadedRender = enable;
+    if (!enable)
+    {
+        FlushTextureQueues();
+    }
+}
 
-    // Update and render all layers
+auto WzGr2D::PublishFrame(std::int32_t tCur) -> bool
+{
+    if (!m_bInitialized || !m_pRenderer)
+    {
+        return false;
+    }
+
+    m_tCurrent = tCur;
+    if (tCur < GetNextRenderTime())
+    {
+        return false;
+    }
+
+    AdoptCreatedTextures();
+    BuildFrame(tCur, nullptr, m_frameBuffer.BeginWrite());
+    m_frameBuffer.Publish();
+    return true;
+}
+
+auto WzGr2D::PresentLatestFrame() -> bool
+{
+    if (!m_bInitialized || !m_pRenderer)
+    {
+        return false;
+    }
+
+    // Serve requests even without a new frame, so they land sooner
+    CreateRequestedTextures();
+
+    const auto* frame = m_frameBuffer.AcquireLatest();
+    if (!frame)
+    {
+        return false;
+    }
+
+    // Older frames will never be drawn again
+    DestroyReleasedTextures(frame->nSerial);
+
+    UpdateViewport();
+    DrawFrame(*frame);
+    return true;
+}
+
+void WzGr2D::BuildFrame(std::int32_t tCur, SDL_Renderer* renderer, WzGr2DFrame& frame)
+{
     // MapleStory uses a coordinate system where (0,0) is at screen center
     // Both world-space and screen-space layers use this center-based system
     auto screenCenterX = static_cast<std::int32_t>(m_uWidth / 2);
@@ -247,57 +396,256 @@ auto WzGr2D::RenderFrame(std::int32_t tCur) -> bool
     auto camX = m_vecCenter.GetX();
     auto camY = m_vecCenter.GetY();
 
-    for (auto& layer : m_layers)
+    const auto viewportW = m_nViewportWidth.load(std::memory_order_relaxed);
+    const auto viewportH = m_nViewportHeight.load(std::memory_order_relaxed);
+
+    // Advance animation state, partly on the job system
+    UpdateLayers(tCur);
+
+    // Gather quads in z-order, render sources between the layers
+    auto& renderList = frame.renderList;
+    renderList.Clear();
+    const auto offsetX = -camX + screenCenterX;
+    const auto offsetY = -camY + screenCenterY;
+    auto itSource = m_apRenderSource.begin();
+    const auto collectSourcesBelow = [&](std::int32_t z)
     {
+        for (; itSource != m_apRenderSource.end() && (*itSource)->GetZ() < z; ++itSource)
+        {
+            (*itSource)->CollectRenderItems(renderList, renderer, tCur, offsetX, offsetY);
+        }
+    };
+
+    for (auto it = m_layers.begin(); it != m_layers.end(); ++it)
+    {
+        const auto& layer = it->second;
+        collectSourcesBelow(it->first.z);
         if (layer)
         {
-            layer->Update(tCur);
+            if (layer->GetZ() != it->first.z)
+            {
+                m_aZChanged.push_back(it);
+            }
 
             // All layers use world-space coordinates with camera offset
-            layer->Render(m_pRenderer,
-                          -camX + screenCenterX,
-                          -camY + screenCenterY);
+            layer->CollectRenderItems(renderList, renderer,
+                                      offsetX, offsetY,
+                                      viewportW, viewportH);
         }
     }
-
-    // Apply screen tone modulation (redTone / greenBlueTone)
+    for (; itSource != m_apRenderSource.end(); ++itSource)
     {
-        const auto r = static_cast<std::uint8_t>(
-            std::clamp(m_vecRedTone.GetX(), 0, 255));
-        const auto g = static_cast<std::uint8_t>(
-            std::clamp(m_vecGreenBlueTone.GetX(), 0, 255));
-        const auto b = static_cast<std::uint8_t>(
-            std::clamp(m_vecGreenBlueTone.GetY(), 0, 255));
+        (*itSource)->CollectRenderItems(renderList, renderer, tCur, offsetX, offsetY);
+    }
 
-        if (r != 255 || g != 255 || b != 255)
-        {
-            // Multiply blend: dstRGB = srcRGB * dstRGB (with srcA=255)
-            SDL_SetRenderDrawBlendMode(m_pRenderer, SDL_BLENDMODE_MUL);
-            SDL_SetRenderDrawColor(m_pRenderer, r, g, b, 255);
+    renderList.Cull(static_cast<float>(viewportW), static_cast<float>(viewportH));
 
-            const SDL_FRect fullScreen{0.0F, 0.0F,
-                                       static_cast<float>(m_uWidth),
-                                       static_cast<float>(m_uHeight)};
-            SDL_RenderFillRect(m_pRenderer, &fullScreen);
+    // Screen tone modulation (redTone / greenBlueTone)
+    frame.dwBackColor = m_dwBackColor;
+    frame.toneR = static_cast<std::uint8_t>(std::clamp(m_vecRedTone.GetX(), 0, 255));
+    frame.toneG = static_cast<std::uint8_t>(std::clamp(m_vecGreenBlueTone.GetX(), 0, 255));
+    frame.toneB = static_cast<std::uint8_t>(std::clamp(m_vecGreenBlueTone.GetY(), 0, 255));
+    frame.tCur = tCur;
+    frame.nSerial = ++m_nFrameSerial;
 
-            // Restore default blend mode
-            SDL_SetRenderDrawBlendMode(m_pRenderer, SDL_BLENDMODE_BLEND);
-        }
+    // Move layers whose z changed this frame to their new position
+    ApplyZChanges();
+
+    m_tLastFrame = tCur;
+}
+
+void WzGr2D::DrawFrame(const WzGr2DFrame& frame)
+{
+    // Clear screen with background color
+    auto alpha = static_cast<std::uint8_t>((frame.dwBackColor >> 24) & 0xFF);
+    auto red = static_cast<std::uint8_t>((frame.dwBackColor >> 16) & 0xFF);
+    auto green = static_cast<std::uint8_t>((frame.dwBackColor >> 8) & 0xFF);
+    auto blue = static_cast<std::uint8_t>(frame.dwBackColor & 0xFF);
+
+    SDL_SetRenderDrawColor(m_pRenderer, red, green, blue, alpha);
+    SDL_RenderClear(m_pRenderer);
+
+    // Draw the items that survived culling
+    frame.renderList.Submit(m_pRenderer);
+
+    // Apply screen tone modulation
+    if (frame.toneR != 255 || frame.toneG != 255 || frame.toneB != 255)
+    {
+        // Multiply blend: dstRGB = srcRGB * dstRGB (with srcA=255)
+        SDL_SetRenderDrawBlendMode(m_pRenderer, SDL_BLENDMODE_MUL);
+        SDL_SetRenderDrawColor(m_pRenderer, frame.toneR, frame.toneG, frame.toneB, 255);
+
+        const SDL_FRect fullScreen{0.0F, 0.0F,
+                                   static_cast<float>(m_uWidth),
+                                   static_cast<float>(m_uHeight)};
+        SDL_RenderFillRect(m_pRenderer, &fullScreen);
+
+        // Restore default blend mode
+        SDL_SetRenderDrawBlendMode(m_pRenderer, SDL_BLENDMODE_BLEND);
     }
 
-    // Render debug overlay (always on top)
+    // Render debug overlay (always on top). It reads the live layers,
+    // which belong to the simulation thread in threaded mode.
 #ifdef MS_DEBUG_CANVAS
-    DebugOverlay::GetInstance().Render(m_pRenderer);
+    if (!m_bThreadedRender)
+    {
+        DebugOverlay::GetInstance().Render(m_pRenderer);
+    }
 #endif
 
     // Present
     SDL_RenderPresent(m_pRenderer);
 
     // Update FPS counter
-    UpdateFps(tCur);
+    UpdateFps(frame.tCur);
+}
 
-    m_tLastFrame = tCur;
-    return true;
+void WzGr2D::UpdateViewport()
+{
+    int viewportW = 0;
+    int viewportH = 0;
+    SDL_GetRenderOutputSize(m_pRenderer, &viewportW, &viewportH);
+
+    m_nViewportWidth.store(viewportW, std::memory_order_relaxed);
+    m_nViewportHeight.store(viewportH, std::memory_order_relaxed);
+}
+
+void WzGr2D::RequestTexture(WzGr2DCanvas& canvas)
+{
+    if (!m_bThreadedRender || canvas.m_bTextureRequested || !canvas.HasPixelData())
+    {
+        return;
+    }
+
+    // The serial tells a late result for a destroyed canvas apart from a
+    // new canvas that happens to reuse its address
+    const auto nSerial = ++m_nTextureRequestSerial;
+    m_mTextureRequest.emplace(&canvas, nSerial);
+    canvas.m_bTextureRequested = true;
+
+    std::lock_guard lock(m_mtxTexture);
+    m_aTextureRequest.push_back({&canvas, nSerial, canvas.GetCanvas(), nullptr});
+}
+
+void WzGr2D::CancelTextureRequest(WzGr2DCanvas* canvas)
+{
+    // A texture already created for it is released when it comes back
+    m_mTextureRequest.erase(canvas);
+    canvas->m_bTextureRequested = false;
+}
+
+void WzGr2D::ReleaseTexture(SDL_Texture* texture)
+{
+    if (!texture)
+    {
+        return;
+    }
+
+    if (!m_bThreadedRender)
+    {
+        SDL_DestroyTexture(texture);
+        return;
+    }
+
+    std::lock_guard lock(m_mtxTexture);
+    m_aTextureRelease.push_back({texture, m_nFrameSerial});
+}
+
+void WzGr2D::AdoptCreatedTextures()
+{
+    std::vector<TextureRequest> aCreated;
+    {
+        std::lock_guard lock(m_mtxTexture);
+        aCreated.swap(m_aTextureCreated);
+    }
+
+    for (auto& created : aCreated)
+    {
+        auto found = m_mTextureRequest.find(created.pCanvas);
+        if (found == m_mTextureRequest.end() || found->second != created.nSerial)
+        {
+            ReleaseTexture(created.pTexture);
+            continue;
+        }
+
+        // Still live: canvases cancel their request when they go away.
+        // A failed upload just clears the request, so the canvas asks again.
+        m_mTextureRequest.erase(found);
+        created.pCanvas->m_bTextureRequested = false;
+        if (created.pTexture)
+        {
+            created.pCanvas->SetTexture(created.pTexture);
+        }
+    }
+}
+
+void WzGr2D::CreateRequestedTextures()
+{
+    std::vector<TextureRequest> aRequest;
+    {
+        std::lock_guard lock(m_mtxTexture);
+        aRequest.swap(m_aTextureRequest);
+    }
+
+    if (aRequest.empty())
+    {
+        return;
+    }
+
+    // Upload without holding the lock; only the pixel source is touched
+    for (auto& request : aRequest)
+    {
+        request.pTexture = WzGr2DCanvas::CreateTextureFrom(m_pRenderer, *request.pSource);
+        request.pSource.reset();
+    }
+
+    std::lock_guard lock(m_mtxTexture);
+    m_aTextureCreated.insert(m_aTextureCreated.end(),
+                             std::make_move_iterator(aRequest.begin()),
+                             std::make_move_iterator(aRequest.end()));
+}
+
+void WzGr2D::DestroyReleasedTextures(std::uint64_t nDrawnSerial)
+{
+    std::vector<SDL_Texture*> aDestroy;
+    {
+        std::lock_guard lock(m_mtxTexture);
+        std::erase_if(m_aTextureRelease, [&](const TextureRelease& release)
+        {
+            if (release.nLastSerial >= nDrawnSerial)
+            {
+                return false;
+            }
+            aDestroy.push_back(release.pTexture);
+            return true;
+        });
+    }
+
+    for (auto* texture : aDestroy)
+    {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+void WzGr2D::FlushTextureQueues()
+{
+    // Only called with no simulation thread running
+    AdoptCreatedTextures();
+
+    std::lock_guard lock(m_mtxTexture);
+    for (const auto& release : m_aTextureRelease)
+    {
+        SDL_DestroyTexture(release.pTexture);
+    }
+    m_aTextureRelease.clear();
+    m_aTextureRequest.clear();
+
+    // Requests never served; the canvases create their textures in RenderFrame()
+    for (const auto& [canvas, nSerial] : m_mTextureRequest)
+    {
+        canvas->m_bTextureRequested = false;
+    }
+    m_mTextureRequest.clear();
 }
 
 auto WzGr2D::CheckMode(std::uint32_t width, std::uint32_t height,
@@ -346,20 +694,75 @@ void WzGr2D::UpdateFps(std::int32_t tCur)
     }
 }
 
-void WzGr2D::SortLayers()
+void WzGr2D::UpdateLayers(std::int32_t tCur)
 {
-    if (!m_bLayersDirty)
+    // Evaluate every layer's position, alpha and colour chains, and whatever
+    // those chains read, once up front; layers then only read their own
+    // cached vectors
+    m_vectorResolver.Clear();
+    for (const auto& [key, layer] : m_layers)
     {
-        return;
+        if (layer)
+        {
+            layer->AddVectors(m_vectorResolver);
+        }
+    }
+    m_vectorResolver.Resolve(tCur);
+
+    // Layers that can't be isolated (opaque parents, Clear animations)
+    // update right away, in z-order
+    m_aParallelUpdate.clear();
+    for (const auto& [key, layer] : m_layers)
+    {
+        if (!layer)
+        {
+            continue;
+        }
+
+        if (layer->PrepareUpdate(m_vectorResolver))
+        {
+            m_aParallelUpdate.push_back(layer.get());
+        }
+        else
+        {
+            layer->Update(tCur);
+        }
     }
 
-    // Sort by Z-order (lower Z = rendered first = behind)
-    std::stable_sort(m_layers.begin(), m_layers.end(),
-                     [](const auto& a, const auto& b) {
-                         return a->GetZ() < b->GetZ();
-                     });
+    // Small scenes aren't worth waking the workers for
+    constexpr std::size_t MinParallelLayers = 256;
+    constexpr std::size_t LayersPerJob = 64;
+
+    const auto count = m_aParallelUpdate.size();
+    const auto grain = count >= MinParallelLayers ? LayersPerJob : count;
+    JobSystem::GetInstance().ParallelFor(count, grain,
+        [this, tCur](std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                m_aParallelUpdate[i]->Update(tCur);
+            }
+        });
+}
 
-    m_bLayersDirty = false;
+void WzGr2D::RekeyLayer(LayerList::iterator it)
+{
+    // Re-link the node under the new z; the serial keeps equal-z layers
+    // in creation order (lower Z = rendered first = behind)
+    auto node = m_layers.extract(it);
+    node.key().z = node.mapped()->GetZ();
+    m_mLayerKey[node.mapped().get()] = node.key();
+    m_layers.insert(std::move(node));
+    ++m_nLayerVersion;
+}
+
+void WzGr2D::ApplyZChanges()
+{
+    for (auto it : m_aZChanged)
+    {
+        RekeyLayer(it);
+    }
+    m_aZChanged.clear();
 }
 
 } // namespace ms
@@ -1,21 +1,32 @@
 #pragma once
 
 #include "Gr2DVector.h"
+#include "Gr2DVectorResolver.h"
+#include "IWzGr2DRenderSource.h"
+#include "WzGr2DAnimationClip.h"
+#include "WzGr2DFrame.h"
+#include "WzGr2DLayerPool.h"
 #include "WzGr2DTypes.h"
 #include "util/Point.h"
 #include "util/Singleton.h"
 
+#include <atomic>
+#include <compare>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 struct SDL_Window;
 struct SDL_Renderer;
+struct SDL_Texture;
 
 namespace ms
 {
 
+class WzCanvas;
 class WzGr2DCanvas;
 class WzGr2DLayer;
 
@@ -33,6 +44,23 @@ class WzGr2D : public Singleton<WzGr2D>
     friend class Singleton<WzGr2D>;
 
 public:
+    /**
+     * @brief Render-order key of a layer
+     *
+     * Layers with equal z keep their creation order through the serial,
+     * which gives the same result as a stable sort by z.
+     */
+    struct LayerKey
+    {
+        std::int32_t z{};
+        std::uint64_t serial{};
+
+        auto operator<=>(const LayerKey&) const = default;
+    };
+
+    /// Layers in render order (lower z first). Insert/remove are O(log n).
+    using LayerList = std::map<LayerKey, std::shared_ptr<WzGr2DLayer>>;
+
     ~WzGr2D();
 
     /**
@@ -100,27 +128,80 @@ public:
      */
     void RemoveLayer(const std::shared_ptr<WzGr2DLayer>& layer);
 
+    /**
+     * @brief CreateLayer for short-lived layers, reusing recycled ones
+     *
+     * Pair with RecycleLayer. Once enough layers have been recycled, neither
+     * the layer nor its place in the render order is allocated anew.
+     */
+    [[nodiscard]] auto CreateEffectLayer(std::int32_t left, std::int32_t top,
+                                         std::uint32_t width, std::uint32_t height,
+                                         std::int32_t z) -> std::shared_ptr<WzGr2DLayer>;
+
+    /**
+     * @brief Remove a layer and keep it for CreateEffectLayer
+     *
+     * The layer is only reused if the caller's reference was the last one
+     * outside the render list; otherwise this is RemoveLayer.
+     */
+    void RecycleLayer(std::shared_ptr<WzGr2DLayer> layer);
+
     /**
      * @brief Remove all layers
      */
     void RemoveAllLayers();
 
+    /**
+     * @brief Re-position a layer in the render order after its z changed
+     *
+     * RenderFrame picks up z changes by itself (from the next frame on);
+     * call this to apply a put_z() immediately. O(log n).
+     * @param layer Layer whose z was changed
+     */
+    void RefreshLayerZ(const std::shared_ptr<WzGr2DLayer>& layer);
+
+    /**
+     * @brief Draw a render source among the layers, by its z, from the next frame on
+     *
+     * The z is read once here. Sources of equal z keep the order they were
+     * added in.
+     */
+    void AddRenderSource(std::shared_ptr<IWzGr2DRenderSource> pSource);
+    void RemoveRenderSource(const IWzGr2DRenderSource* pSource);
+
     /**
      * @brief Get layer count
      */
     [[nodiscard]] auto GetLayerCount() const noexcept -> std::size_t;
 
-    [[nodiscard]] auto GetLayerList() const noexcept
-        -> const std::vector<std::shared_ptr<WzGr2DLayer>>&
+    [[nodiscard]] auto GetLayerList() const noexcept -> const LayerList&
     {
         return m_layers;
     }
-    [[nodiscard]] auto GetLayerList() noexcept
-        -> std::vector<std::shared_ptr<WzGr2DLayer>>&
+
+    /**
+     * @brief Counter bumped whenever the layer order changes
+     *
+     * Changes on create, remove and re-key; callers that cache something
+     * derived from GetLayerList() compare it to know when to re-check.
+     */
+    [[nodiscard]] auto GetLayerVersion() const noexcept -> std::uint64_t
     {
-        return m_layers;
+        return m_nLayerVersion;
     }
 
+    /**
+     * @brief Shared animation clips, one per source property
+     *
+     * Layers that play the same WZ animation take their frames from here
+     * instead of building their own canvases.
+     */
+    [[nodiscard]] auto GetClipCache() noexcept -> WzGr2DAnimationClipCache& { return m_clipCache; }
+
+    /// Layers kept by RecycleLayer
+    [[nodiscard]] auto GetLayerPool() noexcept -> WzGr2DLayerPool& { return m_layerPool; }
+    [[nodiscard]] auto GetLayerPool() const noexcept -> const WzGr2DLayerPool& { return m_layerPool; }
+
     // Rendering
     /**
      * @brief Render a single frame
@@ -129,6 +210,61 @@ public:
      */
     [[nodiscard]] auto RenderFrame(std::int32_t tCur) -> bool;
 
+    // Threaded rendering
+    //
+    // The simulation thread builds frames with PublishFrame() and the thread
+    // that owns the renderer draws them with PresentLatestFrame(). Layers are
+    // only ever touched by the simulation thread; textures are created and
+    // destroyed on the render thread through the request/release queues below.
+
+    /**
+     * @brief Switch between RenderFrame() and the PublishFrame/PresentLatestFrame pair
+     *
+     * Call while no simulation thread is running; switching off flushes all
+     * pending texture requests and releases.
+     */
+    void SetThreadedRender(bool enable);
+    [[nodiscard]] auto IsThreadedRender() const noexcept -> bool { return m_bThreadedRender; }
+
+    /**
+     * @brief Build a frame snapshot and hand it to the render thread
+     * @param tCur Current time in milliseconds
+     * @return true if a frame was published (false until the next frame is due)
+     *
+     * Simulation thread. Makes no SDL calls.
+     */
+    [[nodiscard]] auto PublishFrame(std::int32_t tCur) -> bool;
+
+    /**
+     * @brief Draw and present the latest published frame
+     * @return true if a new frame was presented
+     *
+     * Render thread. Also serves texture requests and destroys released
+     * textures no published frame can reference any more.
+     */
+    [[nodiscard]] auto PresentLatestFrame() -> bool;
+
+    /**
+     * @brief Ask the render thread for a canvas' texture (threaded mode)
+     *
+     * The texture is attached to the canvas at the start of a later
+     * PublishFrame(); until then the canvas is not drawn.
+     */
+    void RequestTexture(WzGr2DCanvas& canvas);
+
+    /// Drop a pending RequestTexture() for a canvas that is going away
+    void CancelTextureRequest(WzGr2DCanvas* canvas);
+
+    /// Canvases waiting for the render thread to create their texture
+    [[nodiscard]] auto GetTextureRequestCount() const noexcept -> std::size_t { return m_mTextureRequest.size(); }
+
+    /**
+     * @brief Destroy a texture once no frame in flight can still draw it
+     *
+     * Destroys immediately when not in threaded mode.
+     */
+    void ReleaseTexture(SDL_Texture* texture);
+
     /**
      * @brief Check display mode support
      * @param width Desired width
@@ -186,8 +322,17 @@ protected:
     WzGr2D();
 
 private:
+    void BuildFrame(std::int32_t tCur, SDL_Renderer* renderer, WzGr2DFrame& frame);
+    void DrawFrame(const WzGr2DFrame& frame);
+    void UpdateViewport();
     void UpdateFps(std::int32_t tCur);
-    void SortLayers();
+    void UpdateLayers(std::int32_t tCur);
+    void AdoptCreatedTextures();
+    void CreateRequestedTextures();
+    void DestroyReleasedTextures(std::uint64_t nDrawnSerial);
+    void FlushTextureQueues();
+    void RekeyLayer(LayerList::iterator it);
+    void ApplyZChanges();
 
     // Initialization state
     bool m_bInitialized{false};
@@ -208,13 +353,68 @@ private:
     std::int32_t m_tCurrent{0};
     std::int32_t m_tLastFrame{0};
     std::int32_t m_nTargetFrameTime{16}; // ~60 FPS
-    std::uint32_t m_uFps100{6000};       // FPS * 100 for precision
+    std::atomic<std::uint32_t> m_uFps100{6000}; // FPS * 100 for precision
     std::int32_t m_nFrameCount{0};
     std::int32_t m_tFpsUpdateTime{0};
 
-    // Layers (sorted by Z-order)
-    std::vector<std::shared_ptr<WzGr2DLayer>> m_layers;
-    bool m_bLayersDirty{false};
+    // Layers (ordered by Z-order, then creation order)
+    LayerList m_layers;
+    std::unordered_map<const WzGr2DLayer*, LayerKey> m_mLayerKey;
+    std::uint64_t m_nLayerSerial{0};
+    std::uint64_t m_nLayerVersion{0};
+
+    // Drawn between the layers, sorted by z
+    std::vector<std::shared_ptr<IWzGr2DRenderSource>> m_apRenderSource;
+
+    // Recycled layers and the render-order nodes they were registered with
+    WzGr2DLayerPool m_layerPool;
+    std::vector<LayerList::node_type> m_aFreeLayerNode;
+    std::vector<decltype(m_mLayerKey)::node_type> m_aFreeLayerKeyNode;
+
+    // Animation clips shared between layers
+    WzGr2DAnimationClipCache m_clipCache;
+
+    // Position, alpha and colour vectors of all layers, evaluated once per
+    // UpdateLayers()
+    Gr2DVectorResolver m_vectorResolver;
+
+    // Layers updated on the job system this frame
+    std::vector<WzGr2DLayer*> m_aParallelUpdate;
+
+    // Layers whose z no longer matches their key, collected during render
+    std::vector<LayerList::iterator> m_aZChanged;
+
+    // Frames built from the layers; RenderFrame() goes through them too
+    WzGr2DFrameBuffer m_frameBuffer;
+    std::uint64_t m_nFrameSerial{0};
+
+    // Renderer output size, refreshed by the render thread before drawing
+    std::atomic<std::int32_t> m_nViewportWidth{0};
+    std::atomic<std::int32_t> m_nViewportHeight{0};
+
+    // Threaded rendering: texture work handed between the two threads
+    struct TextureRequest
+    {
+        WzGr2DCanvas* pCanvas = nullptr;
+        std::uint64_t nSerial = 0;
+        std::shared_ptr<WzCanvas> pSource; // Keeps the pixels alive meanwhile
+        SDL_Texture* pTexture = nullptr;   // Filled in by the render thread
+    };
+
+    struct TextureRelease
+    {
+        SDL_Texture* pTexture = nullptr;
+        std::uint64_t nLastSerial = 0; // Last frame that may still draw it
+    };
+
+    bool m_bThreadedRender{false};
+    std::unordered_map<WzGr2DCanvas*, std::uint64_t> m_mTextureRequest; // Simulation only
+    std::uint64_t m_nTextureRequestSerial{0};
+
+    std::mutex m_mtxTexture; // Guards the three queues below
+    std::vector<TextureRequest> m_aTextureRequest;
+    std::vector<TextureRequest> m_aTextureCreated;
+    std::vector<TextureRelease> m_aTextureRelease;
 
     // Camera center vector (matches original IWzGr2D::m_center / get_center property)
     Gr2DVector m_vecCenter;
@@ -0,0 +1,105 @@
+#include "WzGr2DAnimationClip.h"
+#include "WzGr2DCanvas.h"
+#include "wz/WzProperty.h"
+
+#include <algorithm>
+#include <string>
+
+namespace ms
+{
+
+auto WzGr2DAnimationClip::Load(const std::shared_ptr<WzProperty>& prop)
+    -> std::shared_ptr<const WzGr2DAnimationClip>
+{
+    if (!prop)
+    {
+        return nullptr;
+    }
+
+    auto pClip = std::make_shared<WzGr2DAnimationClip>();
+
+    // Numbered children (0, 1, 2, ...) until the first gap
+    for (std::size_t i = 0;; ++i)
+    {
+        auto frameProp = prop->GetChild(std::to_string(i));
+        if (!frameProp)
+        {
+            break;
+        }
+
+        auto wzCanvas = frameProp->GetCanvas();
+        if (!wzCanvas)
+        {
+            continue;
+        }
+
+        Frame frame;
+        frame.pCanvas = std::make_shared<WzGr2DCanvas>(wzCanvas, frameProp);
+
+        if (auto delayProp = frameProp->GetChild("delay"))
+        {
+            frame.nDelay = delayProp->GetInt(100);
+        }
+        if (auto a0Prop = frameProp->GetChild("a0"))
+        {
+            frame.nAlpha0 = static_cast<std::uint8_t>(std::clamp(a0Prop->GetInt(255), 0, 255));
+        }
+        if (auto a1Prop = frameProp->GetChild("a1"))
+        {
+            frame.nAlpha1 = static_cast<std::uint8_t>(std::clamp(a1Prop->GetInt(255), 0, 255));
+        }
+
+        pClip->m_nTotalDelay += frame.nDelay;
+        pClip->m_aFrame.push_back(std::move(frame));
+    }
+
+    return pClip;
+}
+
+auto WzGr2DAnimationClipCache::Get(const std::shared_ptr<WzProperty>& prop)
+    -> std::shared_ptr<const WzGr2DAnimationClip>
+{
+    if (!prop)
+    {
+        return nullptr;
+    }
+
+    auto& entry = m_mEntry[prop.get()];
+    if (entry.pSource.lock() == prop)
+    {
+        if (auto pClip = entry.pClip.lock())
+        {
+            ++m_nHit;
+            return pClip;
+        }
+    }
+
+    ++m_nMiss;
+    auto pClip = WzGr2DAnimationClip::Load(prop);
+    entry.pSource = prop;
+    entry.pClip = pClip;
+
+    // Amortised sweep of dead entries
+    if (m_mEntry.size() >= m_nPruneAt)
+    {
+        Prune();
+        m_nPruneAt = m_mEntry.size() * 2 + 64;
+    }
+    return pClip;
+}
+
+void WzGr2DAnimationClipCache::Prune()
+{
+    std::erase_if(m_mEntry, [](const auto& kv)
+    {
+        return kv.second.pClip.expired() || kv.second.pSource.expired();
+    });
+}
+
+void WzGr2DAnimationClipCache::Clear()
+{
+    m_mEntry.clear();
+    m_nPruneAt = 64;
+}
+
+} // namespace ms
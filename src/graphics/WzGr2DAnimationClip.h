@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ms
+{
+
+class WzGr2DCanvas;
+class WzProperty;
+
+/**
+ * @brief Immutable frame sequence loaded once from a WZ animation property
+ *
+ * Holds the canvases, delays and alpha ramps of a numbered-frame property
+ * ("0", "1", ... each with delay/a0/a1/origin). Every layer that plays the
+ * clip points its frames at the same canvases, so identical map objects
+ * share one set of canvas wrappers and textures; the layer itself keeps
+ * only the per-instance playback state (current frame, timer, position).
+ * See WzGr2DLayer::InsertClip.
+ */
+class WzGr2DAnimationClip
+{
+public:
+    struct Frame
+    {
+        std::shared_ptr<WzGr2DCanvas> pCanvas;
+        std::int32_t nDelay{100};
+        std::uint8_t nAlpha0{255};
+        std::uint8_t nAlpha1{255};
+    };
+
+    /// Read the numbered frames of prop; frames without a canvas are skipped
+    [[nodiscard]] static auto Load(const std::shared_ptr<WzProperty>& prop)
+        -> std::shared_ptr<const WzGr2DAnimationClip>;
+
+    [[nodiscard]] auto GetFrames() const noexcept -> const std::vector<Frame>& { return m_aFrame; }
+    [[nodiscard]] auto GetFrameCount() const noexcept -> std::size_t { return m_aFrame.size(); }
+    [[nodiscard]] auto GetTotalDelay() const noexcept -> std::int32_t { return m_nTotalDelay; }
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_aFrame.empty(); }
+
+private:
+    std::vector<Frame> m_aFrame;
+    std::int32_t m_nTotalDelay{0};
+};
+
+/**
+ * @brief Clips by source property, alive as long as some layer uses them
+ *
+ * Entries hold the clip weakly: the last layer playing a clip frees it, so
+ * the cache never pins the canvases of objects that left the map. The
+ * source property is held weakly too and checked on lookup, so a property
+ * reloaded at a recycled address is not mistaken for the old one.
+ *
+ * Not thread-safe; used on the thread that loads maps and effects.
+ */
+class WzGr2DAnimationClipCache
+{
+public:
+    /// Shared clip for prop, loading it on first use; null only for a null prop
+    [[nodiscard]] auto Get(const std::shared_ptr<WzProperty>& prop)
+        -> std::shared_ptr<const WzGr2DAnimationClip>;
+
+    /// Drop entries whose clip or property has gone away
+    void Prune();
+
+    void Clear();
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_mEntry.size(); }
+    [[nodiscard]] auto GetHitCount() const noexcept -> std::uint64_t { return m_nHit; }
+    [[nodiscard]] auto GetMissCount() const noexcept -> std::uint64_t { return m_nMiss; }
+
+private:
+    struct Entry
+    {
+        std::weak_ptr<WzProperty> pSource;
+        std::weak_ptr<const WzGr2DAnimationClip> pClip;
+    };
+
+    std::unordered_map<const WzProperty*, Entry> m_mEntry;
+    std::size_t m_nPruneAt{64};
+    std::uint64_t m_nHit{0};
+    std::uint64_t m_nMiss{0};
+};
+
+} // namespace ms
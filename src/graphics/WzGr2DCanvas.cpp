@@ -1,4 +1,5 @@
 #include "WzGr2DCanvas.h"
+#include "WzGr2D.h"
 #include "wz/WzProperty.h"
 #include <utility>
 
@@ -26,11 +27,29 @@ WzGr2DCanvas::WzGr2DCanvas(std::shared_ptr<WzCanvas> canvas,
     }
 }
 
+WzGr2DCanvas::WzGr2DCanvas(SDL_Texture* texture, int width, int height)
+    : m_pTexture(texture)
+    , m_nTextureWidth(width)
+    , m_nTextureHeight(height)
+{
+}
+
 WzGr2DCanvas::~WzGr2DCanvas()
 {
+    DropTexture();
+}
+
+void WzGr2DCanvas::DropTexture()
+{
+    // Through WzGr2D, which defers both while frames are drawn on another thread
+    if (m_bTextureRequested)
+    {
+        get_gr().CancelTextureRequest(this);
+    }
+
     if (m_pTexture)
     {
-        SDL_DestroyTexture(m_pTexture);
+        get_gr().ReleaseTexture(m_pTexture);
         m_pTexture = nullptr;
     }
 }
@@ -41,7 +60,15 @@ WzGr2DCanvas::WzGr2DCanvas(WzGr2DCanvas&& other) noexcept
     , m_origin(other.m_origin)
     , m_nZ(other.m_nZ)
     , m_pTexture(other.m_pTexture)
+    , m_nTextureWidth(other.m_nTextureWidth)
+    , m_nTextureHeight(other.m_nTextureHeight)
 {
+    // A pending request is keyed by address; this canvas asks again
+    if (other.m_bTextureRequested)
+    {
+        get_gr().CancelTextureRequest(&other);
+    }
+
     other.m_nZ = 0;
     other.m_pTexture = nullptr;
 }
@@ -51,9 +78,10 @@ auto WzGr2DCanvas::operator=(WzGr2DCanvas&& other) noexcept -> WzGr2DCanvas&
     if (this != &other)
     {
         // Clean up existing texture
-        if (m_pTexture)
+        DropTexture();
+        if (other.m_bTextureRequested)
         {
-            SDL_DestroyTexture(m_pTexture);
+            get_gr().CancelTextureRequest(&other);
         }
 
         m_canvas = std::move(other.m_canvas);
@@ -61,6 +89,8 @@ auto WzGr2DCanvas::operator=(WzGr2DCanvas&& other) noexcept -> WzGr2DCanvas&
         m_origin = other.m_origin;
         m_nZ = other.m_nZ;
         m_pTexture = other.m_pTexture;
+        m_nTextureWidth = other.m_nTextureWidth;
+        m_nTextureHeight = other.m_nTextureHeight;
 
         other.m_nZ = 0;
         other.m_pTexture = nullptr;
@@ -73,42 +103,55 @@ void WzGr2DCanvas::SetCanvas(std::shared_ptr<WzCanvas> canvas)
     m_canvas = std::move(canvas);
 
     // Invalidate texture when canvas changes
-    if (m_pTexture)
-    {
-        SDL_DestroyTexture(m_pTexture);
-        m_pTexture = nullptr;
-    }
+    DropTexture();
 }
 
 auto WzGr2DCanvas::GetWidth() const noexcept -> int
 {
-    return m_canvas ? m_canvas->GetWidth() : 0;
+    return m_canvas ? m_canvas->GetWidth() : m_nTextureWidth;
 }
 
 auto WzGr2DCanvas::GetHeight() const noexcept -> int
 {
-    return m_canvas ? m_canvas->GetHeight() : 0;
+    return m_canvas ? m_canvas->GetHeight() : m_nTextureHeight;
 }
 
 void WzGr2DCanvas::SetTexture(SDL_Texture* texture)
 {
     if (m_pTexture && m_pTexture != texture)
     {
-        SDL_DestroyTexture(m_pTexture);
+        get_gr().ReleaseTexture(m_pTexture);
     }
     m_pTexture = texture;
 }
 
+auto WzGr2DCanvas::DetachTexture() noexcept -> SDL_Texture*
+{
+    auto* texture = m_pTexture;
+    m_pTexture = nullptr;
+    return texture;
+}
+
 auto WzGr2DCanvas::CreateTexture(SDL_Renderer* renderer) -> SDL_Texture*
 {
     if (m_pTexture)
         return m_pTexture;
 
-    if (!m_canvas || !m_canvas->HasPixelData())
+    if (!m_canvas)
         return nullptr;
 
-    const int width = m_canvas->GetWidth();
-    const int height = m_canvas->GetHeight();
+    m_pTexture = CreateTextureFrom(renderer, *m_canvas);
+    return m_pTexture;
+}
+
+auto WzGr2DCanvas::CreateTextureFrom(SDL_Renderer* renderer, const WzCanvas& canvas)
+    -> SDL_Texture*
+{
+    if (!canvas.HasPixelData())
+        return nullptr;
+
+    const int width = canvas.GetWidth();
+    const int height = canvas.GetHeight();
 
     if (width <= 0 || height <= 0)
         return nullptr;
@@ -118,16 +161,16 @@ auto WzGr2DCanvas::CreateTexture(SDL_Renderer* renderer) -> SDL_Texture*
         width,
         height,
         SDL_PIXELFORMAT_RGBA32,
-        const_cast<void*>(static_cast<const void*>(m_canvas->GetPixelData().data())),
+        const_cast<void*>(static_cast<const void*>(canvas.GetPixelData().data())),
         width * 4);
 
     if (!surface)
         return nullptr;
 
-    m_pTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
     SDL_DestroySurface(surface);
 
-    return m_pTexture;
+    return texture;
 }
 
 auto WzGr2DCanvas::HasPixelData() const noexcept -> bool
@@ -20,6 +20,8 @@ namespace ms
  */
 class WzGr2DCanvas : public ICanvas
 {
+    friend class WzGr2D; // Threaded texture requests
+
 public:
     WzGr2DCanvas() = default;
     explicit WzGr2DCanvas(std::shared_ptr<WzCanvas> canvas);
@@ -29,6 +31,10 @@ public:
     WzGr2DCanvas(std::shared_ptr<WzCanvas> canvas,
                   const std::shared_ptr<WzProperty>& prop);
 
+    /// Wrap a texture with no WzCanvas behind it (e.g. a baked render
+    /// target). Takes ownership of the texture; the size is given explicitly.
+    WzGr2DCanvas(SDL_Texture* texture, int width, int height);
+
     ~WzGr2DCanvas() override;
 
     // Non-copyable, movable
@@ -41,7 +47,7 @@ public:
     [[nodiscard]] auto GetCanvas() const noexcept -> const std::shared_ptr<WzCanvas>& { return m_canvas; }
     void SetCanvas(std::shared_ptr<WzCanvas> canvas);
 
-    // Dimensions (forwarded from WzCanvas)
+    // Dimensions (forwarded from WzCanvas, or the wrapped texture's size)
     [[nodiscard]] auto GetWidth() const noexcept -> int;
     [[nodiscard]] auto GetHeight() const noexcept -> int;
 
@@ -65,10 +71,16 @@ public:
     // SDL texture
     [[nodiscard]] auto GetTexture() const noexcept -> SDL_Texture* { return m_pTexture; }
     void SetTexture(SDL_Texture* texture);
+    /// Give up the texture without destroying it; the caller owns it
+    [[nodiscard]] auto DetachTexture() noexcept -> SDL_Texture*;
 
     // Create texture from pixel data
     auto CreateTexture(SDL_Renderer* renderer) -> SDL_Texture*;
 
+    /// Upload a WzCanvas' pixels into a new texture (caller owns it)
+    [[nodiscard]] static auto CreateTextureFrom(SDL_Renderer* renderer,
+                                                const WzCanvas& canvas) -> SDL_Texture*;
+
     // State checks
     [[nodiscard]] auto HasPixelData() const noexcept -> bool;
     [[nodiscard]] auto HasTexture() const noexcept -> bool { return m_pTexture != nullptr; }
@@ -102,6 +114,11 @@ private:
     int m_nDelay = 100;           // Frame delay in ms (from WZ "delay" property)
     int m_nZ = 0;
     SDL_Texture* m_pTexture = nullptr;
+    int m_nTextureWidth = 0;      // Size when there is no WzCanvas
+    int m_nTextureHeight = 0;
+    bool m_bTextureRequested = false; // Texture pending on the render thread
+
+    void DropTexture();
 };
 
 } // namespace ms
@@ -0,0 +1,426 @@
+#include "WzGr2DChunkCache.h"
+#include "WzGr2DCanvas.h"
+#include "WzGr2DLayer.h"
+#include "WzGr2DRenderList.h"
+#include "util/Logger.h"
+
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace ms
+{
+
+namespace
+{
+
+auto FloorDiv(std::int32_t value, std::int32_t divisor) -> std::int32_t
+{
+    const auto q = value / divisor;
+    return (value % divisor != 0 && value < 0) ? q - 1 : q;
+}
+
+/// World-space rectangle of a layer that draws exactly one quad
+auto GetLayerRect(WzGr2DLayer& layer, SDL_Renderer* renderer,
+                  WzGr2DRenderList& scratch, Rect& rc) -> bool
+{
+    scratch.Clear();
+    layer.CollectRenderItems(scratch, renderer, 0, 0, 0, 0);
+    if (scratch.GetCount() != 1)
+    {
+        return false;
+    }
+
+    const auto& b = scratch.GetBounds(0);
+    rc = Rect::FromXYWH(static_cast<std::int32_t>(b.x), static_cast<std::int32_t>(b.y),
+                        static_cast<std::int32_t>(b.w), static_cast<std::int32_t>(b.h));
+    return rc.Width() > 0 && rc.Height() > 0;
+}
+
+} // namespace
+
+auto WzGr2DChunkCache::IsBakeable(const WzGr2DLayer& layer) -> bool
+{
+    return layer.IsVisible() && layer.IsStatic()
+        && layer.GetTileCx() <= 0 && layer.GetTileCy() <= 0
+        && layer.GetRotation() == 0.0F
+        && layer.get_blend() == 0
+        && layer.GetColor() == 0xFFFFFFFF
+        && layer.GetBakedChunks().empty()
+        && dynamic_cast<WzGr2DCanvas*>(layer.get_canvas()) != nullptr;
+}
+
+auto WzGr2DChunkCache::FindRuns(const WzGr2D::LayerList& layers,
+                                const std::unordered_set<const WzGr2DLayer*>& candidates)
+    -> std::vector<LayerRun>
+{
+    std::vector<LayerRun> runs;
+    LayerRun current;
+
+    for (const auto& [key, layer] : layers)
+    {
+        if (layer && candidates.contains(layer.get()))
+        {
+            current.push_back(layer);
+        }
+        else if (!current.empty())
+        {
+            runs.push_back(std::move(current));
+            current.clear();
+        }
+    }
+
+    if (!current.empty())
+    {
+        runs.push_back(std::move(current));
+    }
+
+    return runs;
+}
+
+void WzGr2DChunkCache::Bake(const LayerRun& candidates)
+{
+    // Baking renders into targets, which the simulation thread can't do
+    auto& gr = get_gr();
+    auto* renderer = m_pRenderer ? m_pRenderer : gr.GetRenderer();
+    if (!renderer || gr.IsThreadedRender())
+    {
+        return;
+    }
+
+    if (gr.GetLayerVersion() != m_nCheckedVersion)
+    {
+        ValidateRuns();
+    }
+
+    std::unordered_set<const WzGr2DLayer*> sCandidate;
+    for (const auto& layer : candidates)
+    {
+        if (layer && !m_mRunOf.contains(layer.get())
+            && !m_sExcluded.contains(layer.get()) && IsBakeable(*layer))
+        {
+            sCandidate.insert(layer.get());
+        }
+    }
+
+    if (!sCandidate.empty())
+    {
+        for (auto& run : FindRuns(gr.GetLayerList(), sCandidate))
+        {
+            if (run.size() >= 2)
+            {
+                BakeRun(std::move(run), renderer);
+            }
+        }
+    }
+
+    m_nCheckedVersion = gr.GetLayerVersion();
+}
+
+void WzGr2DChunkCache::BakeRun(LayerRun members, SDL_Renderer* renderer)
+{
+    WzGr2DRenderList list;
+
+    // World rect of every member; a member without one ends up unbaked
+    Run run;
+    Rect rcRun{std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::max(),
+               std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::min()};
+
+    for (auto& layer : members)
+    {
+        Rect rc;
+        if (!GetLayerRect(*layer, renderer, list, rc))
+        {
+            continue;
+        }
+
+        rcRun.left = std::min(rcRun.left, rc.left);
+        rcRun.top = std::min(rcRun.top, rc.top);
+        rcRun.right = std::max(rcRun.right, rc.right);
+        rcRun.bottom = std::max(rcRun.bottom, rc.bottom);
+
+        run.aMember.push_back(std::move(layer));
+        run.aMemberRect.push_back(rc);
+    }
+
+    if (run.aMember.size() < 2)
+    {
+        return;
+    }
+
+    // Render the run into every chunk cell it touches
+    std::vector<WzGr2DLayer::BakedChunk> aChunk;
+    auto* prevTarget = SDL_GetRenderTarget(renderer);
+
+    for (auto cy = FloorDiv(rcRun.top, ChunkSize); cy * ChunkSize < rcRun.bottom; ++cy)
+    {
+        for (auto cx = FloorDiv(rcRun.left, ChunkSize); cx * ChunkSize < rcRun.right; ++cx)
+        {
+            // Clip the cell to the run so edge chunks stay small
+            const Rect rcCell{std::max(cx * ChunkSize, rcRun.left),
+                              std::max(cy * ChunkSize, rcRun.top),
+                              std::min((cx + 1) * ChunkSize, rcRun.right),
+                              std::min((cy + 1) * ChunkSize, rcRun.bottom)};
+
+            list.Clear();
+            for (std::size_t i = 0; i < run.aMember.size(); ++i)
+            {
+                if (run.aMemberRect[i].Intersects(rcCell))
+                {
+                    run.aMember[i]->CollectRenderItems(list, renderer,
+                                                       -rcCell.left, -rcCell.top,
+                                                       rcCell.Width(), rcCell.Height());
+                }
+            }
+
+            if (list.Cull(static_cast<float>(rcCell.Width()),
+                          static_cast<float>(rcCell.Height())) == 0)
+            {
+                continue;
+            }
+
+            auto* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                              SDL_TEXTUREACCESS_TARGET,
+                                              rcCell.Width(), rcCell.Height());
+            if (!texture)
+            {
+                LOG_WARN("WzGr2DChunkCache: SDL_CreateTexture failed: {}", SDL_GetError());
+                continue;
+            }
+
+            // Blending onto transparent black leaves premultiplied colour,
+            // which the chunk is drawn with (LayerBlendType::Premultiplied)
+            SDL_SetRenderTarget(renderer, texture);
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            SDL_RenderClear(renderer);
+            list.Submit(renderer);
+
+            aChunk.push_back({std::make_shared<WzGr2DCanvas>(texture, rcCell.Width(), rcCell.Height()),
+                              rcCell.left, rcCell.top});
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, prevTarget);
+
+    if (aChunk.empty())
+    {
+        return;
+    }
+
+    run.nChunk = aChunk.size();
+    run.aMember.front()->SetBakedChunks(std::move(aChunk));
+    for (std::size_t i = 1; i < run.aMember.size(); ++i)
+    {
+        run.aMember[i]->SetVisible(false);
+    }
+
+    auto it = m_lRun.insert(m_lRun.end(), std::move(run));
+    for (const auto& layer : it->aMember)
+    {
+        m_mRunOf[layer.get()] = it;
+    }
+}
+
+void WzGr2DChunkCache::Unbake(RunIter it)
+{
+    it->aMember.front()->SetBakedChunks({});
+
+    for (auto& layer : it->aMember)
+    {
+        // Members were all visible when baked; the head never got hidden
+        layer->SetVisible(true);
+        m_mRunOf.erase(layer.get());
+
+        if (!m_sExcluded.contains(layer.get()))
+        {
+            m_aPending.push_back(std::move(layer));
+        }
+    }
+
+    m_lRun.erase(it);
+}
+
+void WzGr2DChunkCache::ValidateRuns()
+{
+    // A run is intact while all of its members are still in WzGr2D in their
+    // baked order. Layers that landed in between are not members and draw
+    // above the whole run, which is what a late effect or character wants.
+    std::unordered_map<const Run*, std::size_t> mSeen;
+    std::unordered_set<const Run*> sBroken;
+    std::unordered_set<const WzGr2DLayer*> sLive;
+
+    for (const auto& [key, layer] : get_gr().GetLayerList())
+    {
+        if (!m_sExcluded.empty())
+        {
+            sLive.insert(layer.get());
+        }
+
+        auto found = m_mRunOf.find(layer.get());
+        if (found != m_mRunOf.end())
+        {
+            const auto& run = *found->second;
+            auto& seen = mSeen[&run];
+            if (seen >= run.aMember.size() || run.aMember[seen] != layer)
+            {
+                sBroken.insert(&run);
+            }
+            ++seen;
+        }
+    }
+
+    for (auto it = m_lRun.begin(); it != m_lRun.end();)
+    {
+        auto next = std::next(it);
+
+        const auto found = mSeen.find(&*it);
+        if (found == mSeen.end() || found->second != it->aMember.size()
+            || sBroken.contains(&*it))
+        {
+            Unbake(it);
+        }
+
+        it = next;
+    }
+
+    // Drop exclusions for layers that are gone, before their address is reused
+    std::erase_if(m_sExcluded, [&](const WzGr2DLayer* layer) { return !sLive.contains(layer); });
+
+    m_nCheckedVersion = get_gr().GetLayerVersion();
+}
+
+void WzGr2DChunkCache::Invalidate(const std::shared_ptr<WzGr2DLayer>& layer)
+{
+    if (!layer)
+    {
+        return;
+    }
+
+    auto found = m_mRunOf.find(layer.get());
+    if (found == m_mRunOf.end())
+    {
+        return;
+    }
+
+    Changed changed{layer, {}};
+    for (const auto& mate : found->second->aMember)
+    {
+        if (mate != layer)
+        {
+            changed.apRunMate.push_back(mate);
+        }
+    }
+
+    Unbake(found->second);
+
+    // The rest of the run is re-baked next Update(); this one waits until
+    // it stops changing
+    std::erase(m_aPending, layer);
+    m_aChanged.push_back(std::move(changed));
+}
+
+void WzGr2DChunkCache::InvalidateRect(const Rect& rc)
+{
+    for (auto it = m_lRun.begin(); it != m_lRun.end();)
+    {
+        auto next = std::next(it);
+
+        bool bHit = false;
+        for (std::size_t i = 0; i < it->aMember.size(); ++i)
+        {
+            if (it->aMemberRect[i].Intersects(rc))
+            {
+                m_sExcluded.insert(it->aMember[i].get());
+                bHit = true;
+            }
+        }
+
+        if (bHit)
+        {
+            Unbake(it);
+        }
+
+        it = next;
+    }
+}
+
+void WzGr2DChunkCache::Update()
+{
+    if (get_gr().GetLayerVersion() != m_nCheckedVersion)
+    {
+        ValidateRuns();
+    }
+
+    // A changed layer that is static again is baked back together with the
+    // rest of its old run, including pieces that were re-baked without it
+    std::erase_if(m_aChanged, [this](const Changed& changed) {
+        auto layer = changed.pLayer.lock();
+        if (layer && !IsBakeable(*layer))
+        {
+            return false;
+        }
+
+        if (layer)
+        {
+            m_aPending.push_back(std::move(layer));
+            for (const auto& weak : changed.apRunMate)
+            {
+                auto mate = weak.lock();
+                if (!mate)
+                {
+                    continue;
+                }
+
+                auto found = m_mRunOf.find(mate.get());
+                if (found != m_mRunOf.end())
+                {
+                    Unbake(found->second);
+                }
+                else if (std::ranges::find(m_aPending, mate) == m_aPending.end())
+                {
+                    m_aPending.push_back(std::move(mate));
+                }
+            }
+        }
+        return true;
+    });
+
+    if (!m_aPending.empty())
+    {
+        auto aPending = std::move(m_aPending);
+        m_aPending.clear();
+        Bake(aPending);
+    }
+}
+
+void WzGr2DChunkCache::Clear()
+{
+    while (!m_lRun.empty())
+    {
+        Unbake(m_lRun.begin());
+    }
+
+    m_mRunOf.clear();
+    m_aPending.clear();
+    m_aChanged.clear();
+    m_sExcluded.clear();
+    m_nCheckedVersion = 0;
+}
+
+auto WzGr2DChunkCache::GetChunkCount() const noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for (const auto& run : m_lRun)
+    {
+        count += run.nChunk;
+    }
+    return count;
+}
+
+auto WzGr2DChunkCache::IsBaked(const WzGr2DLayer* layer) const -> bool
+{
+    return m_mRunOf.contains(layer);
+}
+
+} // namespace ms
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "WzGr2D.h"
+#include "util/Point.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ms
+{
+
+class WzGr2DLayer;
+
+/**
+ * @brief Bakes static map layers into cached render-target chunks
+ *
+ * Tiles and non-animated objects never change after the map is loaded, yet
+ * each one costs a draw call per frame. Bake() takes such layers, groups them
+ * into runs that are contiguous in the WzGr2D render order, and renders each
+ * run once into 1024x1024 world-space textures. The run's first layer draws
+ * the chunks in its own slot (WzGr2DLayer::SetBakedChunks) and the others are
+ * hidden, so the frame submits a handful of chunks instead of hundreds of
+ * small quads while the z-order stays exactly as before.
+ *
+ * Chunks are dropped again when a member changes (Invalidate), when something
+ * overlapping a world rectangle moves (InvalidateRect), or when a member
+ * leaves WzGr2D. Affected members get their own draw calls back and are
+ * re-baked on the next Update(). Only baked layers are tracked: a layer
+ * added later whose z falls inside a run (an effect, a character) leaves
+ * the run alone and draws above all of it.
+ */
+class WzGr2DChunkCache
+{
+public:
+    using LayerRun = std::vector<std::shared_ptr<WzGr2DLayer>>;
+
+    /// Edge length of a chunk texture in world pixels
+    static constexpr std::int32_t ChunkSize = 1024;
+
+    /// Bakes with renderer, or with WzGr2D's renderer when null
+    explicit WzGr2DChunkCache(SDL_Renderer* renderer = nullptr) noexcept
+        : m_pRenderer(renderer)
+    {
+    }
+
+    WzGr2DChunkCache(const WzGr2DChunkCache&) = delete;
+    auto operator=(const WzGr2DChunkCache&) -> WzGr2DChunkCache& = delete;
+
+    /**
+     * @brief Whether a layer can be drawn from a baked chunk
+     *
+     * Visible, single-frame, not animated (frames, position, alpha or tone),
+     * untiled, unrotated, normal blend and plain white colour.
+     */
+    [[nodiscard]] static auto IsBakeable(const WzGr2DLayer& layer) -> bool;
+
+    /**
+     * @brief Split candidates into runs that are contiguous in render order
+     *
+     * Any other layer between two candidates (visible or not) ends the run,
+     * since a chunk can only stand in for layers that draw back to back.
+     */
+    [[nodiscard]] static auto FindRuns(const WzGr2D::LayerList& layers,
+                                       const std::unordered_set<const WzGr2DLayer*>& candidates)
+        -> std::vector<LayerRun>;
+
+    /**
+     * @brief Bake the bakeable layers among the candidates
+     *
+     * Does nothing without a renderer or in threaded render mode. Runs of a
+     * single layer are left alone.
+     */
+    void Bake(const LayerRun& candidates);
+
+    /**
+     * @brief Stop drawing a layer from a chunk
+     *
+     * Does nothing for a layer that is not baked. Otherwise its run is
+     * unbaked, the rest of the run is re-baked on the next Update(), and the
+     * layer itself joins again once it is static.
+     */
+    void Invalidate(const std::shared_ptr<WzGr2DLayer>& layer);
+
+    /**
+     * @brief Stop drawing everything overlapping a world rectangle from chunks
+     *
+     * Members overlapping rc stay live until Clear(); the rest of each run
+     * is re-baked.
+     */
+    void InvalidateRect(const Rect& rc);
+
+    /**
+     * @brief Per-frame upkeep: unbake broken runs and re-bake pending layers
+     */
+    void Update();
+
+    /// Remove all chunks and give every member its own draw call back
+    void Clear();
+
+    [[nodiscard]] auto GetRunCount() const noexcept -> std::size_t { return m_lRun.size(); }
+    [[nodiscard]] auto GetChunkCount() const noexcept -> std::size_t;
+    [[nodiscard]] auto IsBaked(const WzGr2DLayer* layer) const -> bool;
+
+private:
+    struct Run
+    {
+        LayerRun aMember;               // Render order; aMember[0] draws the chunks
+        std::vector<Rect> aMemberRect;  // World-space rect of each member
+        std::size_t nChunk{0};
+    };
+
+    struct Changed
+    {
+        std::weak_ptr<WzGr2DLayer> pLayer;
+        std::vector<std::weak_ptr<WzGr2DLayer>> apRunMate;  // Rest of its old run
+    };
+
+    using RunIter = std::list<Run>::iterator;
+
+    void BakeRun(LayerRun members, SDL_Renderer* renderer);
+    void Unbake(RunIter it);
+    void ValidateRuns();
+
+    SDL_Renderer* m_pRenderer;
+    std::list<Run> m_lRun;
+
+    // Member layers -> owning run
+    std::unordered_map<const WzGr2DLayer*, RunIter> m_mRunOf;
+
+    // Layers that were unbaked and should be baked again
+    LayerRun m_aPending;
+
+    // Layers unbaked by Invalidate, baked again once they are static
+    std::vector<Changed> m_aChanged;
+
+    // Layers unbaked by InvalidateRect, kept live until Clear()
+    std::unordered_set<const WzGr2DLayer*> m_sExcluded;
+
+    std::uint64_t m_nCheckedVersion{0};
+};
+
+} // namespace ms
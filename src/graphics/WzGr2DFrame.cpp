@@ -0,0 +1,27 @@
+#include "WzGr2DFrame.h"
+
+namespace ms
+{
+
+void WzGr2DFrameBuffer::Publish() noexcept
+{
+    // Release: the frame contents become visible to the consumer's acquire
+    const auto prev = m_nShared.exchange(static_cast<std::uint8_t>(m_nWrite | FreshBit),
+                                         std::memory_order_acq_rel);
+    m_nWrite = prev & IndexMask;
+}
+
+auto WzGr2DFrameBuffer::AcquireLatest() noexcept -> const WzGr2DFrame*
+{
+    if ((m_nShared.load(std::memory_order_relaxed) & FreshBit) == 0)
+    {
+        return nullptr;
+    }
+
+    // Acquire: pairs with Publish(); the slot handed back is no longer drawn
+    const auto prev = m_nShared.exchange(m_nRead, std::memory_order_acq_rel);
+    m_nRead = prev & IndexMask;
+    return &m_aFrame[m_nRead];
+}
+
+} // namespace ms
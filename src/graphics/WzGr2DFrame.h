@@ -0,0 +1,73 @@
+#pragma once
+
+#include "WzGr2DRenderList.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ms
+{
+
+/**
+ * @brief Immutable snapshot of everything needed to draw one frame
+ *
+ * Built from the layers by WzGr2D without touching SDL, then handed to
+ * whichever thread owns the renderer. The render list is already culled.
+ */
+struct WzGr2DFrame
+{
+    WzGr2DRenderList renderList;
+    std::uint32_t dwBackColor{0xFF000000};
+
+    // Screen tone multipliers (255 = unchanged)
+    std::uint8_t toneR{255};
+    std::uint8_t toneG{255};
+    std::uint8_t toneB{255};
+
+    std::int32_t tCur{0};
+    std::uint64_t nSerial{0}; // Increases with every built frame
+};
+
+/**
+ * @brief Lock-free triple buffer of frames (one producer, one consumer)
+ *
+ * The producer always has a slot of its own to build into and the consumer
+ * always keeps the slot it is drawing; the third slot holds the most recently
+ * published frame. Neither side ever waits: a frame published while the
+ * previous one was not consumed yet simply replaces it.
+ */
+class WzGr2DFrameBuffer
+{
+public:
+    WzGr2DFrameBuffer() = default;
+
+    WzGr2DFrameBuffer(const WzGr2DFrameBuffer&) = delete;
+    auto operator=(const WzGr2DFrameBuffer&) -> WzGr2DFrameBuffer& = delete;
+
+    /// Producer: the slot to build the next frame into
+    [[nodiscard]] auto BeginWrite() noexcept -> WzGr2DFrame& { return m_aFrame[m_nWrite]; }
+
+    /// Producer: hand the slot from BeginWrite() over as the latest frame
+    void Publish() noexcept;
+
+    /**
+     * @brief Consumer: take the latest frame published since the last call
+     * @return The frame, or nullptr if nothing new was published
+     *
+     * The frame stays valid (and untouched by the producer) until the next
+     * successful call.
+     */
+    [[nodiscard]] auto AcquireLatest() noexcept -> const WzGr2DFrame*;
+
+private:
+    static constexpr std::uint8_t IndexMask = 0x3;
+    static constexpr std::uint8_t FreshBit = 0x4;
+
+    std::array<WzGr2DFrame, 3> m_aFrame;
+    std::uint8_t m_nWrite{0};               // Producer only
+    std::atomic<std::uint8_t> m_nShared{1}; // Index of the middle slot | FreshBit
+    std::uint8_t m_nRead{2};                // Consumer only
+};
+
+} // namespace ms
@@ -0,0 +1,123 @@
+#include "WzGr2DGlyphAtlas.h"
+#include "WzGr2DCanvas.h"
+#include "wz/WzCanvas.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace ms
+{
+
+namespace
+{
+
+constexpr std::int32_t Padding = 1;
+constexpr std::size_t BytesPerPixel = 4;
+
+} // anonymous namespace
+
+auto WzGr2DGlyphAtlas::Add(const std::shared_ptr<WzCanvas>& pCanvas, Point2D origin) -> std::int32_t
+{
+    if (!pCanvas || !pCanvas->HasPixelData() || pCanvas->GetWidth() <= 0 || pCanvas->GetHeight() <= 0)
+    {
+        return -1;
+    }
+
+    Glyph glyph;
+    glyph.source.w = static_cast<float>(pCanvas->GetWidth());
+    glyph.source.h = static_cast<float>(pCanvas->GetHeight());
+    glyph.origin = origin;
+    m_aGlyph.push_back(glyph);
+    m_apSource.push_back(pCanvas);
+    return static_cast<std::int32_t>(m_aGlyph.size() - 1);
+}
+
+void WzGr2DGlyphAtlas::Build()
+{
+    m_pCanvas.reset();
+    m_nWidth = 0;
+    m_nHeight = 0;
+    if (m_apSource.empty())
+    {
+        return;
+    }
+
+    // Square-ish: wide enough for the widest glyph and about sqrt(area)
+    std::int64_t nArea = 0;
+    std::int32_t nWidest = 0;
+    for (const auto& pCanvas : m_apSource)
+    {
+        nArea += static_cast<std::int64_t>(pCanvas->GetWidth() + Padding) * (pCanvas->GetHeight() + Padding);
+        nWidest = std::max(nWidest, pCanvas->GetWidth() + Padding);
+    }
+    const auto nSide = static_cast<std::int32_t>(std::ceil(std::sqrt(static_cast<double>(nArea))));
+    const auto nWidth = static_cast<std::int32_t>(std::bit_ceil(static_cast<std::uint32_t>(std::max(nWidest, nSide))));
+
+    // Shelves, tallest glyphs first
+    std::vector<std::size_t> anOrder(m_apSource.size());
+    std::iota(anOrder.begin(), anOrder.end(), std::size_t{0});
+    std::stable_sort(anOrder.begin(), anOrder.end(), [this](std::size_t a, std::size_t b)
+    {
+        return m_apSource[a]->GetHeight() > m_apSource[b]->GetHeight();
+    });
+
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    std::int32_t nShelf = 0;
+    for (const auto i : anOrder)
+    {
+        const auto w = m_apSource[i]->GetWidth();
+        const auto h = m_apSource[i]->GetHeight();
+        if (x + w > nWidth)
+        {
+            x = 0;
+            y += nShelf + Padding;
+            nShelf = 0;
+        }
+        m_aGlyph[i].source.x = static_cast<float>(x);
+        m_aGlyph[i].source.y = static_cast<float>(y);
+        x += w + Padding;
+        nShelf = std::max(nShelf, h);
+    }
+    const auto nHeight = y + nShelf;
+
+    // Copy the glyphs row by row into the RGBA atlas
+    const auto nPitch = static_cast<std::size_t>(nWidth) * BytesPerPixel;
+    std::vector<std::uint8_t> aPixel(nPitch * static_cast<std::size_t>(nHeight), 0);
+    for (std::size_t i = 0; i < m_apSource.size(); ++i)
+    {
+        const auto& pixels = m_apSource[i]->GetPixelData();
+        const auto nRow = static_cast<std::size_t>(m_apSource[i]->GetWidth()) * BytesPerPixel;
+        const auto nRows = static_cast<std::size_t>(m_apSource[i]->GetHeight());
+        if (pixels.size() < nRow * nRows)
+        {
+            continue;
+        }
+
+        const auto dx = static_cast<std::size_t>(m_aGlyph[i].source.x);
+        const auto dy = static_cast<std::size_t>(m_aGlyph[i].source.y);
+        for (std::size_t row = 0; row < nRows; ++row)
+        {
+            std::memcpy(aPixel.data() + (dy + row) * nPitch + dx * BytesPerPixel,
+                        pixels.data() + row * nRow, nRow);
+        }
+    }
+
+    m_nWidth = nWidth;
+    m_nHeight = nHeight;
+    m_pCanvas = std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(nWidth, nHeight, std::move(aPixel)));
+}
+
+void WzGr2DGlyphAtlas::Clear()
+{
+    m_aGlyph.clear();
+    m_apSource.clear();
+    m_pCanvas.reset();
+    m_nWidth = 0;
+    m_nHeight = 0;
+}
+
+} // namespace ms
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "WzGr2DRenderList.h"
+#include "util/Point.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ms
+{
+
+class WzCanvas;
+class WzGr2DCanvas;
+
+/**
+ * @brief Small images packed into one canvas, drawn as cells of one texture
+ *
+ * For sprite sets drawn in large numbers (damage digits): every glyph
+ * lives in the same texture, so a whole screen of them goes out as one
+ * render batch instead of one texture switch per glyph.
+ *
+ * Glyphs are added first, then Build() packs them onto shelves, tallest
+ * first, with a pixel of transparent padding so filtering does not bleed
+ * between neighbours.
+ */
+class WzGr2DGlyphAtlas
+{
+public:
+    struct Glyph
+    {
+        RenderBounds source; ///< Cell in the atlas, in texels
+        Point2D origin;      ///< Pivot inside the glyph, as in the WZ canvas
+    };
+
+    /// Queue a glyph; its index, or -1 if the canvas has no pixels
+    auto Add(const std::shared_ptr<WzCanvas>& pCanvas, Point2D origin) -> std::int32_t;
+
+    /// Pack every glyph added so far into a new canvas
+    void Build();
+
+    void Clear();
+
+    [[nodiscard]] auto GetGlyph(std::size_t index) const -> const Glyph& { return m_aGlyph[index]; }
+    [[nodiscard]] auto GetGlyphCount() const noexcept -> std::size_t { return m_aGlyph.size(); }
+    /// Null until Build()
+    [[nodiscard]] auto GetCanvas() const noexcept -> const std::shared_ptr<WzGr2DCanvas>& { return m_pCanvas; }
+    [[nodiscard]] auto GetWidth() const noexcept -> std::int32_t { return m_nWidth; }
+    [[nodiscard]] auto GetHeight() const noexcept -> std::int32_t { return m_nHeight; }
+
+private:
+    std::vector<Glyph> m_aGlyph;
+    std::vector<std::shared_ptr<WzCanvas>> m_apSource;
+    std::shared_ptr<WzGr2DCanvas> m_pCanvas;
+    std::int32_t m_nWidth{0};
+    std::int32_t m_nHeight{0};
+};
+
+} // namespace ms
@@ -1,9 +1,13 @@
 #include "WzGr2DLayer.h"
+#include "WzGr2D.h"
+#include "WzGr2DAnimationClip.h"
 #include "WzGr2DCanvas.h"
+#include "WzGr2DRenderList.h"
 #include "util/Logger.h"
 
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <utility>
 
 namespace ms
 {
@@ -25,10 +29,7 @@ void ParticleEmitter::reset()
     activeCount = 0;
     frameAccumulator = 0.0F;
     elapsedTime = 0.0F;
-    for (auto& p : particles)
-    {
-        p.timeRemaining = 0.0F;
-    }
+    particles.Clear();
 }
 
 void ParticleEmitter::update(float deltaTime, float /*param3*/, int /*param4*/, float param5)
@@ -47,153 +48,43 @@ void ParticleEmitter::update(float deltaTime, float /*param3*/, int /*param4*/,
         return;
     }
 
-    // Emit new particles
+    // Emit new particles (the store only holds live ones, so append)
     if (emitInterval > 0.0F)
     {
         frameAccumulator += dt;
-        while (frameAccumulator >= emitInterval && activeCount < maxParticles)
+        while (frameAccumulator >= emitInterval
+               && static_cast<std::int32_t>(particles.GetSize()) < maxParticles)
         {
-            int slot = -1;
-            for (int i = 0; i < static_cast<int>(particles.size()); ++i)
-            {
-                if (particles[i].timeRemaining <= 0.0F)
-                {
-                    slot = i;
-                    break;
-                }
-            }
-            if (slot < 0)
-            {
-                if (static_cast<int>(particles.size()) < maxParticles)
-                {
-                    particles.emplace_back();
-                    slot = static_cast<int>(particles.size()) - 1;
-                }
-                else
-                {
-                    break;
-                }
-            }
-
-            Particle& p = particles[slot];
-            p = Particle{};
-
+            float x = static_cast<float>(originX);
+            float y = static_cast<float>(originY);
             if (positionType == 1 && animOrigin != nullptr)
             {
-                p.posX = static_cast<float>(animOrigin->GetX() + originX);
-                p.posY = static_cast<float>(animOrigin->GetY() + originY);
-            }
-            else
-            {
-                p.posX = static_cast<float>(originX);
-                p.posY = static_cast<float>(originY);
+                x = static_cast<float>(animOrigin->GetX() + originX);
+                y = static_cast<float>(animOrigin->GetY() + originY);
             }
 
-            p.baseVelX = velocityX;
-            p.baseVelY = velocityY;
-            p.colorR = p.startR;
-            p.colorG = p.startG;
-            p.colorB = p.startB;
-            p.colorA = p.startA;
-
-            if (p.totalLifetime <= 0.0F)
-            {
-                p.totalLifetime = 1.0F;
-            }
-            p.timeRemaining = p.totalLifetime;
-            p.forceScaleA = 1.0F;
-            p.forceScaleB = 1.0F;
-
-            activeCount++;
+            particles.Emit(x, y, velocityX, velocityY, 1.0F);
             frameAccumulator -= emitInterval;
         }
     }
 
-    // Update alive particles
-    int newActiveCount = 0;
-    for (auto& p : particles)
-    {
-        if (p.timeRemaining <= 0.0F)
-        {
-            continue;
-        }
-
-        p.timeRemaining -= dt;
-        if (p.timeRemaining <= 0.0F)
-        {
-            p.timeRemaining = 0.0F;
-            continue;
-        }
-
-        newActiveCount++;
-
-        float progress = 1.0F - p.timeRemaining / p.totalLifetime;
-        p.colorR = p.startR + (p.endR - p.startR) * progress;
-        p.colorG = p.startG + (p.endG - p.startG) * progress;
-        p.colorB = p.startB + (p.endB - p.startB) * progress;
-        p.colorA = p.startA + (p.endA - p.startA) * progress;
-
-        p.sizeCurrent += p.sizeRate * dt;
-        p.rotationRate += p.rotationAccel * dt;
-        p.angularData[0] += p.rotationRate * dt;
-
-        if (usePhysics)
-        {
-            float totalForceX = (forceXA + forceXB) * p.forceScaleA;
-            float totalForceY = (forceYA + forceYB) * p.forceScaleB;
-
-            p.driftX += totalForceX * dt;
-            p.driftY += totalForceY * dt;
-
-            p.posX += (p.baseVelX + p.driftX) * dt;
-            p.posY += (p.baseVelY + p.driftY) * dt * static_cast<float>(mirrorDirection);
-
-            if (affectGravity)
-            {
-                p.baseVelY += 9.8F * dt;
-            }
-        }
-        else
-        {
-            p.posX += p.baseVelX * dt + param5;
-            p.posY += p.baseVelY * dt * static_cast<float>(mirrorDirection);
-        }
-
-        p.colorA *= opacityMultiplier;
-    }
-
-    activeCount = newActiveCount;
-}
-
-// ============================================================
-// SDL blend mode helpers
-// ============================================================
-
-namespace
-{
-
-auto ConvertToSDLBlendMode(std::int32_t blendType) -> SDL_BlendMode
-{
-    auto baseMode = blendType & 0x3F3;
+    // Age, drop the expired, then update the survivors
+    particles.Cull(dt);
+    particles.Animate(dt, opacityMultiplier);
 
-    if (baseMode & static_cast<std::int32_t>(LayerBlendType::Add))
+    const auto mirror = static_cast<float>(mirrorDirection);
+    if (usePhysics)
     {
-        return SDL_BLENDMODE_ADD;
+        particles.IntegratePhysics(dt, forceXA + forceXB, forceYA + forceYB, mirror, affectGravity);
     }
-    if (baseMode & static_cast<std::int32_t>(LayerBlendType::Multiply))
-    {
-        return SDL_BLENDMODE_MUL;
-    }
-    if (baseMode & static_cast<std::int32_t>(LayerBlendType::LinearDodge))
+    else
     {
-        return SDL_BLENDMODE_ADD;
+        particles.IntegrateSimple(dt, param5, mirror);
     }
 
-    return SDL_BLENDMODE_BLEND;
+    activeCount = static_cast<std::int32_t>(particles.GetSize());
 }
 
-} // anonymous namespace
-
 // ============================================================
 // Constructor / Destructor
 // ============================================================
@@ -226,6 +117,12 @@ WzGr2DLayer::WzGr2DLayer(std::int32_t left, std::int32_t top,
 WzGr2DLayer::~WzGr2DLayer()
 {
     clearFrames();
+    while (m_frameFree)
+    {
+        FrameNode* next = m_frameFree->next;
+        delete m_frameFree;
+        m_frameFree = next;
+    }
 }
 
 WzGr2DLayer::WzGr2DLayer(WzGr2DLayer&&) noexcept = default;
@@ -290,6 +187,57 @@ void WzGr2DLayer::SetAnimOrigin(Gr2DVector* origin)
     m_animIntermediate->PutOrigin(origin);
 }
 
+void WzGr2DLayer::Reset(std::int32_t left, std::int32_t top,
+                        std::uint32_t width, std::uint32_t height,
+                        std::int32_t z)
+{
+    RemoveAllCanvases();
+    m_aBakedChunk.clear();
+    m_pOverlay.reset();
+    m_emitter.reset();
+
+    // Move() also drops the chains and parents, so the vectors read as new
+    ensureVectors();
+    m_alphaVec->Move(255, 0);
+    m_colorRedVec->Move(255, 0);
+    m_colorGBVec->Move(255, 255);
+    m_positionVec->Move(left, top);
+    m_rbVec->Move(0, 0);
+    m_screenVec.reset();
+    m_animOriginVec.reset();
+    m_animIntermediate.reset();
+
+    m_uniqueId = ++s_idCounter;
+    m_tag = 0;
+    m_width = static_cast<std::int32_t>(width);
+    m_height = static_cast<std::int32_t>(height);
+    m_nLeft = left;
+    m_nTop = top;
+
+    m_visible = true;
+    m_zOrder = z;
+    m_flipMode = 0;
+    m_blendMode = 0;
+    m_flags = 0;
+    m_colorKeyEnabled = false;
+    m_colorKey = 0xFFFFFFFF;
+    m_lastUpdateFlags = 0;
+    m_surfaceMode = 1;
+    m_animSpeed = 1.0F;
+    m_fRotation = 0.0F;
+    m_nTileCx = 0;
+    m_nTileCy = 0;
+
+    m_animType = Gr2DAnimationType::None;
+    m_nDelayRate = 1000;
+    m_nRepeatCount = -1;
+    m_nCurrentRepeat = 0;
+    m_tLastFrameTime = 0;
+    m_bReverseDirection = false;
+    m_baseTimestamp = 0;
+    m_animTimer = 0;
+}
+
 // ============================================================
 // Frame hash table
 // ============================================================
@@ -366,7 +314,12 @@ auto WzGr2DLayer::InsertCanvas(ICanvas* canvas, std::int32_t duration,
         return -1;
     }
 
-    auto* node = new FrameNode();
+    if (m_pClip)
+    {
+        spillClip();
+    }
+
+    auto* node = allocFrameNode();
 
     do
     {
@@ -408,6 +361,11 @@ auto WzGr2DLayer::InsertCanvas(ICanvas* canvas, std::int32_t duration,
 
 void WzGr2DLayer::RemoveCanvas(int index)
 {
+    if (m_pClip)
+    {
+        spillClip();
+    }
+
     FrameNode* node = findFrameByIndex(index);
     if (!node)
     {
@@ -442,12 +400,13 @@ void WzGr2DLayer::RemoveCanvas(int index)
         m_currentFrame = m_frameHead;
     }
 
-    delete node;
+    freeFrameNode(node);
 }
 
 void WzGr2DLayer::InitCanvasOrder()
 {
     m_currentFrame = m_frameHead;
+    m_nClipFrame = 0;
     m_animTimer = 0;
 }
 
@@ -464,6 +423,12 @@ void WzGr2DLayer::ShiftCanvas(int index)
         effective += m_frameCount;
     }
 
+    if (m_pClip)
+    {
+        m_nClipFrame = effective;
+        return;
+    }
+
     FrameNode* node = findFrameByIndex(effective);
     if (node)
     {
@@ -473,6 +438,11 @@ void WzGr2DLayer::ShiftCanvas(int index)
 
 void WzGr2DLayer::SetFrameCanvas(int index, ICanvas* canvas)
 {
+    if (m_pClip)
+    {
+        spillClip();
+    }
+
     FrameNode* node = findFrameByIndex(index);
     if (node)
     {
@@ -487,7 +457,7 @@ auto WzGr2DLayer::get_canvasCount() const -> int
 
 auto WzGr2DLayer::get_canvas() const -> ICanvas*
 {
-    return m_currentFrame ? m_currentFrame->canvas : nullptr;
+    return hasCurrentFrame() ? currentFrameData().canvas : nullptr;
 }
 
 void WzGr2DLayer::clearFrames()
@@ -496,12 +466,14 @@ void WzGr2DLayer::clearFrames()
     while (node)
     {
         FrameNode* next = node->next;
-        delete node;
+        freeFrameNode(node);
         node = next;
     }
     m_frameHead = nullptr;
     m_frameTail = nullptr;
     m_currentFrame = nullptr;
+    m_pClip.reset();
+    m_nClipFrame = 0;
     m_frameCount = 0;
     m_frameIdCounter = 0;
     m_totalDuration = 0;
@@ -509,6 +481,93 @@ void WzGr2DLayer::clearFrames()
     m_renderCommands.clear();
 }
 
+auto WzGr2DLayer::allocFrameNode() -> FrameNode*
+{
+    if (!m_frameFree)
+    {
+        return new FrameNode();
+    }
+
+    FrameNode* node = m_frameFree;
+    m_frameFree = node->next;
+    *node = FrameNode{};
+    return node;
+}
+
+void WzGr2DLayer::freeFrameNode(FrameNode* node)
+{
+    node->next = m_frameFree;
+    m_frameFree = node;
+}
+
+void WzGr2DLayer::spillClip()
+{
+    // The frame list is about to change: give the clip's frames nodes
+    auto pClip = std::move(m_pClip);
+    m_pClip.reset();
+    const int nCurrent = m_nClipFrame;
+    m_nClipFrame = 0;
+    m_frameCount = 0;
+    m_totalDuration = 0;
+
+    for (const auto& frame : pClip->GetFrames())
+    {
+        InsertCanvas(frame.pCanvas, frame.nDelay, frame.nAlpha0, frame.nAlpha1);
+    }
+    m_currentFrame = findFrameByIndex(nCurrent);
+}
+
+auto WzGr2DLayer::clipFrame(int index) const -> FrameNode
+{
+    // Same alpha mapping as the shared_ptr InsertCanvas
+    const auto& frame = m_pClip->GetFrames()[static_cast<std::size_t>(index)];
+    FrameNode node;
+    node.frameId = index;
+    node.canvas = frame.pCanvas.get();
+    node.duration = frame.nDelay;
+    node.alphaA = (frame.nAlpha0 == 255) ? -1 : static_cast<std::int32_t>(frame.nAlpha0);
+    node.alphaB = (frame.nAlpha1 == 255) ? -1 : static_cast<std::int32_t>(frame.nAlpha1);
+    return node;
+}
+
+auto WzGr2DLayer::currentFrameData() const -> FrameNode
+{
+    return m_pClip ? clipFrame(m_nClipFrame) : *m_currentFrame;
+}
+
+auto WzGr2DLayer::hasCurrentFrame() const -> bool
+{
+    return m_pClip ? m_frameCount > 0 : m_currentFrame != nullptr;
+}
+
+auto WzGr2DLayer::stepFrame(bool reverse) -> bool
+{
+    if (m_pClip)
+    {
+        const int next = m_nClipFrame + (reverse ? -1 : 1);
+        if (next < 0 || next >= m_frameCount)
+        {
+            return false;
+        }
+        m_nClipFrame = next;
+        return true;
+    }
+
+    FrameNode* next = reverse ? m_currentFrame->prev : m_currentFrame->next;
+    if (!next)
+    {
+        return false;
+    }
+    m_currentFrame = next;
+    return true;
+}
+
+void WzGr2DLayer::seekFrame(bool last)
+{
+    m_nClipFrame = last ? std::max(m_frameCount - 1, 0) : 0;
+    m_currentFrame = last ? m_frameTail : m_frameHead;
+}
+
 // ============================================================
 // Frame management (backward-compatible wrappers)
 // ============================================================
@@ -525,6 +584,12 @@ auto WzGr2DLayer::InsertCanvas(std::shared_ptr<WzGr2DCanvas> canvas,
         return 0;
     }
 
+    // Spill first so the clip's canvases come before this one
+    if (m_pClip)
+    {
+        spillClip();
+    }
+
     // Keep shared_ptr alive
     m_ownedCanvases.push_back(canvas);
 
@@ -544,6 +609,29 @@ void WzGr2DLayer::RemoveAllCanvases()
     m_bAnimating = false;
 }
 
+auto WzGr2DLayer::InsertClip(const std::shared_ptr<const WzGr2DAnimationClip>& pClip) -> std::size_t
+{
+    if (!pClip || pClip->IsEmpty())
+    {
+        return 0;
+    }
+
+    if (m_frameCount == 0)
+    {
+        m_pClip = pClip;
+        m_nClipFrame = 0;
+        m_frameCount = static_cast<std::int32_t>(pClip->GetFrameCount());
+        m_totalDuration = pClip->GetTotalDelay();
+        return pClip->GetFrameCount();
+    }
+
+    for (const auto& frame : pClip->GetFrames())
+    {
+        InsertCanvas(frame.pCanvas, frame.nDelay, frame.nAlpha0, frame.nAlpha1);
+    }
+    return pClip->GetFrameCount();
+}
+
 auto WzGr2DLayer::GetCanvasCount() const noexcept -> std::size_t
 {
     return static_cast<std::size_t>(m_frameCount);
@@ -551,6 +639,11 @@ auto WzGr2DLayer::GetCanvasCount() const noexcept -> std::size_t
 
 auto WzGr2DLayer::GetCanvas(std::size_t index) const -> std::shared_ptr<WzGr2DCanvas>
 {
+    if (m_pClip)
+    {
+        return index < m_pClip->GetFrameCount() ? m_pClip->GetFrames()[index].pCanvas : nullptr;
+    }
+
     if (index >= m_ownedCanvases.size())
     {
         return nullptr;
@@ -560,6 +653,11 @@ auto WzGr2DLayer::GetCanvas(std::size_t index) const -> std::shared_ptr<WzGr2DCa
 
 auto WzGr2DLayer::GetCurrentCanvas() const -> std::shared_ptr<WzGr2DCanvas>
 {
+    if (m_pClip)
+    {
+        return GetCanvas(static_cast<std::size_t>(m_nClipFrame));
+    }
+
     // Find current frame index and return from owned canvases
     if (!m_currentFrame || m_ownedCanvases.empty())
     {
@@ -632,7 +730,12 @@ auto WzGr2DLayer::Animate(std::uint32_t flags, std::int32_t timeDelta, int targe
 
     // Determine target frame
     FrameNode* targetNode = nullptr;
-    if (targetFrame >= 0)
+    int targetClipFrame = -1;
+    if (m_pClip)
+    {
+        targetClipFrame = (targetFrame >= 0) ? targetFrame : m_nClipFrame;
+    }
+    else if (targetFrame >= 0)
     {
         targetNode = findFrameByIndex(targetFrame);
     }
@@ -653,14 +756,14 @@ auto WzGr2DLayer::Animate(std::uint32_t flags, std::int32_t timeDelta, int targe
     // Build render commands for each frame
     std::int32_t accumTime = 0;
     int frameIdx = 0;
-    while (cursor)
+    auto appendCommand = [&](const FrameNode& frame, bool isTarget)
     {
         RenderCommand cmd{};
         cmd.frameIndex = reverse ? (m_frameCount - 1 - frameIdx) : frameIdx;
         cmd.timestamp = accumTime;
-        accumTime += cursor->duration;
+        accumTime += frame.duration;
 
-        if (cursor == targetNode)
+        if (isTarget)
         {
             cmd.currentFrameTime = timePos;
         }
@@ -669,23 +772,23 @@ auto WzGr2DLayer::Animate(std::uint32_t flags, std::int32_t timeDelta, int targe
             cmd.currentFrameTime = -1;
         }
 
-        cmd.alpha = computeAlpha(cursor->alphaA);
+        cmd.alpha = computeAlpha(frame.alphaA);
 
-        if (cursor->alphaB >= 0 && m_alphaVec)
+        if (frame.alphaB >= 0 && m_alphaVec)
         {
             std::int32_t layerAlpha = m_alphaVec->GetX();
             cmd.colorMod = std::clamp(static_cast<std::int32_t>(
-                static_cast<float>(layerAlpha * cursor->alphaB) / 255.0F + 0.5F), 0, 255);
+                static_cast<float>(layerAlpha * frame.alphaB) / 255.0F + 0.5F), 0, 255);
         }
         else
         {
             cmd.colorMod = computeAlpha(-1);
         }
 
-        cmd.blendSrc = cursor->blendSrc;
-        cmd.blendDst = cursor->blendDst;
+        cmd.blendSrc = frame.blendSrc;
+        cmd.blendDst = frame.blendDst;
 
-        ICanvas* canv = cursor->canvas;
+        ICanvas* canv = frame.canvas;
         if (canv && canv->isReady())
         {
             cmd.textureHandle = canv->getTextureHandle();
@@ -698,8 +801,21 @@ auto WzGr2DLayer::Animate(std::uint32_t flags, std::int32_t timeDelta, int targe
         }
 
         m_renderCommands.push_back(cmd);
-
         frameIdx++;
+    };
+
+    if (m_pClip)
+    {
+        for (int i = 0; i < m_frameCount; ++i)
+        {
+            const int index = reverse ? (m_frameCount - 1 - i) : i;
+            appendCommand(clipFrame(index), index == targetClipFrame);
+        }
+    }
+
+    while (cursor)
+    {
+        appendCommand(*cursor, cursor == targetNode);
         cursor = reverse ? cursor->prev : cursor->next;
     }
 
@@ -707,7 +823,26 @@ auto WzGr2DLayer::Animate(std::uint32_t flags, std::int32_t timeDelta, int targe
     m_animTimer += timeDelta;
 
     // Time-based mode: update current frame based on playback position
-    if ((flags & 0x20) && totalDur > 0 && m_frameHead)
+    if ((flags & 0x20) && totalDur > 0 && m_pClip)
+    {
+        std::int32_t wrappedTime = timePos % totalDur;
+        if (wrappedTime < 0)
+        {
+            wrappedTime += totalDur;
+        }
+
+        std::int32_t accum = 0;
+        for (int i = 0; i < m_frameCount; ++i)
+        {
+            accum += clipFrame(i).duration;
+            if (wrappedTime < accum)
+            {
+                m_nClipFrame = i;
+                break;
+            }
+        }
+    }
+    else if ((flags & 0x20) && totalDur > 0 && m_frameHead)
     {
         std::int32_t wrappedTime = timePos % totalDur;
         if (wrappedTime < 0)
@@ -785,20 +920,13 @@ auto WzGr2DLayer::Animate(Gr2DAnimationType type,
 
     if (m_bReverseDirection)
     {
-        if (typeValue & static_cast<std::int32_t>(Gr2DAnimationType::First))
-        {
-            m_currentFrame = m_frameHead;
-        }
-        else
-        {
-            m_currentFrame = m_frameTail;
-        }
+        seekFrame((typeValue & static_cast<std::int32_t>(Gr2DAnimationType::First)) == 0);
     }
     else
     {
         if (typeValue & static_cast<std::int32_t>(Gr2DAnimationType::First))
         {
-            m_currentFrame = m_frameHead;
+            seekFrame(false);
         }
     }
 
@@ -815,6 +943,11 @@ void WzGr2DLayer::StopAnimation()
 
 auto WzGr2DLayer::GetCurrentFrame() const noexcept -> std::size_t
 {
+    if (m_pClip)
+    {
+        return static_cast<std::size_t>(m_nClipFrame);
+    }
+
     if (!m_currentFrame)
     {
         return 0;
@@ -833,6 +966,15 @@ auto WzGr2DLayer::GetCurrentFrame() const noexcept -> std::size_t
 
 void WzGr2DLayer::SetCurrentFrame(std::size_t frame)
 {
+    if (m_pClip)
+    {
+        if (frame < static_cast<std::size_t>(m_frameCount))
+        {
+            m_nClipFrame = static_cast<std::int32_t>(frame);
+        }
+        return;
+    }
+
     FrameNode* node = findFrameByIndex(static_cast<int>(frame));
     if (node)
     {
@@ -851,7 +993,7 @@ auto WzGr2DLayer::GetAnimationState() const noexcept -> AnimationState
 
 void WzGr2DLayer::advanceFrame()
 {
-    if (m_frameCount == 0 || !m_currentFrame)
+    if (m_frameCount == 0 || !hasCurrentFrame())
     {
         return;
     }
@@ -862,11 +1004,7 @@ void WzGr2DLayer::advanceFrame()
 
     if (m_bReverseDirection)
     {
-        if (m_currentFrame->prev)
-        {
-            m_currentFrame = m_currentFrame->prev;
-        }
-        else
+        if (!stepFrame(true))
         {
             // Reached beginning
             if (hasRepeat)
@@ -880,7 +1018,7 @@ void WzGr2DLayer::advanceFrame()
                 }
                 else
                 {
-                    m_currentFrame = m_frameTail;
+                    seekFrame(true);
                 }
 
                 if (m_nRepeatCount > 0)
@@ -908,11 +1046,7 @@ void WzGr2DLayer::advanceFrame()
     }
     else
     {
-        if (m_currentFrame->next)
-        {
-            m_currentFrame = m_currentFrame->next;
-        }
-        else
+        if (!stepFrame(false))
         {
             // Reached end
             if (hasRepeat)
@@ -925,7 +1059,7 @@ void WzGr2DLayer::advanceFrame()
                 }
                 else
                 {
-                    m_currentFrame = m_frameHead;
+                    seekFrame(false);
                 }
 
                 if (m_nRepeatCount > 0)
@@ -1203,6 +1337,20 @@ auto WzGr2DLayer::IsPositionAnimating() const noexcept -> bool
     return m_positionVec != nullptr;
 }
 
+auto WzGr2DLayer::IsStatic() const -> bool
+{
+    // A vector is fixed unless it has animation nodes or follows a parent
+    auto isFixed = [](const std::unique_ptr<Gr2DVector>& vec)
+    {
+        const auto* chain = vec ? vec->Chain() : nullptr;
+        return chain == nullptr || (chain->head == nullptr && chain->parent_ref == nullptr);
+    };
+
+    return m_frameCount == 1 && !m_bAnimating && !m_emitter
+        && isFixed(m_positionVec) && isFixed(m_alphaVec)
+        && isFixed(m_colorRedVec) && isFixed(m_colorGBVec);
+}
+
 // ============================================================
 // Internal helpers
 // ============================================================
@@ -1241,7 +1389,7 @@ void WzGr2DLayer::Update(std::int32_t tCur)
     }
 
     // Update frame animation
-    if (!m_bAnimating || m_frameCount < 2 || !m_currentFrame)
+    if (!m_bAnimating || m_frameCount < 2 || !hasCurrentFrame())
     {
         return;
     }
@@ -1254,7 +1402,7 @@ void WzGr2DLayer::Update(std::int32_t tCur)
     }
 
     // Get current frame delay scaled by delay rate
-    auto delay = (m_currentFrame->duration * m_nDelayRate) / DelayRateScaleFactor;
+    auto delay = (currentFrameData().duration * m_nDelayRate) / DelayRateScaleFactor;
     if (delay <= 0)
     {
         delay = 1;
@@ -1267,20 +1415,95 @@ void WzGr2DLayer::Update(std::int32_t tCur)
     }
 }
 
+auto WzGr2DLayer::PrepareUpdate(const Gr2DVectorResolver& resolver) -> bool
+{
+    // A chain through an opaque parent (VecCtrl) still evaluates it on read
+    if (m_positionVec && !resolver.IsComplete(*m_positionVec))
+    {
+        return false;
+    }
+
+    // Clear animations drop their canvases (and SDL textures) on completion
+    const auto typeValue = static_cast<std::int32_t>(m_animType);
+    return !m_bAnimating || (typeValue & static_cast<std::int32_t>(Gr2DAnimationType::Clear)) == 0;
+}
+
+void WzGr2DLayer::AddVectors(Gr2DVectorResolver& resolver)
+{
+    resolver.Add(m_positionVec.get());
+    resolver.Add(m_alphaVec.get());
+    resolver.Add(m_colorRedVec.get());
+    resolver.Add(m_colorGBVec.get());
+}
+
 void WzGr2DLayer::Render(SDL_Renderer* renderer, std::int32_t offsetX, std::int32_t offsetY)
 {
-    if (!m_visible || m_frameCount == 0 || renderer == nullptr)
+    if (renderer == nullptr)
+    {
+        return;
+    }
+
+    int viewportW = 0;
+    int viewportH = 0;
+    SDL_GetRenderOutputSize(renderer, &viewportW, &viewportH);
+
+    WzGr2DRenderList list;
+    CollectRenderItems(list, renderer, offsetX, offsetY, viewportW, viewportH);
+    list.Cull(static_cast<float>(viewportW), static_cast<float>(viewportH));
+    list.Submit(renderer);
+}
+
+void WzGr2DLayer::CollectRenderItems(WzGr2DRenderList& list, SDL_Renderer* renderer,
+                                     std::int32_t offsetX, std::int32_t offsetY,
+                                     std::int32_t viewportW, std::int32_t viewportH)
+{
+    // A null renderer is the threaded build: textures come from RequestTexture
+    if (!m_visible)
+    {
+        return;
+    }
+
+    // Baked chunks stand in for this layer (and the run it heads)
+    if (!m_aBakedChunk.empty())
+    {
+        for (const auto& chunk : m_aBakedChunk)
+        {
+            if (!chunk.pCanvas->GetTexture())
+            {
+                continue;
+            }
+
+            const RenderBounds bounds{
+                static_cast<float>(chunk.x + offsetX),
+                static_cast<float>(chunk.y + offsetY),
+                static_cast<float>(chunk.pCanvas->GetWidth()),
+                static_cast<float>(chunk.pCanvas->GetHeight())
+            };
+
+            list.Append(m_zOrder, bounds, chunk.pCanvas->GetTexture(), 0xFFFFFFFF,
+                        static_cast<std::int32_t>(LayerBlendType::Premultiplied),
+                        0, 0.0F, -1);
+        }
+        return;
+    }
+
+    if (m_frameCount == 0)
     {
         return;
     }
 
     // Get current frame's canvas
-    if (!m_currentFrame || !m_currentFrame->canvas)
+    if (!hasCurrentFrame())
     {
         return;
     }
 
-    ICanvas* icanvas = m_currentFrame->canvas;
+    const FrameNode frame = currentFrameData();
+    ICanvas* icanvas = frame.canvas;
+    if (!icanvas)
+    {
+        return;
+    }
 
     // Try to cast to WzGr2DCanvas for SDL texture access
     auto* canvas = dynamic_cast<WzGr2DCanvas*>(icanvas);
@@ -1289,10 +1512,17 @@ void WzGr2DLayer::Render(SDL_Renderer* renderer, std::int32_t offsetX, std::int3
         return;
     }
 
-    // Get or create SDL texture
+    // Get or create SDL texture; without a renderer (threaded mode) the
+    // render thread creates it and the canvas is drawn from a later frame
     auto* texture = canvas->GetTexture();
     if (!texture)
     {
+        if (!renderer)
+        {
+            get_gr().RequestTexture(*canvas);
+            return;
+        }
+
         texture = canvas->CreateTexture(renderer);
         if (!texture)
         {
@@ -1311,47 +1541,18 @@ void WzGr2DLayer::Render(SDL_Renderer* renderer, std::int32_t offsetX, std::int3
     auto baseX = static_cast<float>(m_nLeft + offsetX);
     auto baseY = static_cast<float>(m_nTop + offsetY);
 
-    // Debug: trace parallax for background layers (z < -1073800000) once per second
     // Render position: basePos + canvasPos - canvasOrigin
     float renderX = baseX + static_cast<float>(canvasPos.x) - static_cast<float>(canvasOrigin.x);
     float renderY = baseY + static_cast<float>(canvasPos.y) - static_cast<float>(canvasOrigin.y);
     float renderWidth = canvasWidth;
     float renderHeight = canvasHeight;
 
-    // Apply color modulation from Gr2DVector channels
-    auto color = get_color();
-    auto alpha = static_cast<std::uint8_t>((color >> 24) & 0xFF);
-    auto red = static_cast<std::uint8_t>((color >> 16) & 0xFF);
-    auto green = static_cast<std::uint8_t>((color >> 8) & 0xFF);
-    auto blue = static_cast<std::uint8_t>(color & 0xFF);
-
     // Combine layer alpha with per-frame alpha
-    auto frameAlpha = computeAlpha(m_currentFrame->alphaA);
-    alpha = static_cast<std::uint8_t>(
-        std::clamp(static_cast<int>(alpha) * frameAlpha / 255, 0, 255));
-
-    SDL_SetTextureColorMod(texture, red, green, blue);
-    SDL_SetTextureAlphaMod(texture, alpha);
-
-    // Apply blend mode
-    auto sdlBlendMode = ConvertToSDLBlendMode(m_blendMode);
-    SDL_SetTextureBlendMode(texture, sdlBlendMode);
-
-    // Handle flip
-    SDL_FlipMode flipMode = SDL_FLIP_NONE;
-    if (m_flipMode & static_cast<std::int32_t>(LayerFlipState::Horizontal))
-    {
-        flipMode = static_cast<SDL_FlipMode>(flipMode | SDL_FLIP_HORIZONTAL);
-    }
-    if (m_flipMode & static_cast<std::int32_t>(LayerFlipState::Vertical))
-    {
-        flipMode = static_cast<SDL_FlipMode>(flipMode | SDL_FLIP_VERTICAL);
-    }
-
-    // Get viewport size for tiling
-    int viewportW = 0;
-    int viewportH = 0;
-    SDL_GetRenderOutputSize(renderer, &viewportW, &viewportH);
+    auto color = get_color();
+    auto alpha = static_cast<std::int32_t>((color >> 24) & 0xFF);
+    auto frameAlpha = computeAlpha(frame.alphaA);
+    alpha = std::clamp(alpha * frameAlpha / 255, 0, 255);
+    color = (color & 0x00FFFFFF) | (static_cast<std::uint32_t>(alpha) << 24);
 
     auto tileCx = m_nTileCx > 0 ? static_cast<float>(m_nTileCx) : renderWidth;
     auto tileCy = m_nTileCy > 0 ? static_cast<float>(m_nTileCy) : renderHeight;
@@ -1379,39 +1580,29 @@ void WzGr2DLayer::Render(SDL_Renderer* renderer, std::int32_t offsetX, std::int3
         tilesY = static_cast<int>((static_cast<float>(viewportH) - startTileY) / tileCy) + 2;
     }
 
+    // One item per tile; off-screen tiles are dropped by WzGr2DRenderList::Cull
     for (int ty = 0; ty < tilesY; ++ty)
     {
         for (int tx = 0; tx < tilesX; ++tx)
         {
-            float tileX = startTileX + static_cast<float>(tx) * tileCx;
-            float tileY = startTileY + static_cast<float>(ty) * tileCy;
-
-            if (tileX + renderWidth < 0 || tileX > static_cast<float>(viewportW) ||
-                tileY + renderHeight < 0 || tileY > static_cast<float>(viewportH))
-            {
-                continue;
-            }
-
-            SDL_FRect dstRect{
-                tileX,
-                tileY,
+            const RenderBounds bounds{
+                startTileX + static_cast<float>(tx) * tileCx,
+                startTileY + static_cast<float>(ty) * tileCy,
                 renderWidth,
                 renderHeight
             };
 
-            if (flipMode != SDL_FLIP_NONE || m_fRotation != 0.0F)
-            {
-                SDL_RenderTextureRotated(renderer, texture, nullptr, &dstRect,
-                                          static_cast<double>(m_fRotation), nullptr, flipMode);
-            }
-            else
-            {
-                SDL_RenderTexture(renderer, texture, nullptr, &dstRect);
-            }
+            list.Append(m_zOrder, bounds, texture, color, m_blendMode, m_flipMode,
+                        m_fRotation, frame.frameId);
         }
     }
 }
 
+void WzGr2DLayer::SetBakedChunks(std::vector<BakedChunk> chunks)
+{
+    m_aBakedChunk = std::move(chunks);
+}
+
 // =============================================================================
 // WzGr2DLayer — IWzVector2D delegation to m_positionVec
 // =============================================================================
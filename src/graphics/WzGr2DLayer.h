@@ -15,7 +15,10 @@ struct SDL_Texture;
 namespace ms
 {
 
+class Gr2DVectorResolver;
+class WzGr2DAnimationClip;
 class WzGr2DCanvas;
+class WzGr2DRenderList;
 
 /**
  * @brief 2D sprite layer class
@@ -30,6 +33,14 @@ class WzGr2DCanvas;
 class WzGr2DLayer : public IWzVector2D
 {
 public:
+    /// Pre-rendered texture drawn at a fixed world position (see WzGr2DChunkCache)
+    struct BakedChunk
+    {
+        std::shared_ptr<WzGr2DCanvas> pCanvas;
+        std::int32_t x = 0;
+        std::int32_t y = 0;
+    };
+
     WzGr2DLayer();
     WzGr2DLayer(std::int32_t left, std::int32_t top,
                 std::uint32_t width, std::uint32_t height,
@@ -48,6 +59,17 @@ public:
     void InitAnimation(std::int32_t baseTimestamp);
     void SetAnimOrigin(Gr2DVector* origin);
 
+    /**
+     * @brief Return to the state of a freshly constructed layer
+     *
+     * Drops frames, canvases, overlay and animation state but keeps the
+     * colour/position vectors and frame nodes, so a recycled layer is set
+     * up again without touching the heap. See WzGr2DLayerPool.
+     */
+    void Reset(std::int32_t left = 0, std::int32_t top = 0,
+               std::uint32_t width = 0, std::uint32_t height = 0,
+               std::int32_t z = 0);
+
     // === Frame management (source-matching API) ===
     auto InsertCanvas(ICanvas* canvas, std::int32_t duration,
                       std::int32_t alpha = -1, std::int32_t colorMod = -1,
@@ -67,6 +89,18 @@ public:
                       std::int32_t zoom0 = 1000,
                       std::int32_t zoom1 = 1000) -> std::size_t;
     void RemoveAllCanvases();
+
+    /**
+     * @brief Append a shared clip's frames
+     *
+     * A layer without frames plays the clip in place: it keeps the clip
+     * alive and only its own cursor into it, so no frame nodes are built.
+     * Appending to frames the layer already has falls back to one node per
+     * frame pointing at the clip's canvases.
+     * @return Number of frames added
+     */
+    auto InsertClip(const std::shared_ptr<const WzGr2DAnimationClip>& pClip) -> std::size_t;
+
     [[nodiscard]] auto GetCanvasCount() const noexcept -> std::size_t;
     [[nodiscard]] auto GetCanvas(std::size_t index) const -> std::shared_ptr<WzGr2DCanvas>;
     [[nodiscard]] auto GetCurrentCanvas() const -> std::shared_ptr<WzGr2DCanvas>;
@@ -194,6 +228,10 @@ public:
     void StopPositionAnimation();
     [[nodiscard]] auto IsPositionAnimating() const noexcept -> bool;
 
+    /// True when the layer looks the same every frame: one frame, no frame
+    /// animation, no particles, and no position/alpha/tone vector chains.
+    [[nodiscard]] auto IsStatic() const -> bool;
+
     // === Non-vtable helpers (source-matching) ===
     [[nodiscard]] auto getTag() const -> std::int32_t { return m_tag; }
     void setTag(std::int32_t tag) { m_tag = tag; }
@@ -211,8 +249,46 @@ public:
 
     // === Update and Render (SDL-specific) ===
     void Update(std::int32_t tCur);
+
+    /**
+     * @brief Check whether Update() may run on a worker thread
+     *
+     * Call on the render thread after the frame's Gr2DVectorResolver pass,
+     * which has already evaluated the position chain and everything it
+     * reads, so Update() only touches this layer.
+     * @param resolver The pass the layer's vectors were added to
+     * @return false if Update() must stay on the render thread
+     */
+    auto PrepareUpdate(const Gr2DVectorResolver& resolver) -> bool;
     void Render(SDL_Renderer* renderer, std::int32_t offsetX = 0, std::int32_t offsetY = 0);
 
+    /// Add the position, alpha and colour vectors to a resolver pass
+    void AddVectors(Gr2DVectorResolver& resolver);
+
+    /**
+     * @brief Append this layer's quads for the current frame to a render list
+     *
+     * Resolves texture, colour, blend and flip once; tiled layers append one
+     * quad per tile covering the viewport. Culling happens in the list.
+     * With a null renderer, missing textures are requested from WzGr2D
+     * instead of created, and the layer is skipped until they arrive.
+     */
+    void CollectRenderItems(WzGr2DRenderList& list, SDL_Renderer* renderer,
+                            std::int32_t offsetX, std::int32_t offsetY,
+                            std::int32_t viewportW, std::int32_t viewportH);
+
+    /**
+     * @brief Draw baked chunks in place of this layer's own frame
+     *
+     * The chunks keep this layer's slot in the render order. Pass an empty
+     * vector to draw the frame again.
+     */
+    void SetBakedChunks(std::vector<BakedChunk> chunks);
+    [[nodiscard]] auto GetBakedChunks() const noexcept -> const std::vector<BakedChunk>&
+    {
+        return m_aBakedChunk;
+    }
+
     // === IWzShape2D / IWzVector2D overrides (delegate to m_positionVec) ===
     [[nodiscard]] auto GetX() -> std::int32_t override;
     [[nodiscard]] auto GetY() -> std::int32_t override;
@@ -261,6 +337,7 @@ public:
     void PutLooseLevel(std::int32_t level) override;
     void Fly(const std::vector<FlyKeyframe>& keyframes,
              IWzVector2D* completionTarget = nullptr) override;
+    [[nodiscard]] auto GetResolveTarget() -> Gr2DVector* override { return m_positionVec.get(); }
 
 private:
     // === Identification ===
@@ -288,6 +365,7 @@ private:
     FrameNode* m_frameHead = nullptr;
     FrameNode* m_frameTail = nullptr;
     FrameNode* m_currentFrame = nullptr;
+    FrameNode* m_frameFree = nullptr; // Spare nodes, linked through next
     std::int32_t m_frameCount = 0;
     std::int32_t m_frameIdCounter = 0;
     std::int32_t m_totalDuration = 0;
@@ -334,6 +412,9 @@ private:
     // === Particle emitter ===
     std::unique_ptr<ParticleEmitter> m_emitter;
 
+    // === Baked static geometry drawn instead of the current frame ===
+    std::vector<BakedChunk> m_aBakedChunk;
+
     // === Timing ===
     std::int32_t m_baseTimestamp = 0;
     std::int32_t m_animTimer = 0;
@@ -344,6 +425,10 @@ private:
     // === Ownership for backward-compatible InsertCanvas ===
     std::vector<std::shared_ptr<WzGr2DCanvas>> m_ownedCanvases;
 
+    // === Shared clip played instead of the frame list (see InsertClip) ===
+    std::shared_ptr<const WzGr2DAnimationClip> m_pClip;
+    std::int32_t m_nClipFrame = 0;
+
     // === Internal helpers ===
     auto findFrameById(std::int32_t id) const -> FrameNode*;
     auto findFrameByIndex(int index) const -> FrameNode*;
@@ -351,6 +436,14 @@ private:
     void removeFrameHash(FrameNode* node);
     static auto hashFrameId(std::int32_t id) -> std::uint32_t;
     void clearFrames();
+    void spillClip();
+    auto clipFrame(int index) const -> FrameNode;
+    auto currentFrameData() const -> FrameNode;
+    auto hasCurrentFrame() const -> bool;
+    auto stepFrame(bool reverse) -> bool;
+    void seekFrame(bool last);
+    auto allocFrameNode() -> FrameNode*;
+    void freeFrameNode(FrameNode* node);
     auto computeAlpha(std::int32_t frameAlpha) const -> std::int32_t;
     void ensureVectors();
     void advanceFrame();
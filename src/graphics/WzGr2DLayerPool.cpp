@@ -0,0 +1,43 @@
+#include "WzGr2DLayerPool.h"
+#include "WzGr2DLayer.h"
+
+namespace ms
+{
+
+auto WzGr2DLayerPool::Acquire(std::int32_t left, std::int32_t top,
+                              std::uint32_t width, std::uint32_t height,
+                              std::int32_t z) -> std::shared_ptr<WzGr2DLayer>
+{
+    if (m_apFree.empty())
+    {
+        ++m_nAlloc;
+        return std::make_shared<WzGr2DLayer>(left, top, width, height, z);
+    }
+
+    auto pLayer = std::move(m_apFree.back());
+    m_apFree.pop_back();
+    pLayer->Reset(left, top, width, height, z);
+    ++m_nReuse;
+    return pLayer;
+}
+
+auto WzGr2DLayerPool::Release(std::shared_ptr<WzGr2DLayer> pLayer) -> bool
+{
+    if (!pLayer || pLayer.use_count() != 1 || m_apFree.size() >= m_nMaxFree)
+    {
+        return false;
+    }
+
+    // Reset now rather than on reuse so the canvases go back right away
+    pLayer->Reset();
+    m_apFree.push_back(std::move(pLayer));
+    return true;
+}
+
+void WzGr2DLayerPool::Clear()
+{
+    m_apFree.clear();
+    m_apFree.shrink_to_fit();
+}
+
+} // namespace ms
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ms
+{
+
+class WzGr2DLayer;
+
+/**
+ * @brief Recycles short-lived layers (hit sparks, skill bursts, ...)
+ *
+ * Released layers are reset in place and handed out again by Acquire, so
+ * once the pool has grown to the number of effects alive at the busiest
+ * moment, spawning an effect allocates no layer, no vectors and no frame
+ * nodes. GetAllocCount() stops moving in that steady state.
+ *
+ * A layer still referenced elsewhere when released is left to its other
+ * owners rather than recycled under them.
+ *
+ * Not thread-safe; used on the thread that creates and removes layers.
+ */
+class WzGr2DLayerPool
+{
+public:
+    explicit WzGr2DLayerPool(std::size_t nMaxFree = 512) noexcept : m_nMaxFree(nMaxFree) {}
+
+    /// A layer in the state the constructor would give it, reused when possible
+    [[nodiscard]] auto Acquire(std::int32_t left, std::int32_t top,
+                               std::uint32_t width, std::uint32_t height,
+                               std::int32_t z) -> std::shared_ptr<WzGr2DLayer>;
+
+    /// Take a layer back; returns false if it was dropped instead of kept
+    auto Release(std::shared_ptr<WzGr2DLayer> pLayer) -> bool;
+
+    void Clear();
+
+    [[nodiscard]] auto GetFreeCount() const noexcept -> std::size_t { return m_apFree.size(); }
+    /// Layers created because none was free
+    [[nodiscard]] auto GetAllocCount() const noexcept -> std::uint64_t { return m_nAlloc; }
+    /// Acquires served from the free list
+    [[nodiscard]] auto GetReuseCount() const noexcept -> std::uint64_t { return m_nReuse; }
+
+private:
+    std::vector<std::shared_ptr<WzGr2DLayer>> m_apFree;
+    std::size_t m_nMaxFree;
+    std::uint64_t m_nAlloc{0};
+    std::uint64_t m_nReuse{0};
+};
+
+} // namespace ms
@@ -0,0 +1,213 @@
+#include "WzGr2DParticle.h"
+
+#include <SDL3/SDL.h>
+#include <cmath>
+#include <numbers>
+
+namespace ms
+{
+
+void ParticleStore::Clear()
+{
+    ForEachArray([](std::vector<float>& a) { a.clear(); });
+}
+
+void ParticleStore::Reserve(std::size_t nCount)
+{
+    ForEachArray([nCount](std::vector<float>& a) { a.reserve(nCount); });
+}
+
+auto ParticleStore::Emit(float x, float y, float vx, float vy, float lifetime) -> std::size_t
+{
+    const auto i = GetSize();
+    ForEachArray([](std::vector<float>& a) { a.push_back(0.0F); });
+
+    m_aPosX[i] = x;
+    m_aPosY[i] = y;
+    m_aVelX[i] = vx;
+    m_aVelY[i] = vy;
+    m_aForceScaleA[i] = 1.0F;
+    m_aForceScaleB[i] = 1.0F;
+    m_aTotalLifetime[i] = lifetime > 0.0F ? lifetime : 1.0F;
+    m_aTimeRemaining[i] = m_aTotalLifetime[i];
+    return i;
+}
+
+void ParticleStore::SwapRemove(std::size_t i)
+{
+    ForEachArray([i](std::vector<float>& a)
+    {
+        a[i] = a.back();
+        a.pop_back();
+    });
+}
+
+void ParticleStore::Cull(float dt)
+{
+    auto* timeRemaining = m_aTimeRemaining.data();
+    const auto n = GetSize();
+    for (std::size_t i = 0; i < n; ++i)
+        timeRemaining[i] -= dt;
+
+    // Walk backwards so a swapped-in particle has already been checked
+    for (auto i = n; i-- > 0;)
+    {
+        if (m_aTimeRemaining[i] <= 0.0F)
+            SwapRemove(i);
+    }
+}
+
+void ParticleStore::Animate(float dt, float opacityMultiplier)
+{
+    const auto n = GetSize();
+    const auto* __restrict timeRemaining = m_aTimeRemaining.data();
+    const auto* __restrict totalLifetime = m_aTotalLifetime.data();
+
+    auto Lerp = [&](std::vector<float>& aColor, const std::vector<float>& aStart,
+                    const std::vector<float>& aEnd)
+    {
+        auto* __restrict color = aColor.data();
+        const auto* __restrict start = aStart.data();
+        const auto* __restrict end = aEnd.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto progress = 1.0F - timeRemaining[i] / totalLifetime[i];
+            color[i] = start[i] + (end[i] - start[i]) * progress;
+        }
+    };
+
+    Lerp(m_aColorR, m_aStartR, m_aEndR);
+    Lerp(m_aColorG, m_aStartG, m_aEndG);
+    Lerp(m_aColorB, m_aStartB, m_aEndB);
+    Lerp(m_aColorA, m_aStartA, m_aEndA);
+
+    auto* __restrict colorA = m_aColorA.data();
+    auto* __restrict size = m_aSize.data();
+    const auto* __restrict sizeRate = m_aSizeRate.data();
+    auto* __restrict rotationRate = m_aRotationRate.data();
+    const auto* __restrict rotationAccel = m_aRotationAccel.data();
+    auto* __restrict angle = m_aAngle.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        colorA[i] *= opacityMultiplier;
+        size[i] += sizeRate[i] * dt;
+        rotationRate[i] += rotationAccel[i] * dt;
+        angle[i] += rotationRate[i] * dt;
+    }
+}
+
+void ParticleStore::IntegratePhysics(float dt, float forceX, float forceY, float mirror,
+                                     bool affectGravity)
+{
+    const auto n = GetSize();
+    auto* __restrict posX = m_aPosX.data();
+    auto* __restrict posY = m_aPosY.data();
+    auto* __restrict velY = m_aVelY.data();
+    const auto* __restrict velX = m_aVelX.data();
+    auto* __restrict driftX = m_aDriftX.data();
+    auto* __restrict driftY = m_aDriftY.data();
+    const auto* __restrict forceScaleA = m_aForceScaleA.data();
+    const auto* __restrict forceScaleB = m_aForceScaleB.data();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        driftX[i] += forceX * forceScaleA[i] * dt;
+        driftY[i] += forceY * forceScaleB[i] * dt;
+        posX[i] += (velX[i] + driftX[i]) * dt;
+        posY[i] += (velY[i] + driftY[i]) * dt * mirror;
+    }
+
+    if (affectGravity)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            velY[i] += 9.8F * dt;
+    }
+}
+
+void ParticleStore::IntegrateSimple(float dt, float offsetX, float mirror)
+{
+    const auto n = GetSize();
+    auto* __restrict posX = m_aPosX.data();
+    auto* __restrict posY = m_aPosY.data();
+    const auto* __restrict velX = m_aVelX.data();
+    const auto* __restrict velY = m_aVelY.data();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        posX[i] += velX[i] * dt + offsetX;
+        posY[i] += velY[i] * dt * mirror;
+    }
+}
+
+void ParticleStore::AppendQuads(std::vector<SDL_Vertex>& aVertex, std::vector<int>& aIndex,
+                                float offsetX, float offsetY, float baseSize) const
+{
+    const auto n = GetSize();
+    const auto nVertexBase = aVertex.size();
+    const auto nIndexBase = aIndex.size();
+    aVertex.resize(nVertexBase + n * 4);
+    aIndex.resize(nIndexBase + n * 6);
+
+    constexpr float DegToRad = std::numbers::pi_v<float> / 180.0F;
+    constexpr float ToUnit = 1.0F / 255.0F;
+    constexpr float CornerX[4] = {-1.0F, 1.0F, 1.0F, -1.0F};
+    constexpr float CornerY[4] = {-1.0F, -1.0F, 1.0F, 1.0F};
+    constexpr float TexU[4] = {0.0F, 1.0F, 1.0F, 0.0F};
+    constexpr float TexV[4] = {0.0F, 0.0F, 1.0F, 1.0F};
+
+    auto* pVertex = aVertex.data() + nVertexBase;
+    auto* pIndex = aIndex.data() + nIndexBase;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto half = baseSize * m_aSize[i] * 0.5F;
+        const auto c = std::cos(m_aAngle[i] * DegToRad) * half;
+        const auto s = std::sin(m_aAngle[i] * DegToRad) * half;
+        const auto cx = m_aPosX[i] + offsetX;
+        const auto cy = m_aPosY[i] + offsetY;
+        const SDL_FColor color{m_aColorR[i] * ToUnit, m_aColorG[i] * ToUnit,
+                               m_aColorB[i] * ToUnit, m_aColorA[i] * ToUnit};
+
+        for (int k = 0; k < 4; ++k)
+        {
+            auto& v = pVertex[k];
+            v.position = {cx + CornerX[k] * c - CornerY[k] * s, cy + CornerX[k] * s + CornerY[k] * c};
+            v.color = color;
+            v.tex_coord = {TexU[k], TexV[k]};
+        }
+        pVertex += 4;
+
+        const auto base = static_cast<int>(nVertexBase + i * 4);
+        pIndex[0] = base;
+        pIndex[1] = base + 1;
+        pIndex[2] = base + 2;
+        pIndex[3] = base;
+        pIndex[4] = base + 2;
+        pIndex[5] = base + 3;
+        pIndex += 6;
+    }
+}
+
+void ParticleStore::SetColorRange(std::size_t i, const float (&start)[4], const float (&end)[4])
+{
+    m_aStartR[i] = start[0];
+    m_aStartG[i] = start[1];
+    m_aStartB[i] = start[2];
+    m_aStartA[i] = start[3];
+    m_aEndR[i] = end[0];
+    m_aEndG[i] = end[1];
+    m_aEndB[i] = end[2];
+    m_aEndA[i] = end[3];
+}
+
+void ParticleStore::SetSizeRate(std::size_t i, float sizeRate)
+{
+    m_aSizeRate[i] = sizeRate;
+}
+
+void ParticleStore::SetRotation(std::size_t i, float rotationRate, float rotationAccel)
+{
+    m_aRotationRate[i] = rotationRate;
+    m_aRotationAccel[i] = rotationAccel;
+}
+
+} // namespace ms
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+struct SDL_Vertex;
+
+namespace ms
+{
+
+/**
+ * @brief Live particles of one emitter, stored as parallel arrays
+ *
+ * Holds the fields of Particle that the update actually touches, one
+ * contiguous float array per field. Slots [0, GetSize()) are all alive:
+ * Cull() swap-removes expired particles, so the kernels never test for
+ * dead slots and emission simply appends. Per-emitter settings (forces,
+ * gravity, mirroring) are passed in by the caller and hoisted out of the
+ * loops, which leaves each kernel a straight pass the compiler vectorizes.
+ */
+class ParticleStore
+{
+public:
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_aTimeRemaining.size(); }
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_aTimeRemaining.empty(); }
+
+    void Clear();
+    void Reserve(std::size_t nCount);
+
+    /**
+     * @brief Append a particle with zero colour, size and spin
+     * @return Its slot (valid until the next Cull)
+     */
+    auto Emit(float x, float y, float vx, float vy, float lifetime) -> std::size_t;
+
+    /// Count down lifetimes by dt and swap-remove every particle that ran out
+    void Cull(float dt);
+
+    /// Lerp colours from start to end by age, scale alpha, grow and spin
+    void Animate(float dt, float opacityMultiplier);
+
+    /// Drift every particle under the emitter's forces
+    void IntegratePhysics(float dt, float forceX, float forceY, float mirror, bool affectGravity);
+
+    /// Move every particle by its velocity, plus a flat x offset per step
+    void IntegrateSimple(float dt, float offsetX, float mirror);
+
+    /**
+     * @brief Append one textured quad per particle for SDL_RenderGeometry
+     *
+     * Quads are centred on the particle (plus offset), sized baseSize *
+     * size and rotated by the particle's angle in degrees. Colours are
+     * 0-255 channels as in the WZ particle data.
+     */
+    void AppendQuads(std::vector<SDL_Vertex>& aVertex, std::vector<int>& aIndex,
+                     float offsetX, float offsetY, float baseSize) const;
+
+    // ========== Per-particle access ==========
+
+    [[nodiscard]] auto GetX(std::size_t i) const -> float { return m_aPosX[i]; }
+    [[nodiscard]] auto GetY(std::size_t i) const -> float { return m_aPosY[i]; }
+    [[nodiscard]] auto GetVelX(std::size_t i) const -> float { return m_aVelX[i]; }
+    [[nodiscard]] auto GetVelY(std::size_t i) const -> float { return m_aVelY[i]; }
+    [[nodiscard]] auto GetColorA(std::size_t i) const -> float { return m_aColorA[i]; }
+    [[nodiscard]] auto GetSizeCurrent(std::size_t i) const -> float { return m_aSize[i]; }
+    [[nodiscard]] auto GetAngle(std::size_t i) const -> float { return m_aAngle[i]; }
+    [[nodiscard]] auto GetTimeRemaining(std::size_t i) const -> float { return m_aTimeRemaining[i]; }
+
+    void SetColorRange(std::size_t i, const float (&start)[4], const float (&end)[4]);
+    void SetSizeRate(std::size_t i, float sizeRate);
+    void SetRotation(std::size_t i, float rotationRate, float rotationAccel);
+
+private:
+    void SwapRemove(std::size_t i);
+
+    /// Apply fn to every per-particle array, so they always stay the same length
+    template <typename Fn>
+    void ForEachArray(Fn&& fn)
+    {
+        for (auto* pArray : {&m_aPosX, &m_aPosY, &m_aVelX, &m_aVelY, &m_aDriftX, &m_aDriftY,
+                             &m_aForceScaleA, &m_aForceScaleB,
+                             &m_aColorR, &m_aColorG, &m_aColorB, &m_aColorA,
+                             &m_aStartR, &m_aStartG, &m_aStartB, &m_aStartA,
+                             &m_aEndR, &m_aEndG, &m_aEndB, &m_aEndA,
+                             &m_aSize, &m_aSizeRate, &m_aRotationRate, &m_aRotationAccel, &m_aAngle,
+                             &m_aTimeRemaining, &m_aTotalLifetime})
+        {
+            fn(*pArray);
+        }
+    }
+
+    // Motion
+    std::vector<float> m_aPosX, m_aPosY;
+    std::vector<float> m_aVelX, m_aVelY;
+    std::vector<float> m_aDriftX, m_aDriftY;
+    std::vector<float> m_aForceScaleA, m_aForceScaleB;
+
+    // Colour (current, start, end)
+    std::vector<float> m_aColorR, m_aColorG, m_aColorB, m_aColorA;
+    std::vector<float> m_aStartR, m_aStartG, m_aStartB, m_aStartA;
+    std::vector<float> m_aEndR, m_aEndG, m_aEndB, m_aEndA;
+
+    // Size and rotation
+    std::vector<float> m_aSize, m_aSizeRate;
+    std::vector<float> m_aRotationRate, m_aRotationAccel, m_aAngle;
+
+    // Lifetime
+    std::vector<float> m_aTimeRemaining;
+    std::vector<float> m_aTotalLifetime;
+};
+
+} // namespace ms
@@ -0,0 +1,291 @@
+#include "WzGr2DRenderList.h"
+#include "WzGr2DTypes.h"
+
+#include <SDL3/SDL.h>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace ms
+{
+
+namespace
+{
+
+auto ConvertToSDLBlendMode(std::int32_t blendType) -> SDL_BlendMode
+{
+    auto baseMode = blendType & 0x3F3;
+
+    if (baseMode & static_cast<std::int32_t>(LayerBlendType::Add))
+    {
+        return SDL_BLENDMODE_ADD;
+    }
+    if (baseMode & static_cast<std::int32_t>(LayerBlendType::Multiply))
+    {
+        return SDL_BLENDMODE_MUL;
+    }
+    if (baseMode & static_cast<std::int32_t>(LayerBlendType::LinearDodge))
+    {
+        return SDL_BLENDMODE_ADD;
+    }
+    if (blendType & static_cast<std::int32_t>(LayerBlendType::Premultiplied))
+    {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
+
+    return SDL_BLENDMODE_BLEND;
+}
+
+auto ConvertToSDLFlipMode(std::int32_t flip) -> SDL_FlipMode
+{
+    SDL_FlipMode flipMode = SDL_FLIP_NONE;
+    if (flip & static_cast<std::int32_t>(LayerFlipState::Horizontal))
+    {
+        flipMode = static_cast<SDL_FlipMode>(flipMode | SDL_FLIP_HORIZONTAL);
+    }
+    if (flip & static_cast<std::int32_t>(LayerFlipState::Vertical))
+    {
+        flipMode = static_cast<SDL_FlipMode>(flipMode | SDL_FLIP_VERTICAL);
+    }
+    return flipMode;
+}
+
+static_assert(sizeof(RenderVertex) == sizeof(SDL_Vertex), "RenderVertex must match SDL_Vertex");
+static_assert(offsetof(RenderVertex, r) == offsetof(SDL_Vertex, color));
+static_assert(offsetof(RenderVertex, u) == offsetof(SDL_Vertex, tex_coord));
+
+/// Items that may share one SDL_RenderGeometry call
+auto SameBatch(SDL_Texture* a, std::int32_t blendA, SDL_Texture* b, std::int32_t blendB) -> bool
+{
+    return a != nullptr && a == b && blendA == blendB;
+}
+
+} // anonymous namespace
+
+void WzGr2DRenderList::Clear() noexcept
+{
+    m_aZ.clear();
+    m_aBounds.clear();
+    m_aTexture.clear();
+    m_aColor.clear();
+    m_aBlend.clear();
+    m_aFlip.clear();
+    m_aRotation.clear();
+    m_aFrameId.clear();
+    m_aSource.clear();
+    m_aUV.clear();
+    m_aDrawIndex.clear();
+    m_aBatch.clear();
+    m_aVertex.clear();
+}
+
+void WzGr2DRenderList::Append(std::int32_t z, const RenderBounds& bounds, SDL_Texture* texture,
+                              std::uint32_t color, std::int32_t blend, std::int32_t flip,
+                              float rotation, std::int32_t frameId)
+{
+    m_aZ.push_back(z);
+    m_aBounds.push_back(bounds);
+    m_aTexture.push_back(texture);
+    m_aColor.push_back(color);
+    m_aBlend.push_back(blend);
+    m_aFlip.push_back(flip);
+    m_aRotation.push_back(rotation);
+    m_aFrameId.push_back(frameId);
+    m_aSource.emplace_back();
+    m_aUV.emplace_back();
+}
+
+void WzGr2DRenderList::AppendRegion(std::int32_t z, const RenderBounds& bounds, SDL_Texture* texture,
+                                    const RenderBounds& source, float textureW, float textureH,
+                                    std::uint32_t color, std::int32_t blend)
+{
+    Append(z, bounds, texture, color, blend, 0, 0.0F, -1);
+
+    m_aSource.back() = source;
+    if (textureW > 0.0F && textureH > 0.0F)
+    {
+        m_aUV.back() = {source.x / textureW, source.y / textureH,
+                        (source.x + source.w) / textureW, (source.y + source.h) / textureH};
+    }
+}
+
+auto WzGr2DRenderList::Cull(float viewW, float viewH) -> std::size_t
+{
+    m_aDrawIndex.clear();
+
+    const auto count = m_aBounds.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& b = m_aBounds[i];
+        if (b.x + b.w < 0 || b.x > viewW || b.y + b.h < 0 || b.y > viewH)
+        {
+            continue;
+        }
+        m_aDrawIndex.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    BuildBatches();
+    return m_aDrawIndex.size();
+}
+
+void WzGr2DRenderList::BuildBatches()
+{
+    m_aBatch.clear();
+    m_aVertex.clear();
+
+    const auto count = static_cast<std::uint32_t>(m_aDrawIndex.size());
+    std::uint32_t nLongest = 0;
+    for (std::uint32_t first = 0; first < count;)
+    {
+        const auto head = m_aDrawIndex[first];
+        auto end = first + 1;
+        while (end < count
+               && SameBatch(m_aTexture[head], m_aBlend[head],
+                            m_aTexture[m_aDrawIndex[end]], m_aBlend[m_aDrawIndex[end]]))
+        {
+            ++end;
+        }
+
+        RenderBatch batch{first, end - first, static_cast<std::uint32_t>(m_aVertex.size())};
+        if (batch.nCount > 1)
+        {
+            for (auto k = first; k < end; ++k)
+            {
+                AppendQuadVertices(m_aDrawIndex[k]);
+            }
+            nLongest = batch.nCount > nLongest ? batch.nCount : nLongest;
+        }
+        m_aBatch.push_back(batch);
+        first = end;
+    }
+
+    // Index pattern long enough for the largest batch
+    for (auto q = static_cast<std::uint32_t>(m_aQuadIndex.size() / 6); q < nLongest; ++q)
+    {
+        const auto v = static_cast<int>(q * 4);
+        m_aQuadIndex.insert(m_aQuadIndex.end(), {v, v + 1, v + 2, v + 2, v + 1, v + 3});
+    }
+}
+
+void WzGr2DRenderList::AppendQuadVertices(std::uint32_t i)
+{
+    const auto& b = m_aBounds[i];
+    const auto color = m_aColor[i];
+    const auto flip = m_aFlip[i];
+
+    RenderVertex proto;
+    proto.r = static_cast<float>((color >> 16) & 0xFF) / 255.0F;
+    proto.g = static_cast<float>((color >> 8) & 0xFF) / 255.0F;
+    proto.b = static_cast<float>(color & 0xFF) / 255.0F;
+    proto.a = static_cast<float>((color >> 24) & 0xFF) / 255.0F;
+
+    // Flip by swapping texture coordinates, as SDL_RenderTextureRotated does
+    const bool bFlipH = (flip & static_cast<std::int32_t>(LayerFlipState::Horizontal)) != 0;
+    const bool bFlipV = (flip & static_cast<std::int32_t>(LayerFlipState::Vertical)) != 0;
+    const auto& uv = m_aUV[i];
+    const float uL = bFlipH ? uv.u1 : uv.u0;
+    const float uR = bFlipH ? uv.u0 : uv.u1;
+    const float vT = bFlipV ? uv.v1 : uv.v0;
+    const float vB = bFlipV ? uv.v0 : uv.v1;
+
+    // Corners relative to the centre: TL, TR, BL, BR
+    const float hw = b.w * 0.5F;
+    const float hh = b.h * 0.5F;
+    const float cx = b.x + hw;
+    const float cy = b.y + hh;
+    const float adx[4] = {-hw, hw, -hw, hw};
+    const float ady[4] = {-hh, -hh, hh, hh};
+    const float au[4] = {uL, uR, uL, uR};
+    const float av[4] = {vT, vT, vB, vB};
+
+    // Clockwise about the centre, like SDL_RenderTextureRotated
+    float c = 1.0F;
+    float sn = 0.0F;
+    if (const auto rotation = m_aRotation[i]; rotation != 0.0F)
+    {
+        const auto rad = rotation * std::numbers::pi_v<float> / 180.0F;
+        c = std::cos(rad);
+        sn = std::sin(rad);
+    }
+
+    for (int k = 0; k < 4; ++k)
+    {
+        auto vtx = proto;
+        vtx.x = cx + adx[k] * c - ady[k] * sn;
+        vtx.y = cy + adx[k] * sn + ady[k] * c;
+        vtx.u = au[k];
+        vtx.v = av[k];
+        m_aVertex.push_back(vtx);
+    }
+}
+
+void WzGr2DRenderList::Submit(SDL_Renderer* renderer) const
+{
+    if (renderer == nullptr)
+    {
+        return;
+    }
+
+    // Texture state is only re-applied when it differs from the previous
+    // item (consecutive items often repeat the same state)
+    SDL_Texture* lastTexture = nullptr;
+    std::uint32_t lastColor = 0;
+    std::int32_t lastBlend = 0;
+
+    const auto applyState = [&](SDL_Texture* texture, std::uint32_t color, std::int32_t blend)
+    {
+        if (texture == lastTexture && color == lastColor && blend == lastBlend)
+        {
+            return;
+        }
+        SDL_SetTextureColorMod(texture,
+                               static_cast<std::uint8_t>((color >> 16) & 0xFF),
+                               static_cast<std::uint8_t>((color >> 8) & 0xFF),
+                               static_cast<std::uint8_t>(color & 0xFF));
+        SDL_SetTextureAlphaMod(texture, static_cast<std::uint8_t>((color >> 24) & 0xFF));
+        SDL_SetTextureBlendMode(texture, ConvertToSDLBlendMode(blend));
+
+        lastTexture = texture;
+        lastColor = color;
+        lastBlend = blend;
+    };
+
+    for (const auto& batch : m_aBatch)
+    {
+        const auto i = m_aDrawIndex[batch.nFirst];
+        auto* texture = m_aTexture[i];
+
+        if (batch.nCount > 1)
+        {
+            // Colour travels in the vertices; the texture itself stays white
+            applyState(texture, 0xFFFFFFFF, m_aBlend[i]);
+            SDL_RenderGeometry(renderer, texture,
+                               reinterpret_cast<const SDL_Vertex*>(m_aVertex.data() + batch.nVertex),
+                               static_cast<int>(batch.nCount * 4),
+                               m_aQuadIndex.data(), static_cast<int>(batch.nCount * 6));
+            continue;
+        }
+
+        applyState(texture, m_aColor[i], m_aBlend[i]);
+
+        const auto& b = m_aBounds[i];
+        const SDL_FRect dstRect{b.x, b.y, b.w, b.h};
+        const auto& src = m_aSource[i];
+        const SDL_FRect srcRect{src.x, src.y, src.w, src.h};
+        const auto* pSrcRect = src.w > 0.0F ? &srcRect : nullptr;
+        const auto flipMode = ConvertToSDLFlipMode(m_aFlip[i]);
+        const auto rotation = m_aRotation[i];
+
+        if (flipMode != SDL_FLIP_NONE || rotation != 0.0F)
+        {
+            SDL_RenderTextureRotated(renderer, texture, pSrcRect, &dstRect,
+                                     static_cast<double>(rotation), nullptr, flipMode);
+        }
+        else
+        {
+            SDL_RenderTexture(renderer, texture, pSrcRect, &dstRect);
+        }
+    }
+}
+
+} // namespace ms
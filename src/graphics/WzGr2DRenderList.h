@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct SDL_Renderer;
+struct SDL_Texture;
+
+namespace ms
+{
+
+/**
+ * @brief Screen-space destination rectangle of a render item
+ */
+struct RenderBounds
+{
+    float x = 0.0F;
+    float y = 0.0F;
+    float w = 0.0F;
+    float h = 0.0F;
+};
+
+/**
+ * @brief Part of a texture drawn by a render item, in texture coordinates (0..1)
+ */
+struct RenderUV
+{
+    float u0 = 0.0F;
+    float v0 = 0.0F;
+    float u1 = 1.0F;
+    float v1 = 1.0F;
+};
+
+/**
+ * @brief Vertex of a batched quad, laid out like SDL_Vertex
+ */
+struct RenderVertex
+{
+    float x = 0.0F;
+    float y = 0.0F;
+    float r = 1.0F;
+    float g = 1.0F;
+    float b = 1.0F;
+    float a = 1.0F;
+    float u = 0.0F;
+    float v = 0.0F;
+};
+
+/**
+ * @brief Consecutive draw items submitted with one call
+ *
+ * nFirst/nCount index GetDrawIndices(). A batch of one item is drawn as a
+ * plain texture copy; longer ones are one SDL_RenderGeometry call over
+ * 4 * nCount vertices starting at nVertex.
+ */
+struct RenderBatch
+{
+    std::uint32_t nFirst = 0;
+    std::uint32_t nCount = 0;
+    std::uint32_t nVertex = 0;
+};
+
+/**
+ * @brief Packed per-frame render list (structure of arrays)
+ *
+ * WzGr2DLayer stays the authoring-side object; once per frame each visible
+ * layer appends its quads here (one per tile for tiled layers). Culling and
+ * SDL submission then run over contiguous arrays instead of chasing layer
+ * pointers. Items keep the order they were appended in (layer z-order).
+ *
+ * Storage is reused across frames, so a steady scene does not allocate.
+ *
+ * Cull() also groups consecutive visible items that share a texture and
+ * blend mode (a crowd of one mob type on a shared clip, the tiles of a
+ * tiled layer) into batches whose position, flip, rotation and colour go
+ * into a vertex stream, so each group costs one draw call. Only adjacent
+ * items are merged; the draw order is never changed.
+ */
+class WzGr2DRenderList
+{
+public:
+    /// Drop all items (keeps capacity)
+    void Clear() noexcept;
+
+    /**
+     * @brief Append one quad
+     * @param z Layer z-order
+     * @param bounds Destination rectangle in screen space
+     * @param texture SDL texture to draw
+     * @param color ARGB modulation (alpha already combined with frame alpha)
+     * @param blend LayerBlendType flags
+     * @param flip LayerFlipState flags
+     * @param rotation Rotation in degrees
+     * @param frameId Id of the layer frame the quad was taken from
+     */
+    void Append(std::int32_t z, const RenderBounds& bounds, SDL_Texture* texture,
+                std::uint32_t color, std::int32_t blend, std::int32_t flip,
+                float rotation, std::int32_t frameId);
+
+    /**
+     * @brief Append one quad showing a cell of the texture (e.g. a glyph atlas)
+     * @param source Cell rectangle in texels
+     * @param textureW Texture width in texels
+     * @param textureH Texture height in texels
+     *
+     * Cells of one atlas share a texture, so consecutive ones batch.
+     */
+    void AppendRegion(std::int32_t z, const RenderBounds& bounds, SDL_Texture* texture,
+                      const RenderBounds& source, float textureW, float textureH,
+                      std::uint32_t color, std::int32_t blend);
+
+    /**
+     * @brief Select the items that overlap the viewport and batch them
+     * @return Number of items that will be submitted
+     */
+    auto Cull(float viewW, float viewH) -> std::size_t;
+
+    /// Draw the items selected by the last Cull() in list order
+    void Submit(SDL_Renderer* renderer) const;
+
+    [[nodiscard]] auto GetBatches() const noexcept -> const std::vector<RenderBatch>& { return m_aBatch; }
+    [[nodiscard]] auto GetVertices() const noexcept -> const std::vector<RenderVertex>& { return m_aVertex; }
+
+    [[nodiscard]] auto GetCount() const noexcept -> std::size_t { return m_aZ.size(); }
+    [[nodiscard]] auto GetDrawCount() const noexcept -> std::size_t { return m_aDrawIndex.size(); }
+    [[nodiscard]] auto GetDrawIndices() const noexcept -> const std::vector<std::uint32_t>&
+    {
+        return m_aDrawIndex;
+    }
+
+    [[nodiscard]] auto GetZ(std::size_t i) const -> std::int32_t { return m_aZ[i]; }
+    [[nodiscard]] auto GetBounds(std::size_t i) const -> const RenderBounds& { return m_aBounds[i]; }
+    [[nodiscard]] auto GetTexture(std::size_t i) const -> SDL_Texture* { return m_aTexture[i]; }
+    [[nodiscard]] auto GetColor(std::size_t i) const -> std::uint32_t { return m_aColor[i]; }
+    [[nodiscard]] auto GetBlend(std::size_t i) const -> std::int32_t { return m_aBlend[i]; }
+    [[nodiscard]] auto GetFlip(std::size_t i) const -> std::int32_t { return m_aFlip[i]; }
+    [[nodiscard]] auto GetRotation(std::size_t i) const -> float { return m_aRotation[i]; }
+    [[nodiscard]] auto GetFrameId(std::size_t i) const -> std::int32_t { return m_aFrameId[i]; }
+    /// Texel rectangle drawn; zero size for the whole texture
+    [[nodiscard]] auto GetSource(std::size_t i) const -> const RenderBounds& { return m_aSource[i]; }
+    [[nodiscard]] auto GetUV(std::size_t i) const -> const RenderUV& { return m_aUV[i]; }
+
+private:
+    std::vector<std::int32_t> m_aZ;
+    std::vector<RenderBounds> m_aBounds;
+    std::vector<SDL_Texture*> m_aTexture;
+    std::vector<std::uint32_t> m_aColor;
+    std::vector<std::int32_t> m_aBlend;
+    std::vector<std::int32_t> m_aFlip;
+    std::vector<float> m_aRotation;
+    std::vector<std::int32_t> m_aFrameId;
+    std::vector<RenderBounds> m_aSource;
+    std::vector<RenderUV> m_aUV;
+
+    // Result of Cull(): indices into the arrays above, in list order
+    std::vector<std::uint32_t> m_aDrawIndex;
+
+    // Result of Cull(): draw calls and the vertices of the batched quads
+    std::vector<RenderBatch> m_aBatch;
+    std::vector<RenderVertex> m_aVertex;
+    std::vector<int> m_aQuadIndex; // 0,1,2, 2,1,3 per quad; shared by all batches
+
+    void BuildBatches();
+    void AppendQuadVertices(std::uint32_t i);
+};
+
+} // namespace ms
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "WzGr2DParticle.h"
+
 #include <cstdint>
 #include <vector>
 
@@ -241,11 +243,13 @@ static_assert(sizeof(Particle) == 180, "Particle must be 180 bytes");
 /**
  * @brief Particle emitter system
  *
- * From sub_5321BD40 and internal object this[9].
+ * From sub_5321BD40 and internal object this[9]. Live particles are kept
+ * in a ParticleStore (one array per Particle field) rather than as Particle
+ * records.
  */
 struct ParticleEmitter
 {
-    std::vector<Particle> particles;
+    ParticleStore particles;
     std::int32_t maxParticles = 0;
     std::int32_t activeCount = 0;
     float emitInterval = 0.0F;
@@ -0,0 +1,141 @@
+#include "FootholdColumnIndex.h"
+#include "field/foothold/StaticFoothold.h"
+
+#include <algorithm>
+#include <climits>
+
+namespace ms
+{
+
+void FootholdColumnIndex::Build(const std::vector<StaticFoothold*>& apFoothold)
+{
+    Clear();
+
+    // Only footholds GetFootholdUnderneath can return: left to right, not vertical
+    std::vector<StaticFoothold*> apWalkable;
+    std::int32_t xMin = INT_MAX;
+    std::int32_t xMax = INT_MIN;
+    for (auto* pfh : apFoothold)
+    {
+        if (pfh && pfh->GetX1() < pfh->GetX2())
+        {
+            apWalkable.push_back(pfh);
+            xMin = std::min(xMin, pfh->GetX1());
+            xMax = std::max(xMax, pfh->GetX2());
+        }
+    }
+
+    if (apWalkable.empty())
+        return;
+
+    m_xOrigin = xMin;
+    const auto nColumn = static_cast<std::size_t>(GetColumn(xMax)) + 1;
+
+    // Bucket per column first, then lay the columns out back to back
+    std::vector<std::vector<Span>> aaColumn(nColumn);
+    for (auto* pfh : apWalkable)
+    {
+        Span span;
+        span.x1 = pfh->GetX1();
+        span.x2 = pfh->GetX2();
+        span.y1 = pfh->GetY1();
+        span.dy = pfh->GetY2() - pfh->GetY1();
+        span.dx = span.x2 - span.x1;
+        span.pfh = pfh;
+
+        const auto cFirst = GetColumn(span.x1);
+        const auto cLast = GetColumn(span.x2);
+        for (auto c = cFirst; c <= cLast; ++c)
+        {
+            const auto colLeft = m_xOrigin + static_cast<std::int32_t>(c) * ColumnWidth;
+            const auto colRight = colLeft + ColumnWidth - 1;
+
+            // GetYAt is monotonic in x, so the clipped ends bound it
+            const auto yLeft = span.GetYAt(std::max(span.x1, colLeft));
+            const auto yRight = span.GetYAt(std::min(span.x2, colRight));
+            span.yTop = std::min(yLeft, yRight);
+            span.yBottom = std::max(yLeft, yRight);
+
+            aaColumn[static_cast<std::size_t>(c)].push_back(span);
+        }
+    }
+
+    m_aColumnBegin.reserve(nColumn + 1);
+    for (auto& aSpan : aaColumn)
+    {
+        m_aColumnBegin.push_back(static_cast<std::uint32_t>(m_aSpan.size()));
+
+        std::stable_sort(aSpan.begin(), aSpan.end(), [](const Span& a, const Span& b)
+        {
+            return a.yBottom < b.yBottom;
+        });
+
+        // Suffix minimum of yTop: once it is past the best hit, stop scanning
+        const auto first = m_aSpan.size();
+        m_aSpan.insert(m_aSpan.end(), aSpan.begin(), aSpan.end());
+        m_aMinTopFrom.resize(m_aSpan.size());
+
+        auto nMinTop = INT_MAX;
+        for (auto i = m_aSpan.size(); i-- > first;)
+        {
+            nMinTop = std::min(nMinTop, m_aSpan[i].yTop);
+            m_aMinTopFrom[i] = nMinTop;
+        }
+    }
+    m_aColumnBegin.push_back(static_cast<std::uint32_t>(m_aSpan.size()));
+}
+
+void FootholdColumnIndex::Clear()
+{
+    m_xOrigin = 0;
+    m_aColumnBegin.clear();
+    m_aSpan.clear();
+    m_aMinTopFrom.clear();
+}
+
+auto FootholdColumnIndex::GetColumn(std::int32_t x) const noexcept -> std::int64_t
+{
+    const auto dx = static_cast<std::int64_t>(x) - m_xOrigin;
+    return dx >= 0 ? dx / ColumnWidth : -1;
+}
+
+auto FootholdColumnIndex::FindUnderneath(std::int32_t x, std::int32_t y, std::int32_t yMin,
+                                         std::int32_t& cy) const -> StaticFoothold*
+{
+    cy = yMin;
+
+    const auto c = GetColumn(x);
+    if (c < 0 || static_cast<std::size_t>(c) + 1 >= m_aColumnBegin.size())
+        return nullptr;
+
+    const auto itBegin = m_aSpan.begin() + m_aColumnBegin[static_cast<std::size_t>(c)];
+    const auto itEnd = m_aSpan.begin() + m_aColumnBegin[static_cast<std::size_t>(c) + 1];
+
+    // Spans whose lowest point is still above y can't be underneath
+    auto it = std::lower_bound(itBegin, itEnd, y, [](const Span& span, std::int32_t value)
+    {
+        return span.yBottom < value;
+    });
+
+    StaticFoothold* pfhUnderneath = nullptr;
+    for (; it != itEnd; ++it)
+    {
+        if (m_aMinTopFrom[static_cast<std::size_t>(it - m_aSpan.begin())] >= cy)
+            break;
+
+        const auto& span = *it;
+        if (span.x1 > x || span.x2 < x || span.pfh->IsOff())
+            continue;
+
+        const auto yAtX = span.GetYAt(x);
+        if (yAtX >= y && yAtX < cy)
+        {
+            cy = yAtX;
+            pfhUnderneath = span.pfh;
+        }
+    }
+
+    return pfhUnderneath;
+}
+
+} // namespace ms
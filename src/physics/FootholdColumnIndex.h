@@ -0,0 +1,74 @@
+#pragma once
+
+#include "field/foothold/FootholdSplit.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ms
+{
+
+class StaticFoothold;
+
+/**
+ * @brief X-sliced lookup table for "which floor is below this point"
+ *
+ * The map is cut into columns FootholdSplit::SplitX wide. Each column keeps
+ * the walkable (non-vertical) footholds crossing it as spans with their
+ * slope terms and their y extent inside the column, sorted by the bottom of
+ * that extent. A ground query picks the column, binary-searches past every
+ * span that lies entirely above the point and scans upward from there until
+ * no remaining span can be closer.
+ *
+ * Built once per map; footholds are static after WvsPhysicalSpace2D::Load.
+ */
+class FootholdColumnIndex
+{
+public:
+    static constexpr std::int32_t ColumnWidth = FootholdSplit::SplitX;
+
+    /// Rebuild from a map's footholds (non-owning; they must outlive the index)
+    void Build(const std::vector<StaticFoothold*>& apFoothold);
+
+    void Clear();
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_aSpan.empty(); }
+
+    /**
+     * @brief Closest foothold at x whose y is in [y, yMin)
+     *
+     * Same result as WvsPhysicalSpace2D::GetFootholdUnderneath (which of
+     * two footholds meeting at exactly the same y wins may differ).
+     * @param cy Set to the foothold's y at x, or to yMin if none was found
+     */
+    [[nodiscard]] auto FindUnderneath(std::int32_t x, std::int32_t y, std::int32_t yMin,
+                                      std::int32_t& cy) const -> StaticFoothold*;
+
+private:
+    struct Span
+    {
+        std::int32_t x1{};
+        std::int32_t x2{};
+        std::int32_t y1{};
+        std::int32_t dy{};       // y2 - y1
+        std::int32_t dx{};       // x2 - x1, always > 0
+        std::int32_t yTop{};     // y extent inside the column
+        std::int32_t yBottom{};
+        StaticFoothold* pfh{};
+
+        /// Foothold y at x (same rounding as the R-tree queries)
+        [[nodiscard]] auto GetYAt(std::int32_t x) const noexcept -> std::int32_t
+        {
+            return dy * (x - x1) / dx + y1;
+        }
+    };
+
+    [[nodiscard]] auto GetColumn(std::int32_t x) const noexcept -> std::int64_t;
+
+    std::int32_t m_xOrigin{};
+    std::vector<std::uint32_t> m_aColumnBegin; // Column c owns [m_aColumnBegin[c], m_aColumnBegin[c + 1])
+    std::vector<Span> m_aSpan;
+    std::vector<std::int32_t> m_aMinTopFrom;   // Lowest yTop from this span to its column's end
+};
+
+} // namespace ms
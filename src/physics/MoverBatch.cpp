@@ -0,0 +1,227 @@
+#include "MoverBatch.h"
+#include "FootholdColumnIndex.h"
+#include "field/foothold/StaticFoothold.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ms
+{
+
+namespace
+{
+
+auto IsWalkable(const StaticFoothold* pfh) -> bool
+{
+    return pfh && pfh->GetX1() < pfh->GetX2() && !pfh->IsOff();
+}
+
+/// A wall linked at a floor end blocks when it rises above that end
+auto IsRisingWall(const StaticFoothold* pfh, std::int32_t yEnd) -> bool
+{
+    return pfh && pfh->GetX1() == pfh->GetX2() && std::min(pfh->GetY1(), pfh->GetY2()) < yEnd;
+}
+
+auto GetYAt(const StaticFoothold* pfh, double x) -> double
+{
+    const auto x1 = static_cast<double>(pfh->GetX1());
+    const auto y1 = static_cast<double>(pfh->GetY1());
+    return y1 + (pfh->GetY2() - y1) * (x - x1) / (pfh->GetX2() - x1);
+}
+
+} // namespace
+
+void MoverBatch::Clear()
+{
+    m_aX.clear();
+    m_aY.clear();
+    m_aVX.clear();
+    m_aVY.clear();
+    m_aYPrev.clear();
+    m_aTargetVX.clear();
+    m_aWalkAcc.clear();
+    m_aWalkDrag.clear();
+    m_aGravity.clear();
+    m_aOnGround.clear();
+    m_apfh.clear();
+    m_aOrderX.clear();
+}
+
+void MoverBatch::Reserve(std::size_t nCount)
+{
+    m_aX.reserve(nCount);
+    m_aY.reserve(nCount);
+    m_aVX.reserve(nCount);
+    m_aVY.reserve(nCount);
+    m_aYPrev.reserve(nCount);
+    m_aTargetVX.reserve(nCount);
+    m_aWalkAcc.reserve(nCount);
+    m_aWalkDrag.reserve(nCount);
+    m_aGravity.reserve(nCount);
+    m_aOnGround.reserve(nCount);
+    m_apfh.reserve(nCount);
+    m_aOrderX.reserve(nCount);
+}
+
+auto MoverBatch::Add(double x, double y, double vx, double vy, std::int32_t nInputX,
+                     const StaticFoothold* pfh, const Param& param) -> std::size_t
+{
+    const auto mass = param.dMass > 0.0 ? param.dMass : 100.0;
+    const auto dir = static_cast<double>((nInputX > 0) - (nInputX < 0));
+    const bool bOnGround = IsWalkable(pfh);
+
+    m_aX.push_back(x);
+    m_aY.push_back(y);
+    m_aVX.push_back(vx);
+    m_aVY.push_back(bOnGround ? 0.0 : vy);
+    m_aYPrev.push_back(y);
+    m_aTargetVX.push_back(dir * WalkSpeed * param.dWalkSpeed);
+    m_aWalkAcc.push_back(WalkForce * param.dWalkAcc / mass);
+    m_aWalkDrag.push_back(WalkDrag * param.dWalkDrag / mass);
+    m_aGravity.push_back(GravityAcc * param.dGravity);
+    m_aOnGround.push_back(bOnGround ? 1.0 : 0.0);
+    m_apfh.push_back(bOnGround ? pfh : nullptr);
+
+    return m_aX.size() - 1;
+}
+
+void MoverBatch::Step(double dt, const FootholdColumnIndex& ground)
+{
+    Integrate(dt);
+    ResolveFootholds(ground);
+}
+
+void MoverBatch::Integrate(double dt)
+{
+    // Ground and air rules are blended by m_aOnGround instead of branched on,
+    // which keeps the loop a straight run of arithmetic over the arrays
+    const auto n = m_aX.size();
+    auto* __restrict x = m_aX.data();
+    auto* __restrict y = m_aY.data();
+    auto* __restrict vx = m_aVX.data();
+    auto* __restrict vy = m_aVY.data();
+    auto* __restrict yPrev = m_aYPrev.data();
+    const auto* __restrict targetVX = m_aTargetVX.data();
+    const auto* __restrict walkAcc = m_aWalkAcc.data();
+    const auto* __restrict walkDrag = m_aWalkDrag.data();
+    const auto* __restrict gravity = m_aGravity.data();
+    const auto* __restrict onGround = m_aOnGround.data();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // Walking: approach the target speed, or slow to rest without input
+        const auto rate = (targetVX[i] != 0.0 ? walkAcc[i] : walkDrag[i]) * dt;
+        const auto dv = std::clamp(targetVX[i] - vx[i], -rate, rate);
+        vx[i] += onGround[i] * dv;
+
+        // Falling: gravity up to terminal speed
+        const auto vyAir = std::min(vy[i] + gravity[i] * dt, FallSpeed);
+        vy[i] = (1.0 - onGround[i]) * vyAir;
+
+        yPrev[i] = y[i];
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+}
+
+void MoverBatch::ResolveFootholds(const FootholdColumnIndex& ground)
+{
+    const auto n = static_cast<std::uint32_t>(m_aX.size());
+    m_aOrderX.resize(n);
+    for (std::uint32_t i = 0; i < n; ++i)
+        m_aOrderX[i] = i;
+
+    std::sort(m_aOrderX.begin(), m_aOrderX.end(), [this](std::uint32_t a, std::uint32_t b)
+    {
+        return m_aX[a] < m_aX[b];
+    });
+
+    for (const auto i : m_aOrderX)
+    {
+        if (m_apfh[i])
+            FollowFoothold(i);
+        else
+            Land(i, ground);
+    }
+}
+
+void MoverBatch::FollowFoothold(std::size_t i)
+{
+    auto* pfh = m_apfh[i];
+    auto& x = m_aX[i];
+
+    // Walk across linked footholds until x is inside one, stopping at walls
+    // and dropping off ledges. Bounded in case of a malformed link cycle.
+    for (int nHop = 0; nHop < 64; ++nHop)
+    {
+        if (x > pfh->GetX2())
+        {
+            const auto* pNext = static_cast<const StaticFoothold*>(pfh->GetNextLink());
+            if (IsWalkable(pNext))
+            {
+                pfh = pNext;
+                continue;
+            }
+            if (IsRisingWall(pNext, pfh->GetY2()))
+            {
+                x = pfh->GetX2();
+                m_aVX[i] = 0.0;
+                break;
+            }
+
+            m_aY[i] = pfh->GetY2();
+            m_aOnGround[i] = 0.0;
+            m_apfh[i] = nullptr;
+            return;
+        }
+
+        if (x < pfh->GetX1())
+        {
+            const auto* pPrev = static_cast<const StaticFoothold*>(pfh->GetPrevLink());
+            if (IsWalkable(pPrev))
+            {
+                pfh = pPrev;
+                continue;
+            }
+            if (IsRisingWall(pPrev, pfh->GetY1()))
+            {
+                x = pfh->GetX1();
+                m_aVX[i] = 0.0;
+                break;
+            }
+
+            m_aY[i] = pfh->GetY1();
+            m_aOnGround[i] = 0.0;
+            m_apfh[i] = nullptr;
+            return;
+        }
+
+        break;
+    }
+
+    m_apfh[i] = pfh;
+    m_aY[i] = GetYAt(pfh, x);
+}
+
+void MoverBatch::Land(std::size_t i, const FootholdColumnIndex& ground)
+{
+    if (m_aVY[i] < 0.0)
+        return;
+
+    // Any floor crossed between last and this step's y
+    const auto x = static_cast<std::int32_t>(std::floor(m_aX[i]));
+    const auto yFrom = static_cast<std::int32_t>(std::floor(m_aYPrev[i]));
+    const auto yTo = static_cast<std::int32_t>(std::floor(m_aY[i])) + 1;
+
+    std::int32_t cy = 0;
+    auto* pfh = ground.FindUnderneath(x, yFrom, yTo, cy);
+    if (!pfh)
+        return;
+
+    m_aY[i] = GetYAt(pfh, m_aX[i]);
+    m_aVY[i] = 0.0;
+    m_aOnGround[i] = 1.0;
+    m_apfh[i] = pfh;
+}
+
+} // namespace ms
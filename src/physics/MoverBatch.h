@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ms
+{
+
+class FootholdColumnIndex;
+class StaticFoothold;
+
+/**
+ * @brief Movement state of many walkers/fallers, stepped as one batch
+ *
+ * Structure-of-arrays: every field lives in its own contiguous array, so the
+ * integration pass is a flat loop over doubles with no virtual calls or
+ * pointer chasing that the compiler can vectorize. Foothold work (following
+ * links, landing) runs afterwards in x order, so movers standing in the same
+ * FootholdColumnIndex column are resolved back to back against the same
+ * span table.
+ *
+ * Covers the ground/air part of CVecCtrl's work with the Physics.img
+ * constants; swimming, ladders and flying are not simulated here.
+ */
+class MoverBatch
+{
+public:
+    // Physics.img constants (see WvsPhysicalSpace2D::GetConstantCRC)
+    static constexpr double WalkForce = 140000.0;
+    static constexpr double WalkSpeed = 125.0;
+    static constexpr double WalkDrag = 80000.0;
+    static constexpr double GravityAcc = 2000.0;
+    static constexpr double FallSpeed = 670.0;
+
+    /// Per-mover movement parameters (shoe and field multipliers already applied)
+    struct Param
+    {
+        double dMass{100.0};
+        double dWalkAcc{1.0};
+        double dWalkSpeed{1.0};
+        double dWalkDrag{1.0};
+        double dGravity{1.0};
+    };
+
+    void Clear();
+    void Reserve(std::size_t nCount);
+
+    /**
+     * @brief Append a mover
+     * @param nInputX -1, 0 or 1: walk direction while on a foothold
+     * @param pfh     Foothold stood on, or nullptr when airborne
+     * @return Index of the mover in this batch
+     */
+    auto Add(double x, double y, double vx, double vy, std::int32_t nInputX,
+             const StaticFoothold* pfh, const Param& param) -> std::size_t;
+
+    /// Advance every mover by dt seconds, landing on footholds from ground
+    void Step(double dt, const FootholdColumnIndex& ground);
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_aX.size(); }
+    [[nodiscard]] auto GetX(std::size_t i) const -> double { return m_aX[i]; }
+    [[nodiscard]] auto GetY(std::size_t i) const -> double { return m_aY[i]; }
+    [[nodiscard]] auto GetVX(std::size_t i) const -> double { return m_aVX[i]; }
+    [[nodiscard]] auto GetVY(std::size_t i) const -> double { return m_aVY[i]; }
+    [[nodiscard]] auto GetFoothold(std::size_t i) const -> const StaticFoothold* { return m_apfh[i]; }
+
+private:
+    void Integrate(double dt);
+    void ResolveFootholds(const FootholdColumnIndex& ground);
+    void FollowFoothold(std::size_t i);
+    void Land(std::size_t i, const FootholdColumnIndex& ground);
+
+    // Kinematic state
+    std::vector<double> m_aX;
+    std::vector<double> m_aY;
+    std::vector<double> m_aVX;
+    std::vector<double> m_aVY;
+    std::vector<double> m_aYPrev;
+
+    // Per-mover constants for this step
+    std::vector<double> m_aTargetVX;  // Input direction times walk speed
+    std::vector<double> m_aWalkAcc;   // px/s^2 toward the target speed
+    std::vector<double> m_aWalkDrag;  // px/s^2 toward rest with no input
+    std::vector<double> m_aGravity;   // px/s^2
+    std::vector<double> m_aOnGround;  // 1.0 on a foothold, 0.0 in the air
+
+    std::vector<const StaticFoothold*> m_apfh;
+    std::vector<std::uint32_t> m_aOrderX;
+};
+
+} // namespace ms
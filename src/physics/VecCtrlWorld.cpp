@@ -0,0 +1,135 @@
+#include "VecCtrlWorld.h"
+
+#include "field/CAttrField.h"
+#include "graphics/VecCtrl.h"
+#include "life/IVecCtrlOwner.h"
+#include "physics/WvsPhysicalSpace2D.h"
+
+namespace ms
+{
+
+VecCtrlWorld::~VecCtrlWorld()
+{
+    // Controllers outliving the world must not call back into it
+    Clear();
+}
+
+void VecCtrlWorld::Register(VecCtrl* pVecCtrl)
+{
+    if (!pVecCtrl || pVecCtrl->m_bInWorld)
+        return;
+
+    pVecCtrl->m_bInWorld = true;
+    m_apVecCtrl.push_back(pVecCtrl);
+}
+
+void VecCtrlWorld::Unregister(VecCtrl* pVecCtrl)
+{
+    if (!pVecCtrl || !pVecCtrl->m_bInWorld)
+        return;
+
+    pVecCtrl->m_bInWorld = false;
+    std::erase(m_apVecCtrl, pVecCtrl);
+}
+
+void VecCtrlWorld::Clear()
+{
+    for (auto* pVecCtrl : m_apVecCtrl)
+        pVecCtrl->m_bInWorld = false;
+    m_apVecCtrl.clear();
+    m_apStepped.clear();
+    m_batch.Clear();
+}
+
+void VecCtrlWorld::Step()
+{
+    if (m_apVecCtrl.empty())
+        return;
+
+    auto& space2D = WvsPhysicalSpace2D::GetInstance();
+    const auto pField = space2D.GetFieldAttr();
+
+    // Field multipliers are the same for everyone; read the secured values once
+    double dFieldWalk = 1.0;
+    double dFieldDrag = 1.0;
+    double dFieldGravity = 1.0;
+    if (pField)
+    {
+        dFieldWalk = pField->walk;
+        dFieldDrag = pField->drag;
+        dFieldGravity = pField->g;
+    }
+
+    // ========== 1. Gather ==========
+
+    m_batch.Clear();
+    m_batch.Reserve(m_apVecCtrl.size());
+    m_apStepped.clear();
+
+    for (auto* pVecCtrl : m_apVecCtrl)
+    {
+        if (!pVecCtrl->m_bActive || pVecCtrl->m_pVecAlternate)
+            continue;
+
+        const auto* pOwner = pVecCtrl->GetOwner();
+        const auto* pShoe = pOwner ? pOwner->GetShoeAttr() : nullptr;
+        if (!pShoe)
+            pShoe = &pVecCtrl->m_CurAttrShoe;
+
+        MoverBatch::Param param;
+        param.dMass = pShoe->mass;
+        param.dWalkAcc = static_cast<double>(pShoe->walkAcc) * dFieldWalk;
+        param.dWalkSpeed = static_cast<double>(pShoe->walkSpeed) * dFieldWalk;
+        param.dWalkDrag = static_cast<double>(pShoe->walkDrag) * dFieldDrag;
+        param.dGravity = dFieldGravity;
+
+        // Keep the previous position for GetSnapshot interpolation
+        pVecCtrl->SetApToApl();
+
+        const auto& ap = pVecCtrl->m_ap;
+        m_batch.Add(static_cast<double>(ap.x), static_cast<double>(ap.y),
+                    static_cast<double>(ap.vx), static_cast<double>(ap.vy),
+                    pVecCtrl->m_nInputX, pVecCtrl->m_pfh.Get(), param);
+        m_apStepped.push_back(pVecCtrl);
+    }
+
+    if (m_apStepped.empty())
+        return;
+
+    // ========== 2. Step ==========
+
+    m_batch.Step(TickInterval / 1000.0, space2D.GetColumnIndex());
+
+    // ========== 3. Write back ==========
+
+    for (std::size_t i = 0; i < m_apStepped.size(); ++i)
+    {
+        auto* pVecCtrl = m_apStepped[i];
+        auto& ap = pVecCtrl->m_ap;
+        ap.x = m_batch.GetX(i);
+        ap.y = m_batch.GetY(i);
+        ap.vx = m_batch.GetVX(i);
+        ap.vy = m_batch.GetVY(i);
+
+        const auto* pfhOld = pVecCtrl->m_pfh.Get();
+        const auto* pfhNew = m_batch.GetFoothold(i);
+        pVecCtrl->m_pfhLast = pfhOld;
+        if (pfhOld != pfhNew)
+            pVecCtrl->m_pfh = pfhNew;
+    }
+
+    // ========== 4. Owner callbacks ==========
+
+    for (std::size_t i = 0; i < m_apStepped.size(); ++i)
+    {
+        auto* pVecCtrl = m_apStepped[i];
+        const auto* pfhNew = m_batch.GetFoothold(i);
+        if (pVecCtrl->m_pfhLast != pfhNew)
+        {
+            if (auto* pOwner = pVecCtrl->GetOwner())
+                pOwner->OnFootholdChanged(pVecCtrl->m_pfhLast, pfhNew);
+        }
+    }
+}
+
+} // namespace ms
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "physics/MoverBatch.h"
+#include "util/Singleton.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ms
+{
+
+class VecCtrl;
+
+/**
+ * @brief Steps every registered VecCtrl once per update tick, as one batch
+ *
+ * Instead of each controller integrating itself and issuing its own foothold
+ * queries, Step() gathers the active controllers into a MoverBatch, advances
+ * them together against WvsPhysicalSpace2D's column index and writes the
+ * results back. Owner callbacks (IVecCtrlOwner::OnFootholdChanged) fire only
+ * after the whole batch has been written back.
+ *
+ * Controllers join in VecCtrl::Init and leave when destroyed.
+ * Requires the foothold column index (WvsPhysicalSpace2D::SetColumnIndexEnabled).
+ */
+class VecCtrlWorld final : public Singleton<VecCtrlWorld>
+{
+    friend class Singleton<VecCtrlWorld>;
+
+public:
+    /// Fixed update interval in ms (matches Application's tick)
+    static constexpr std::int32_t TickInterval = 30;
+
+    void Register(VecCtrl* pVecCtrl);
+    void Unregister(VecCtrl* pVecCtrl);
+    void Clear();
+
+    [[nodiscard]] auto GetCount() const noexcept -> std::size_t { return m_apVecCtrl.size(); }
+
+    /// Advance all active controllers by one tick
+    void Step();
+
+private:
+    VecCtrlWorld() = default;
+    ~VecCtrlWorld() override;
+
+    std::vector<VecCtrl*> m_apVecCtrl;
+
+    // Reused every tick
+    MoverBatch m_batch;
+    std::vector<VecCtrl*> m_apStepped;
+};
+
+} // namespace ms
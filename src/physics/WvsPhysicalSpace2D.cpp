@@ -67,6 +67,8 @@ void WvsPhysicalSpace2D::Load(
     m_lFoothold.clear();
     m_mFoothold.clear();
     m_rtFoothold.Clear();
+    m_apFootholdIndex.clear();
+    m_ciFoothold.Clear();
     m_aMassRange.clear();
     m_aIndexZMass.clear();
     m_aaMassFootholdList.clear();
@@ -82,6 +84,8 @@ void WvsPhysicalSpace2D::Load(
     // ========== 1. Load Footholds ==========
     // Triple-nested: foothold/{page}/{mass}/{footholdId}
 
+    std::vector<FootholdTree::Item> aFootholdItem;
+
     if (pPropFoothold)
     {
         for (const auto& [pageName, pPageProp] : pPropFoothold->GetChildren())
@@ -156,10 +160,10 @@ void WvsPhysicalSpace2D::Load(
                     m_lFoothold.push_back(pfh);
                     m_mFoothold[dwSN] = pfh;
 
-                    // Insert into R*-tree spatial index
-                    using Tree = TRSTree<std::int32_t, std::shared_ptr<StaticFoothold>, 2, 4, 2>;
-                    auto bounds = Tree::MakeBounds2D(x1, y1, x2, y2);
-                    m_rtFoothold.Insert(bounds, pfh);
+                    // Queue for the R-tree, built once all footholds are read
+                    aFootholdItem.push_back({FootholdTree::MakeBounds2D(x1, y1, x2, y2),
+                                             static_cast<std::uint32_t>(m_apFootholdIndex.size())});
+                    m_apFootholdIndex.push_back(pfh.get());
 
                     // Ensure mass arrays are large enough
                     auto nZMassU = static_cast<std::size_t>(nZMass);
@@ -214,6 +218,10 @@ void WvsPhysicalSpace2D::Load(
         }
     }
 
+    m_rtFoothold.Build(std::move(aFootholdItem));
+    if (m_bColumnIndex)
+        m_ciFoothold.Build(m_apFootholdIndex);
+
     // ========== 2. Adjust MBR from map info VR bounds ==========
 
     if (pInfo)
@@ -336,14 +344,11 @@ void WvsPhysicalSpace2D::GetCrossCandidate(
     if (!apResult)
         return;
 
-    using Tree = TRSTree<std::int32_t, std::shared_ptr<StaticFoothold>, 2, 4, 2>;
-    const auto query = Tree::MakeBounds2D(x1, y1, x2, y2);
-
-    std::vector<std::shared_ptr<StaticFoothold>> hits;
-    m_rtFoothold.Search(query, hits);
-
-    for (const auto& pFH : hits)
-        apResult->push_back(pFH.get());
+    const auto query = FootholdTree::MakeBounds2D(x1, y1, x2, y2);
+    m_rtFoothold.Search(query, [&](std::uint32_t nIndex)
+    {
+        apResult->push_back(m_apFootholdIndex[nIndex]);
+    });
 }
 
 auto WvsPhysicalSpace2D::GetBaseZMass() -> std::int32_t
@@ -500,21 +505,18 @@ auto WvsPhysicalSpace2D::GetFootholdAbove(
     if (yMax > y)
         return nullptr;
 
-    using Tree = TRSTree<std::int32_t, std::shared_ptr<StaticFoothold>, 2, 4, 2>;
-    const auto query = Tree::MakeBounds2D(x - 1, yMax, x + 1, y + 1);
-
-    std::vector<std::shared_ptr<StaticFoothold>> hits;
-    m_rtFoothold.Search(query, hits);
+    const auto query = FootholdTree::MakeBounds2D(x - 1, yMax, x + 1, y + 1);
 
     StaticFoothold* pfhAbove = nullptr;
-    for (const auto& pfh : hits)
+    m_rtFoothold.Search(query, [&](std::uint32_t nIndex)
     {
+        auto* pfh = m_apFootholdIndex[nIndex];
         if (!pfh || pfh->IsOff())
-            continue;
+            return;
         if (pfh->GetX1() >= pfh->GetX2())
-            continue;
+            return;
         if (pfh->GetX1() > x || pfh->GetX2() < x)
-            continue;
+            return;
 
         auto dy = pfh->GetY2() - pfh->GetY1();
         auto yAtX = dy * (x - pfh->GetX1())
@@ -525,9 +527,9 @@ auto WvsPhysicalSpace2D::GetFootholdAbove(
         {
             yMax = yAtX;
             *pcy = yAtX;
-            pfhAbove = pfh.get();
+            pfhAbove = pfh;
         }
-    }
+    });
     return pfhAbove;
 }
 
@@ -539,21 +541,29 @@ auto WvsPhysicalSpace2D::GetFootholdUnderneath(
     if (yMin < y)
         return nullptr;
 
-    using Tree = TRSTree<std::int32_t, std::shared_ptr<StaticFoothold>, 2, 4, 2>;
-    const auto query = Tree::MakeBounds2D(x - nRangeX, y - 1, x + nRangeX, yMin);
+    // The result only depends on footholds spanning x (nRangeX just widens
+    // the R-tree box), which is exactly what the column table holds
+    if (!m_ciFoothold.IsEmpty())
+    {
+        std::int32_t cy{};
+        auto* pfh = m_ciFoothold.FindUnderneath(x, y, yMin, cy);
+        if (pcy)
+            *pcy = cy;
+        return pfh;
+    }
 
-    std::vector<std::shared_ptr<StaticFoothold>> hits;
-    m_rtFoothold.Search(query, hits);
+    const auto query = FootholdTree::MakeBounds2D(x - nRangeX, y - 1, x + nRangeX, yMin);
 
     StaticFoothold* pfhUnderneath = nullptr;
-    for (const auto& pfh : hits)
+    m_rtFoothold.Search(query, [&](std::uint32_t nIndex)
     {
+        auto* pfh = m_apFootholdIndex[nIndex];
         if (!pfh || pfh->IsOff())
-            continue;
+            return;
         if (pfh->GetX1() >= pfh->GetX2())
-            continue;
+            return;
         if (pfh->GetX1() > x || pfh->GetX2() < x)
-            continue;
+            return;
 
         auto dy = pfh->GetY2() - pfh->GetY1();
         auto yAtX = dy * (x - pfh->GetX1())
@@ -563,9 +573,9 @@ auto WvsPhysicalSpace2D::GetFootholdUnderneath(
         if (yAtX >= y && yAtX < yMin)
         {
             yMin = yAtX;
-            pfhUnderneath = pfh.get();
+            pfhUnderneath = pfh;
         }
-    }
+    });
 
     if (pcy)
         *pcy = yMin;
@@ -4,9 +4,10 @@
 #include "field/LadderOrRope.h"
 #include "field/foothold/FootholdSplit.h"
 #include "field/foothold/StaticFoothold.h"
+#include "physics/FootholdColumnIndex.h"
 #include "physics/IWvsPhysicalSpace2D.h"
 #include "util/Singleton.h"
-#include "util/TRSTree.h"
+#include "util/StaticRTree.h"
 
 #include <cstdint>
 #include <list>
@@ -42,6 +43,9 @@ public:
 
     // ========== Loading ==========
 
+    /// Build the per-column ground table on Load (default on)
+    void SetColumnIndexEnabled(bool bEnable) noexcept { m_bColumnIndex = bEnable; }
+
     void Load(
         std::shared_ptr<WzProperty> pPropFoothold,
         std::shared_ptr<WzProperty> pLadderRope,
@@ -64,6 +68,7 @@ public:
     // ========== Accessors ==========
 
     [[nodiscard]] auto GetMBR() const -> const Rect& { return m_rcMBR; }
+    [[nodiscard]] auto GetColumnIndex() const -> const FootholdColumnIndex& { return m_ciFoothold; }
     [[nodiscard]] auto GetCRC() -> std::uint32_t { return m_dwCRC; }
     [[nodiscard]] auto GetZMassByIndex(std::int32_t nIndex) const -> std::int32_t;
     [[nodiscard]] auto GetMassRange(std::int32_t nZMass) const -> const Range&;
@@ -124,7 +129,16 @@ private:
     std::vector<std::int32_t> m_aIndexZMass;
     std::vector<std::vector<std::uint32_t>> m_aaMassFootholdList;
     std::int32_t m_nBaseZMass{};
-    TRSTree<std::int32_t, std::shared_ptr<StaticFoothold>, 2, 4, 2> m_rtFoothold;
+    // Footholds never change after Load, so the index is bulk-loaded once;
+    // its payloads index m_apFootholdIndex
+    using FootholdTree = TStaticRTree<std::int32_t, 16>;
+    FootholdTree m_rtFoothold;
+    std::vector<StaticFoothold*> m_apFootholdIndex;
+
+    // Answers GetFootholdUnderneath without the R-tree when built
+    FootholdColumnIndex m_ciFoothold;
+    bool m_bColumnIndex{true};
+
     std::list<std::shared_ptr<StaticFoothold>> m_lFoothold;
     std::map<std::uint32_t, std::shared_ptr<StaticFoothold>> m_mFoothold;
     std::vector<LadderOrRope> m_aLadderOrRope;
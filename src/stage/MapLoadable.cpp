@@ -1,8 +1,12 @@
 #include "MapLoadable.h"
+#include "app/Configuration.h"
 #include "audio/SoundMan.h"
+#include "graphics/CameraCtrl.h"
+#include "physics/VecCtrlWorld.h"
 #include "physics/WvsPhysicalSpace2D.h"
 #include "util/Rand32.h"
 #include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DChunkCache.h"
 #include "graphics/WzGr2DLayer.h"
 #include "util/Logger.h"
 #include "graphics/WzGr2DCanvas.h"
@@ -11,6 +15,7 @@
 #include "wz/WzResMan.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #ifdef MS_DEBUG_CANVAS
 #include "debug/DebugOverlay.h"
@@ -37,6 +42,9 @@ void MapLoadable::Init(void* param)
     // Reset camera to world origin — clears any active animation chain (tremble, etc.)
     gr.ResetCameraPosition(0, 0);
 
+    // Camera commands of the previous field don't carry over
+    CameraCtrl::Manager::GetInstance().OnSetField();
+
     // Clear any existing layers
     ClearAllLayers();
 
@@ -103,11 +111,20 @@ void MapLoadable::Update()
         }
     }
 
+    // Move every registered VecCtrl in one batch
+    VecCtrlWorld::GetInstance().Step();
+
     // Update camera movement effect
     UpdateCameraMoveEffect();
 
     // Update all object layers
     UpdateObjectLayers();
+
+    // Re-bake static chunks broken by layer changes
+    if (m_pChunkCache)
+    {
+        m_pChunkCache->Update();
+    }
 }
 
 void MapLoadable::UpdateCameraMoveEffect()
@@ -501,57 +518,9 @@ auto MapLoadable::LoadAnimatedLayer(const std::shared_ptr<WzGr2DLayer>& layer,
         return 0;
     }
 
-    std::size_t frameCount = 0;
-
-    // Iterate through numbered children (0, 1, 2, ...)
-    for (std::size_t i = 0;; ++i)
-    {
-        auto frameProp = prop->GetChild(std::to_string(i));
-        if (!frameProp)
-        {
-            break; // No more frames
-        }
-
-        // Get canvas from frame property
-        auto wzCanvas = frameProp->GetCanvas();
-        auto canvas = wzCanvas ? std::make_shared<WzGr2DCanvas>(wzCanvas, frameProp) : nullptr;
-        if (!canvas)
-        {
-            // Frame might be the canvas itself
-            auto frameWzCanvas = prop->GetChild(std::to_string(i))->GetCanvas();
-            canvas = frameWzCanvas ? std::make_shared<WzGr2DCanvas>(frameWzCanvas, frameProp) : nullptr;
-            if (!canvas)
-            {
-                continue; // Skip frames without canvas
-            }
-        }
-
-        // Get frame delay (default 100ms)
-        std::int32_t delay = 100;
-        auto delayProp = frameProp->GetChild("delay");
-        if (delayProp)
-        {
-            delay = delayProp->GetInt(100);
-        }
-
-        // Get alpha values (a0 and a1 for interpolation)
-        std::uint8_t alpha0 = 255;
-        std::uint8_t alpha1 = 255;
-        auto a0Prop = frameProp->GetChild("a0");
-        auto a1Prop = frameProp->GetChild("a1");
-        if (a0Prop)
-        {
-            alpha0 = static_cast<std::uint8_t>(a0Prop->GetInt(255));
-        }
-        if (a1Prop)
-        {
-            alpha1 = static_cast<std::uint8_t>(a1Prop->GetInt(255));
-        }
-
-        // Insert canvas into layer
-        layer->InsertCanvas(canvas, delay, alpha0, alpha1);
-        ++frameCount;
-    }
+    // Identical objects share one clip (canvases and textures); the layer
+    // only keeps its own position in it
+    std::size_t frameCount = layer->InsertClip(get_gr().GetClipCache().Get(prop));
 
     if (frameCount > 0)
     {
@@ -1140,6 +1109,12 @@ void MapLoadable::ClearAllLayers()
 
     auto& gr = get_gr();
 
+    // Give baked layers back their own draw calls before they go
+    if (m_pChunkCache)
+    {
+        m_pChunkCache->Clear();
+    }
+
     // Remove all background layers
     ClearBackLayers();
 
@@ -1273,9 +1248,65 @@ void MapLoadable::LoadMap()
     // Set default footstep sound
     SetFootStepSound("");
 
+    // Collapse static tiles/objects into cached chunks
+    if (Configuration::GetInstance().IsStaticLayerBakingEnabled())
+    {
+        BakeStaticLayers();
+    }
+
     LOG_DEBUG("LoadMap: Map load complete");
 }
 
+void MapLoadable::BakeStaticLayers()
+{
+    // A rebuilt map starts from scratch: no runs, no exclusions
+    if (!m_pChunkCache)
+    {
+        m_pChunkCache = std::make_unique<WzGr2DChunkCache>();
+    }
+    m_pChunkCache->Clear();
+
+    // Scripts address named/tagged objects (SetObjectMove, tag visibility),
+    // so only anonymous tiles and objects are baked
+    std::unordered_set<const WzGr2DLayer*> sScripted;
+    for (const auto& [name, layer] : m_mpLayerObj)
+    {
+        sScripted.insert(layer.get());
+    }
+    for (const auto& [tag, layer] : m_mTaggedLayer)
+    {
+        sScripted.insert(layer.get());
+    }
+    for (const auto& [tag, plLayer] : m_mTagedObj)
+    {
+        if (!plLayer)
+            continue;
+        for (const auto& layer : *plLayer)
+        {
+            sScripted.insert(layer.get());
+        }
+    }
+
+    WzGr2DChunkCache::LayerRun aCandidate;
+    aCandidate.reserve(m_lpLayerGen.size() + m_lpLayerObj.size());
+    for (const auto* plLayer : {&m_lpLayerGen, &m_lpLayerObj})
+    {
+        for (const auto& layer : *plLayer)
+        {
+            if (layer && !sScripted.contains(layer.get()))
+            {
+                aCandidate.push_back(layer);
+            }
+        }
+    }
+
+    m_pChunkCache->Bake(aCandidate);
+
+    LOG_DEBUG("BakeStaticLayers: {} candidates -> {} runs, {} chunks",
+              aCandidate.size(), m_pChunkCache->GetRunCount(),
+              m_pChunkCache->GetChunkCount());
+}
+
 void MapLoadable::RestoreTile()
 {
     // Based on CMapLoadable::RestoreTile at 0xbea1d0
@@ -2215,6 +2246,9 @@ void MapLoadable::SetObjectVisible(const std::string& sName, bool bVisible)
     if (it == m_mpLayerObj.end() || !it->second)
         return;
 
+    if (m_pChunkCache)
+        m_pChunkCache->Invalidate(it->second);
+
     it->second->SetVisible(bVisible);
 }
 
@@ -2228,6 +2262,9 @@ void MapLoadable::SetObjectMove(const std::string& sName, std::int32_t nX,
         return;
 
     auto& layer = it->second;
+    if (m_pChunkCache)
+        m_pChunkCache->Invalidate(layer);
+
     auto curTime = layer->GetCurrentTime();
     auto curX = layer->GetX();
     auto curY = layer->GetY();
@@ -2349,6 +2386,9 @@ void MapLoadable::SetLayerListVisible(
     {
         if (!layer) continue;
 
+        if (m_pChunkCache)
+            m_pChunkCache->Invalidate(layer);
+
         if (bVisible)
         {
             layer->SetVisible(true);
@@ -2564,9 +2604,20 @@ void MapLoadable::FootHoldMove(std::int32_t nSN, std::int32_t nX, std::int32_t n
 {
     // 0xbf54a0 — CMapLoadable::FootHoldMove
     // TODO: stub — move foothold position
-    (void)nSN;
     (void)nX;
     (void)nY;
+
+    // Geometry around a moving foothold can no longer come from baked chunks
+    if (m_pChunkCache && m_pSpace2D)
+    {
+        if (const auto* pfh = m_pSpace2D->GetFoothold(static_cast<std::uint32_t>(nSN)))
+        {
+            m_pChunkCache->InvalidateRect({std::min(pfh->GetX1(), pfh->GetX2()),
+                                           std::min(pfh->GetY1(), pfh->GetY2()),
+                                           std::max(pfh->GetX1(), pfh->GetX2()) + 1,
+                                           std::max(pfh->GetY1(), pfh->GetY2()) + 1});
+        }
+    }
 }
 
 void MapLoadable::FootHoldStateChange(std::int32_t nSN, std::int32_t nState)
@@ -15,6 +15,7 @@ namespace ms
 {
 
 class WzCanvas;
+class WzGr2DChunkCache;
 class WzGr2DLayer;
 class WzProperty;
 class WvsPhysicalSpace2D;
@@ -523,6 +524,14 @@ protected:
      */
     void RestoreTile();
 
+    /**
+     * @brief Bake static tile/object layers into cached render chunks
+     *
+     * Runs at the end of LoadMap when enabled in Configuration. Named and
+     * tagged objects stay live since scripts can move or hide them.
+     */
+    void BakeStaticLayers();
+
     /**
      * @brief Restore object layers from WZ property
      *
@@ -723,6 +732,9 @@ protected:
     std::map<std::string, std::shared_ptr<WzGr2DLayer>> m_mpLayerObj;
     std::list<std::shared_ptr<WzGr2DLayer>> m_lpLayerTransient;
 
+    // Static tiles/objects baked into render chunks (null when disabled)
+    std::unique_ptr<WzGr2DChunkCache> m_pChunkCache;
+
     // --- Obstacle / Reflection / Quest visibility ---
     std::list<std::shared_ptr<Obstacle>> m_lpObstacle;
     std::list<std::shared_ptr<ReflectionInfo>> m_lpRefInfo;
@@ -1,5 +1,6 @@
 #include "MapViewStage.h"
 #include "app/Application.h"
+#include "graphics/CameraCtrl.h"
 #include "graphics/WzGr2D.h"
 #include "input/InputSystem.h"
 #include "util/Logger.h"
@@ -21,6 +22,7 @@ constexpr std::int32_t kVK_UP     = 38;
 constexpr std::int32_t kVK_RIGHT  = 39;
 constexpr std::int32_t kVK_DOWN   = 40;
 constexpr std::int32_t kVK_A      = 0x41;
+constexpr std::int32_t kVK_C      = 0x43;
 constexpr std::int32_t kVK_D      = 0x44;
 constexpr std::int32_t kVK_F      = 0x46;
 constexpr std::int32_t kVK_R      = 0x52;
@@ -97,13 +99,35 @@ void MapViewStage::OnKeyDown(std::int32_t keyCode)
         ReloadMap();
         break;
 
+    case kVK_C:
+        GlideToCenter();
+        break;
+
     default:
         break;
     }
 }
 
+void MapViewStage::GlideToCenter()
+{
+    auto* vrect = GetViewRangeRect();
+    if (!vrect || (vrect->left == 0 && vrect->right == 0))
+        return;
+
+    CameraCtrl::AbsMoveCommand cmd;
+    cmd.ptDest = {(vrect->left + vrect->right) / 2, (vrect->top + vrect->bottom) / 2};
+    cmd.tDelay = 600;
+    cmd.type = Interpolation::Sine;
+    if (!CameraCtrl::Manager::GetInstance().QueueCommand(cmd))
+        LOG_WARN("MapViewStage: Camera command queue is full");
+}
+
 void MapViewStage::UpdateCamera()
 {
+    // A queued glide owns the camera until it finishes
+    if (CameraCtrl::Manager::GetInstance().IsWorking())
+        return;
+
     auto& input = InputSystem::GetInstance();
 
     // Determine speed (shift = fast)
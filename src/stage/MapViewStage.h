@@ -19,6 +19,7 @@ namespace ms
  * - Shift: fast camera mode
  * - F: toggle free camera (unclamped from view range)
  * - R: reload current map
+ * - C: glide back to the map center (a queued CameraCtrl command)
  * - ESC: exit
  */
 class MapViewStage final : public MapLoadable
@@ -38,6 +39,9 @@ private:
     /// Poll keyboard state and move camera accordingly
     void UpdateCamera();
 
+    /// Queue a smooth camera move to the middle of the view range
+    void GlideToCenter();
+
     /// Update window title with map info, camera pos, FPS
     void UpdateHUD();
 
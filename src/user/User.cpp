@@ -1,6 +1,22 @@
 #include "User.h"
 
+#include "network/InPacket.h"
+
 namespace ms
 {
 
+void User::OnAvatarModified(InPacket& iPacket)
+{
+    const auto nFlag = iPacket.Decode1();
+    if (nFlag & 1)
+    {
+        AvatarLook al;
+        al.Initialize();
+        al.Decode(iPacket);
+        SetAvatarLook(al);
+    }
+    // TODO: speed (flag & 2), carry item effect (flag & 4) and the ring
+    // records that follow
+}
+
 } // namespace ms
@@ -9,6 +9,8 @@
 namespace ms
 {
 
+class InPacket;
+
 /**
  * @brief Character user — combines field life and avatar visual state
  *
@@ -20,6 +22,16 @@ class User : public Life, public Avatar
 public:
     ~User() override = default;
 
+    using Avatar::OnAvatarModified;
+
+    /**
+     * @brief Handle a look update broadcast for this user
+     *
+     * Based on CUserRemote::OnAvatarModified. The decoded look is applied
+     * through SetAvatarLook, so a repeated or pet-only look rebuilds nothing.
+     */
+    void OnAvatarModified(InPacket& iPacket);
+
     // --- Character stat ---
     GW_CharacterStat m_characterStat;
 };
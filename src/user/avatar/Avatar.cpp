@@ -19,6 +19,7 @@
 #include "graphics/WzGr2DTypes.h"
 #include "templates/morph/MorphTemplate.h"
 #include "user/UserLocal.h"
+#include "user/avatar/AvatarPrefetcher.h"
 #include "util/Logger.h"
 
 #include <algorithm>
@@ -31,6 +32,14 @@
 namespace ms
 {
 
+Avatar::~Avatar()
+{
+    // Queued jobs are keyed by this address, which a later Avatar may reuse.
+    // Avatars owned by singletons can outlive the prefetcher at exit.
+    if (AvatarPrefetcher::IsAlive())
+        AvatarPrefetcher::GetInstance().Cancel(this);
+}
+
 // ============================================================================
 // Init (public) — from decompiled CAvatar::Init @ 0x6030d0
 // ============================================================================
@@ -48,6 +57,7 @@ void Avatar::Init(
     m_nScale = nScale;
     Init(std::move(pOrigin), x, y, std::move(pOverlay), z);
     m_avatarLook = al;
+    m_uAvatarLookHash = al.GetHash();
     m_nMoveAction = nMoveAction;
     m_nDefaultEmotion = nDefaultEmotion;
     NotifyAvatarModified(false);
@@ -244,11 +254,62 @@ void Avatar::Init(
 void Avatar::NotifyAvatarModified(bool bResetAction)
 {
     OnAvatarModified();
+    SchedulePrefetch();
 
     if (bResetAction)
         PrepareActionLayer(6, 120, 0, 0);
 }
 
+auto Avatar::SetAvatarLook(const AvatarLook& al) -> bool
+{
+    // Busy channels resend unchanged looks; a differing hash skips the compare
+    const auto uHash = al.GetHash();
+    if (uHash == m_uAvatarLookHash && al == m_avatarLook)
+        return false;
+
+    const auto diff = m_avatarLook.Diff(al);
+    m_avatarLookLast = m_avatarLook;
+    m_avatarLook = al;
+    m_uAvatarLookHash = uHash;
+
+    const bool bCharacter = diff.AffectsAction();
+    const bool bTamingMob = diff.AffectsTamingMob();
+    const bool bFace = diff.AffectsFace();
+    if (!bCharacter && !bTamingMob && !bFace)
+    {
+        OnAvatarModified();
+        return false;
+    }
+
+    // Cached frames were composed from the old equipment; drop only the
+    // set the changed slots feed
+    if (bCharacter)
+    {
+        ClearCharacterActionLayer(0);
+        ClearCharacterActionLayer(1);
+    }
+    // On a vehicle the frame cache is keyed by the taming mob frames
+    if (bTamingMob || (bCharacter && is_vehicle(m_nRidingVehicleID)))
+    {
+        ClearTamingMobActionLayer(0);
+        ClearTamingMobActionLayer(1);
+    }
+
+    if (bCharacter || bTamingMob)
+        NotifyAvatarModified(true);
+    else
+        OnAvatarModified();
+
+    if (bFace)
+    {
+        // Keep the remaining time of a running emotion
+        const auto tNow = static_cast<std::int32_t>(Application::GetInstance().GetUpdateTime());
+        const auto tLeft = m_tEmotionEnd - tNow;
+        PrepareFaceLayer(m_nEmotion != 0 && tLeft > 0 ? tLeft : -1);
+    }
+    return true;
+}
+
 // Invalid/sentinel action (used when mechanic mode suppresses an action)
 inline constexpr auto kActionInvalid = static_cast<CharacterAction>(-1);
 
@@ -751,66 +812,18 @@ void Avatar::PrepareActionLayer(
 
     if (!bCached)
     {
-        // --- Prepare parameters for loading ---
-        std::int32_t aAvatarHairEquip[32]{};
-        GetModifiedAvatarHairEquip(aAvatarHairEquip);
-
         // Handle forced appearance
         if (m_bForcingAppearance && m_nAvatarFaceForced)
             m_avatarLook.nFace = m_nAvatarFaceForced;
 
-        auto nSkin = m_avatarLook.nSkin;
-        if (m_bForcingAppearance && m_nAvatarSkinForced > -1)
-            nSkin = m_nAvatarSkinForced;
-
-        // Weapon sticker
-        auto nWeaponStickerID = m_avatarLook.nWeaponStickerID;
-        if (m_nForcedMoveAction != -1 && m_nForcedMoveAction == nAction)
-            nWeaponStickerID = kDefaultWeaponSticker;
-        if (m_nForcedStandAction != -1 && m_nForcedStandAction == nAction)
-            nWeaponStickerID = kDefaultWeaponSticker;
-        if (m_bForcingAppearance
-            && get_weapon_type(m_aOnlyAvatarHairEquipForced[11]) != 0)
-            nWeaponStickerID = 0;
-
-        auto nMixedHairColor = m_avatarLook.nMixedHairColor;
-        auto nMixHairPercent = m_avatarLook.nMixHairPercent;
-
-        if (m_bForcingAppearance && GetRolePlayingCharacterIndex() >= 3)
-        {
-            nWeaponStickerID = 0;
-            nMixedHairColor = 0;
-            nMixHairPercent = 0;
-        }
-
         // Custom riding set
         auto aCustomRiding = m_aCustomRiding;
         LoadCustomRidingSet(m_nRidingVehicleID, aCustomRiding);
 
-        auto nRidingForLoad = m_bSitAction ? 0 : m_nRidingVehicleID;
-
         // --- Load character action frames ---
         {
             std::vector<std::shared_ptr<CharacterActionFrameEntry>> apFE;
-            ActionMan::GetInstance().LoadCharacterAction(
-                nAction,
-                m_avatarLook.nGender,
-                nSkin,
-                nJob,
-                aAvatarHairEquip,
-                apFE,
-                nWeaponStickerID,
-                nRidingForLoad,
-                m_bTamingMobTired,
-                m_nGhostIndex,
-                nGatherToolID,
-                bDrawElfEar,
-                m_nChangeWeaponLook,
-                m_nLarknessState,
-                GetPortableChairID(),
-                nMixedHairColor,
-                nMixHairPercent,
-                m_nBattlePvPPAvatar);
+            MakeCharacterActionLoad(nAction, nGatherToolID, bDrawElfEar).Load(apFE);
             ai.aaAction[nAction] = std::move(apFE);
         }
 
@@ -825,10 +838,7 @@ void Avatar::PrepareActionLayer(
     }
 
     // --- Get action data ---
-    const auto* pActionData = (nAction >= 0
-        && static_cast<std::size_t>(nAction) < ACTIONDATA_COUNT)
-        ? &s_aCharacterActionData[static_cast<std::size_t>(nAction)]
-        : nullptr;
+    const auto* pActionData = ActionMan::GetInstance().GetActionData(nAction);
 
     auto nRepeatFrame = (pActionData && pActionData->m_nRepeatFrame > 0)
         ? pActionData->m_nRepeatFrame : 0;
@@ -964,12 +974,10 @@ void Avatar::PrepareActionLayer(
 
             if (m_pLayerUnderCharacter && frame->pCanvasUnderCharacter)
             {
-                ApplyScaleAndOffset(m_pLayerUnderCharacter, frame->pCanvasUnderCharacter, i);
                 m_pLayerUnderCharacter->InsertCanvas(frame->pCanvasUnderCharacter, 100);
             }
             if (m_pLayerOverCharacter && frame->pCanvasOverCharacter)
             {
-                ApplyScaleAndOffset(m_pLayerOverCharacter, frame->pCanvasOverCharacter, i);
                 m_pLayerOverCharacter->InsertCanvas(frame->pCanvasOverCharacter, 100);
             }
         }
@@ -983,12 +991,10 @@ void Avatar::PrepareActionLayer(
 
             if (m_pLayerUnderFace && frame->pCanvasUnderFace)
             {
-                ApplyScaleAndOffset(m_pLayerUnderFace, frame->pCanvasUnderFace, i);
                 m_pLayerUnderFace->InsertCanvas(frame->pCanvasUnderFace, 100);
             }
             if (m_pLayerOverFace && frame->pCanvasOverFace)
             {
-                ApplyScaleAndOffset(m_pLayerOverFace, frame->pCanvasOverFace, i);
                 m_pLayerOverFace->InsertCanvas(frame->pCanvasOverFace, 100);
             }
         }
@@ -1032,12 +1038,10 @@ void Avatar::PrepareActionLayer(
 
             if (m_pLayerUnderFace && frame->pCanvasUnderFace)
             {
-                ApplyScaleAndOffset(m_pLayerUnderFace, frame->pCanvasUnderFace, i);
                 m_pLayerUnderFace->InsertCanvas(frame->pCanvasUnderFace, 100);
             }
             if (m_pLayerOverFace && frame->pCanvasOverFace)
             {
-                ApplyScaleAndOffset(m_pLayerOverFace, frame->pCanvasOverFace, i);
                 m_pLayerOverFace->InsertCanvas(frame->pCanvasOverFace, 100);
             }
         }
@@ -1665,14 +1669,6 @@ void Avatar::LoadMechanicRocket()
     // TODO: implement mechanic rocket booster layer loading
 }
 
-void Avatar::ApplyScaleAndOffset(
-    [[maybe_unused]] std::shared_ptr<WzGr2DLayer>& pDstLayer,
-    [[maybe_unused]] const std::shared_ptr<WzGr2DCanvas>& pSrcCanvas,
-    [[maybe_unused]] std::int32_t nFrameIndex)
-{
-    // TODO: apply scale and offset from canvas to layer frame
-}
-
 void Avatar::GetModifiedAvatarHairEquip(std::int32_t (&aOut)[32]) const
 {
     // Copy base equipment array, apply forced overrides
@@ -1684,6 +1680,165 @@ void Avatar::GetModifiedAvatarHairEquip(std::int32_t (&aOut)[32]) const
     }
 }
 
+void Avatar::CharacterActionLoad::Load(
+    std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE) const
+{
+    // LoadCharacterAction takes the equipment array by mutable pointer
+    std::int32_t aEquip[32];
+    std::memcpy(aEquip, aAvatarHairEquip, sizeof(aEquip));
+
+    ActionMan::GetInstance().LoadCharacterAction(
+        nAction, nGender, nSkin, nJob, aEquip, apFE,
+        nWeaponStickerID, nVehicleID, bTamingMobTired, nGhostIndex,
+        nGatherToolID, bDrawElfEar, nChangeWeaponLook, nLarknessState,
+        nPortableChair, nMixedHairColor, nMixPercent, nBattlePvPAvatar);
+}
+
+auto Avatar::MakeCharacterActionLoad(
+    std::int32_t nAction,
+    std::int32_t nGatherToolID,
+    bool bDrawElfEar) const -> CharacterActionLoad
+{
+    CharacterActionLoad load;
+    load.nAction = nAction;
+    load.nGender = m_avatarLook.nGender;
+    load.nJob = m_avatarLook.nJob;
+    GetModifiedAvatarHairEquip(load.aAvatarHairEquip);
+
+    load.nSkin = m_avatarLook.nSkin;
+    if (m_bForcingAppearance && m_nAvatarSkinForced > -1)
+        load.nSkin = m_nAvatarSkinForced;
+
+    // Weapon sticker
+    load.nWeaponStickerID = m_avatarLook.nWeaponStickerID;
+    if (m_nForcedMoveAction != -1 && m_nForcedMoveAction == nAction)
+        load.nWeaponStickerID = kDefaultWeaponSticker;
+    if (m_nForcedStandAction != -1 && m_nForcedStandAction == nAction)
+        load.nWeaponStickerID = kDefaultWeaponSticker;
+    if (m_bForcingAppearance
+        && get_weapon_type(m_aOnlyAvatarHairEquipForced[11]) != 0)
+        load.nWeaponStickerID = 0;
+
+    load.nMixedHairColor = m_avatarLook.nMixedHairColor;
+    load.nMixPercent = m_avatarLook.nMixHairPercent;
+    if (m_bForcingAppearance && GetRolePlayingCharacterIndex() >= 3)
+    {
+        load.nWeaponStickerID = 0;
+        load.nMixedHairColor = 0;
+        load.nMixPercent = 0;
+    }
+
+    load.nVehicleID = m_bSitAction ? 0 : m_nRidingVehicleID;
+    load.bTamingMobTired = m_bTamingMobTired;
+    load.nGhostIndex = m_nGhostIndex;
+    load.nGatherToolID = nGatherToolID;
+    load.bDrawElfEar = bDrawElfEar;
+    load.nChangeWeaponLook = m_nChangeWeaponLook;
+    load.nLarknessState = m_nLarknessState;
+    load.nPortableChair = GetPortableChairID();
+    load.nBattlePvPAvatar = m_nBattlePvPPAvatar;
+    return load;
+}
+
+namespace
+{
+
+/// How far off screen (px) another avatar still gets its moves prefetched
+constexpr std::int32_t PrefetchViewMargin = 200;
+
+/// Basic attack actions of a weapon type (get_weapon_type code)
+auto GetWeaponAttackActions(std::int32_t nWeaponType) -> std::vector<CharacterAction>
+{
+    using CA = CharacterAction;
+    switch (nWeaponType)
+    {
+    case 30: case 31: case 32: case 33: case 34: case 35: case 37: case 48:
+        return {CA::Swingo1, CA::Swingo2, CA::Swingo3, CA::Stabo1, CA::Stabo2};
+    case 38: case 40: case 41: case 42: case 56: case 57:
+        return {CA::Swingt1, CA::Swingt2, CA::Swingt3, CA::Stabt1};
+    case 43: case 44:
+        return {CA::Stabt1, CA::Stabt2, CA::Swingp1, CA::Swingp2};
+    case 45: case 52:
+        return {CA::Shoot1};
+    case 46: case 49: case 53:
+        return {CA::Shoot2};
+    case 47:
+        return {CA::Swingo1, CA::Swingo2};
+    default:
+        return {};
+    }
+}
+
+} // namespace
+
+void Avatar::SchedulePrefetch()
+{
+    auto& prefetcher = AvatarPrefetcher::GetInstance();
+    prefetcher.Cancel(this);
+
+    // Morphs and taming mobs load through their own paths
+    if (m_bDelayedLoad || m_dwMorphTemplateID || IsRidingEx())
+        return;
+
+    // Other avatars are only worth loading ahead while they can be seen;
+    // off-screen ones load on demand once they walk into view
+    const bool bLocal = this == &UserLocal::GetInstance();
+    if (!bLocal && !IsNearView())
+        return;
+
+    const bool bDrawElfEar = m_bForcingAppearance ? m_bDrawElfEarForced : m_avatarLook.bDrawElfEar;
+    auto Queue = [&](std::int32_t nPriority, CharacterAction nAction)
+    {
+        const auto nRaw = static_cast<std::int32_t>(nAction);
+        if (nRaw < 0 || static_cast<std::size_t>(nRaw) >= ACTIONDATA_COUNT)
+            return;
+        const auto& ai = m_aiAction[0];
+        if (ai.HasAction(nRaw))
+            return;
+
+        prefetcher.Schedule(nPriority, this, [load = MakeCharacterActionLoad(nRaw, 0, bDrawElfEar)]
+        {
+            std::vector<std::shared_ptr<CharacterActionFrameEntry>> apFE;
+            load.Load(apFE);
+        });
+    };
+
+    // Stand and walk resolve through the move-action mapping, so weapon
+    // stance and job variants come out the same as at play time
+    auto Move = [&](MoveActionType type)
+    {
+        return MoveAction2RawAction(static_cast<std::int32_t>(type) << 1, nullptr, false);
+    };
+
+    Queue(AvatarPrefetcher::Priority_Stand, Move(MoveActionType::Stand));
+    Queue(AvatarPrefetcher::Priority_Move, Move(MoveActionType::Walk));
+    Queue(AvatarPrefetcher::Priority_Move, Move(MoveActionType::Jump));
+    Queue(AvatarPrefetcher::Priority_Move, Move(MoveActionType::Alert));
+    Queue(AvatarPrefetcher::Priority_Move, Move(MoveActionType::Prone));
+
+    // Remote attacks are too rare per avatar to pay for ahead of time
+    if (!bLocal)
+        return;
+
+    const auto nWeaponID = m_avatarLook.anHairEquip[11];
+    for (auto nAction : GetWeaponAttackActions(get_weapon_type(nWeaponID)))
+        Queue(AvatarPrefetcher::Priority_Attack, nAction);
+    Queue(AvatarPrefetcher::Priority_Attack, CharacterAction::Pronestab);
+}
+
+auto Avatar::IsNearView() -> bool
+{
+    if (!m_pOrigin)
+        return false;
+
+    auto& gr = WzGr2D::GetInstance();
+    const auto pt = gr.WorldToScreen({m_pOrigin->GetX(), m_pOrigin->GetY()});
+    const auto nWidth = static_cast<std::int32_t>(gr.GetWidth());
+    const auto nHeight = static_cast<std::int32_t>(gr.GetHeight());
+    return pt.x >= -PrefetchViewMargin && pt.x <= nWidth + PrefetchViewMargin
+        && pt.y >= -PrefetchViewMargin && pt.y <= nHeight + PrefetchViewMargin;
+}
+
 void Avatar::LoadCustomRidingSet(
     [[maybe_unused]] std::int32_t nRidingVehicleID,
     [[maybe_unused]] std::vector<std::int32_t>& aCustomRiding)
@@ -2432,7 +2587,7 @@ bool Avatar::CharacterFrameUpdate()
     ai->tCurFrameRemain += ai->aFrameDelay[ai->nCurFrameIndex];
 
     // Get action data (piece table)
-    const auto& ad = s_aCharacterActionData[nCharAction];
+    const auto& ad = *ActionMan::GetInstance().GetActionData(nCharAction);
 
     // Validate taming mob frame data exists
     auto itTM = tmAi->aaTamingMobAction.find(nTMAction);
@@ -2957,7 +3112,7 @@ void Avatar::UpdateBattlePvP(std::int32_t nAction)
     }
 
     auto* ai = GetActionInfo();
-    const auto& ad = s_aCharacterActionData[nAction];
+    const auto& ad = *ActionMan::GetInstance().GetActionData(nAction);
 
     if (is_battle_pvp_dead_action(nAction))
     {
@@ -3036,12 +3191,7 @@ void Avatar::UpdateFinalization(CharacterAction nAction, std::int32_t tCur)
 
     // --- Hide action check ---
     const auto nActionInt = static_cast<std::int32_t>(nAction);
-    ActionData* pActionData = nullptr;
-    if (nActionInt >= 0
-        && nActionInt < static_cast<std::int32_t>(ACTIONDATA_COUNT))
-    {
-        pActionData = &s_aCharacterActionData[nActionInt];
-    }
+    const auto* pActionData = ActionMan::GetInstance().GetActionData(nActionInt);
 
     const bool bHasOneTime = (GetOneTimeAction() > static_cast<CharacterAction>(-1));
     auto& activeAI = m_aiAction[bHasOneTime ? 1 : 0];
@@ -3440,8 +3590,8 @@ void Avatar::Update()
                     if (nOTA == CharacterAction::DarktornadoHitPre
                         || nOTA == CharacterAction::DarktornadoHit)
                     {
-                        auto& actionData = s_aCharacterActionData[
-                            static_cast<std::int32_t>(CharacterAction::DarktornadoHitAfter)];
+                        const auto& actionData = *ActionMan::GetInstance().GetActionData(
+                            static_cast<std::int32_t>(CharacterAction::DarktornadoHitAfter));
                         if (!actionData.m_aPieces.empty())
                         {
                             auto& piece = actionData.m_aPieces[0];
@@ -3474,12 +3624,7 @@ void Avatar::Update()
         }
 
         // --- Get action data for current action ---
-        ActionData* pActionData = nullptr;
-        if (nActionInt >= 0
-            && nActionInt < static_cast<std::int32_t>(ACTIONDATA_COUNT))
-        {
-            pActionData = &s_aCharacterActionData[nActionInt];
-        }
+        const auto* pActionData = ActionMan::GetInstance().GetActionData(nActionInt);
 
         // =================================================================
         // Sub-paths: compute body offset per rendering mode
@@ -120,7 +120,7 @@ public:
         std::int32_t nFaceColor{-1};
     };
 
-    virtual ~Avatar() = default;
+    virtual ~Avatar();
 
     // --- Virtual methods (from CAvatar_vtbl) ---
     [[nodiscard]] virtual auto CanUseBareHand() const -> bool { return false; }
@@ -167,6 +167,19 @@ public:
     /// Notify that avatar appearance has changed (triggers layer rebuild).
     void NotifyAvatarModified(bool bResetAction);
 
+    /**
+     * @brief Apply a look received from the server
+     *
+     * Compares against the current look and rebuilds only what the change
+     * touches: character action frames for body/equipment, taming mob frames
+     * for the taming mob slots, the face layer for face, face accessory and
+     * skin. Pet or unseen-equipment changes and repeats
+     * of the current look rebuild nothing.
+     *
+     * @return false if the visible avatar did not need a rebuild
+     */
+    auto SetAvatarLook(const AvatarLook& al) -> bool;
+
     // --- Non-virtual methods ---
 
     /// Convert raw move action (direction + action encoded) to CharacterAction.
@@ -318,11 +331,46 @@ public:
     void FixCharacterPosition();
     void SetMechanicHUE(std::int32_t nHUE, std::int32_t bForce);
     void LoadMechanicRocket();
-    void ApplyScaleAndOffset(
-        std::shared_ptr<WzGr2DLayer>& pDstLayer,
-        const std::shared_ptr<WzGr2DCanvas>& pSrcCanvas,
-        std::int32_t nFrameIndex);
     void GetModifiedAvatarHairEquip(std::int32_t (&aOut)[32]) const;
+
+    /// ActionMan::LoadCharacterAction arguments for one action, held by value
+    /// so the load can also run later from AvatarPrefetcher.
+    struct CharacterActionLoad
+    {
+        std::int32_t nAction{0};
+        std::int32_t nGender{0};
+        std::int32_t nSkin{0};
+        std::int32_t nJob{0};
+        std::int32_t aAvatarHairEquip[32]{};
+        std::int32_t nWeaponStickerID{0};
+        std::int32_t nVehicleID{0};
+        bool bTamingMobTired{false};
+        std::int32_t nGhostIndex{0};
+        std::int32_t nGatherToolID{0};
+        bool bDrawElfEar{false};
+        std::int32_t nChangeWeaponLook{0};
+        std::int32_t nLarknessState{0};
+        std::int32_t nPortableChair{0};
+        std::int32_t nMixedHairColor{0};
+        std::int32_t nMixPercent{0};
+        std::int32_t nBattlePvPAvatar{0};
+
+        void Load(std::vector<std::shared_ptr<CharacterActionFrameEntry>>& apFE) const;
+    };
+
+    /// Collect the load arguments PrepareActionLayer uses for nAction.
+    [[nodiscard]] auto MakeCharacterActionLoad(
+        std::int32_t nAction,
+        std::int32_t nGatherToolID,
+        bool bDrawElfEar) const -> CharacterActionLoad;
+
+    /// Queue the actions this look is likely to need next on AvatarPrefetcher.
+    /// Moves for the local user and avatars near the view, attacks for the
+    /// local user only.
+    void SchedulePrefetch();
+
+    /// Origin within PrefetchViewMargin of the screen
+    [[nodiscard]] auto IsNearView() -> bool;
     void LoadCustomRidingSet(
         std::int32_t nRidingVehicleID,
         std::vector<std::int32_t>& aCustomRiding);
@@ -349,6 +397,7 @@ public:
     // --- Appearance ---
     AvatarLook m_avatarLook;
     AvatarLook m_avatarLookLast;
+    std::uint64_t m_uAvatarLookHash{0};
     std::array<std::int32_t, 32> m_aAvatarHairEquipForced{};
     std::array<std::int32_t, 32> m_aOnlyAvatarHairEquipForced{};
     std::int32_t m_nAvatarFaceForced{0};
@@ -2,6 +2,8 @@
 
 #include "network/InPacket.h"
 
+#include <cstddef>
+
 namespace ms
 {
 
@@ -21,6 +23,7 @@ void AvatarLook::Initialize()
     nMixedHairColor = 0;
     nMixHairPercent = 0;
     anHairEquip.fill(0);
+    anUnseenEquip.fill(0);
     anPetID.fill(0);
 }
 
@@ -30,4 +33,75 @@ void AvatarLook::Decode([[maybe_unused]] InPacket& iPacket)
     // Original: AvatarLook::Decode(this, iPacket)
 }
 
+auto AvatarLook::GetHash() const noexcept -> std::uint64_t
+{
+    // FNV-1a over the field values (not the raw bytes, which include padding)
+    std::uint64_t h = 14695981039346656037ull;
+    auto mix = [&h](std::int32_t n)
+    {
+        auto u = static_cast<std::uint32_t>(n);
+        for (int i = 0; i < 4; ++i, u >>= 8)
+        {
+            h ^= u & 0xFF;
+            h *= 1099511628211ull;
+        }
+    };
+
+    mix(nGender);
+    mix(nSkin);
+    mix(nFace);
+    mix(nWeaponStickerID);
+    mix(nWeaponID);
+    mix(nSubWeaponID);
+    for (const auto n : anHairEquip)
+        mix(n);
+    for (const auto n : anUnseenEquip)
+        mix(n);
+    for (const auto n : anPetID)
+        mix(n);
+    mix(nJob);
+    mix(bDrawElfEar);
+    mix(nDemonSlayerDefFaceAcc);
+    mix(nXenonDefFaceAcc);
+    mix(bIsZeroBetaLook);
+    mix(nMixedHairColor);
+    mix(nMixHairPercent);
+    return h;
+}
+
+auto AvatarLook::Diff(const AvatarLook& other) const noexcept -> AvatarLookDiff
+{
+    static_assert(kMaxHairEquip <= 32, "uHairEquipSlot is a 32-bit mask");
+
+    AvatarLookDiff diff;
+    auto mark = [&diff](bool bChanged, std::uint32_t uField)
+    {
+        if (bChanged)
+            diff.uField |= uField;
+    };
+
+    for (std::size_t i = 0; i < anHairEquip.size(); ++i)
+    {
+        if (anHairEquip[i] != other.anHairEquip[i])
+            diff.uHairEquipSlot |= 1u << i;
+    }
+
+    mark(nGender != other.nGender, AvatarLookDiff::Gender);
+    mark(nSkin != other.nSkin, AvatarLookDiff::Skin);
+    mark(nFace != other.nFace, AvatarLookDiff::Face);
+    mark(nWeaponStickerID != other.nWeaponStickerID, AvatarLookDiff::WeaponSticker);
+    mark(nWeaponID != other.nWeaponID || nSubWeaponID != other.nSubWeaponID, AvatarLookDiff::Weapon);
+    mark(diff.uHairEquipSlot != 0, AvatarLookDiff::HairEquip);
+    mark(anUnseenEquip != other.anUnseenEquip, AvatarLookDiff::UnseenEquip);
+    mark(anPetID != other.anPetID, AvatarLookDiff::Pet);
+    mark(nJob != other.nJob, AvatarLookDiff::Job);
+    mark(bDrawElfEar != other.bDrawElfEar, AvatarLookDiff::ElfEar);
+    mark(nDemonSlayerDefFaceAcc != other.nDemonSlayerDefFaceAcc
+         || nXenonDefFaceAcc != other.nXenonDefFaceAcc, AvatarLookDiff::DefFaceAcc);
+    mark(nMixedHairColor != other.nMixedHairColor
+         || nMixHairPercent != other.nMixHairPercent, AvatarLookDiff::HairMix);
+    mark(bIsZeroBetaLook != other.bIsZeroBetaLook, AvatarLookDiff::ZeroBeta);
+    return diff;
+}
+
 } // namespace ms
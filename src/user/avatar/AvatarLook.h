@@ -8,6 +8,71 @@ namespace ms
 
 class InPacket;
 
+/**
+ * @brief What differs between two looks (see AvatarLook::Diff)
+ *
+ * Fields are grouped by what a change forces the avatar to rebuild:
+ * anything LoadCharacterAction reads invalidates the action frames, the
+ * taming mob slots invalidate only the taming mob frames, the face, face
+ * accessory and skin invalidate the face layer, and pets or unseen
+ * equipment need no avatar rebuild at all.
+ */
+struct AvatarLookDiff
+{
+    enum : std::uint32_t
+    {
+        Gender        = 1u << 0,
+        Skin          = 1u << 1,
+        Face          = 1u << 2,
+        WeaponSticker = 1u << 3,
+        Weapon        = 1u << 4,  ///< nWeaponID / nSubWeaponID
+        HairEquip     = 1u << 5,  ///< See uHairEquipSlot
+        UnseenEquip   = 1u << 6,
+        Pet           = 1u << 7,
+        Job           = 1u << 8,
+        ElfEar        = 1u << 9,
+        DefFaceAcc    = 1u << 10, ///< Demon Slayer / Xenon default face accessory
+        HairMix       = 1u << 11,
+        ZeroBeta      = 1u << 12,
+    };
+
+    /// anHairEquip slots LoadCharacterAction clears before drawing
+    /// (face accessory, pet wear, rings 1-4)
+    static constexpr std::uint32_t kActionIgnoredSlot =
+        (1u << 2) | (1u << 12) | (1u << 13) | (1u << 14) | (1u << 15) | (1u << 16);
+    static constexpr std::uint32_t kFaceAccSlot = 1u << 2;
+    /// anHairEquip slots that only feed the taming mob frames
+    /// (taming mob, saddle, mob equipment)
+    static constexpr std::uint32_t kTamingMobSlot = (1u << 18) | (1u << 19) | (1u << 20);
+
+    std::uint32_t uField{0};
+    std::uint32_t uHairEquipSlot{0}; ///< Bit i: anHairEquip[i] differs
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return uField == 0; }
+
+    /// The body/equipment action frames must be reloaded
+    [[nodiscard]] auto AffectsAction() const noexcept -> bool
+    {
+        constexpr std::uint32_t uAction = Gender | Skin | WeaponSticker | Weapon | Job
+            | ElfEar | HairMix | ZeroBeta;
+        return (uField & uAction) != 0
+            || (uHairEquipSlot & ~(kActionIgnoredSlot | kTamingMobSlot)) != 0;
+    }
+
+    /// The taming mob action frames must be reloaded
+    [[nodiscard]] auto AffectsTamingMob() const noexcept -> bool
+    {
+        return (uHairEquipSlot & kTamingMobSlot) != 0;
+    }
+
+    /// The face layer must be reloaded
+    [[nodiscard]] auto AffectsFace() const noexcept -> bool
+    {
+        constexpr std::uint32_t uFace = Gender | Skin | Face | Job | DefFaceAcc | ZeroBeta;
+        return (uField & uFace) != 0 || (uHairEquipSlot & kFaceAccSlot) != 0;
+    }
+};
+
 /**
  * @brief Character appearance data
  *
@@ -30,6 +95,14 @@ public:
 
     void Decode(InPacket& iPacket);
 
+    /// 64-bit digest of every field; equal looks hash equal
+    [[nodiscard]] auto GetHash() const noexcept -> std::uint64_t;
+
+    /// Fields and equipment slots where other differs from this look
+    [[nodiscard]] auto Diff(const AvatarLook& other) const noexcept -> AvatarLookDiff;
+
+    auto operator==(const AvatarLook&) const -> bool = default;
+
     // --- Fields ---
     std::uint8_t nGender{};
     std::int32_t nSkin{};
@@ -0,0 +1,49 @@
+#include "AvatarPrefetcher.h"
+
+#include "app/UpdateManager.h"
+
+#include <utility>
+
+namespace ms
+{
+
+namespace
+{
+// Trivially destructible, so it can still be read during static destruction
+constinit bool g_bPrefetcherAlive = false;
+} // namespace
+
+AvatarPrefetcher::AvatarPrefetcher()
+{
+    UpdateManager::s_Attach(static_cast<IPostUpdatable*>(this));
+    g_bPrefetcherAlive = true;
+}
+
+AvatarPrefetcher::~AvatarPrefetcher()
+{
+    g_bPrefetcherAlive = false;
+    UpdateManager::s_Detach(static_cast<IPostUpdatable*>(this));
+}
+
+auto AvatarPrefetcher::IsAlive() noexcept -> bool
+{
+    return g_bPrefetcherAlive;
+}
+
+void AvatarPrefetcher::PostUpdate()
+{
+    if (!m_queue.IsEmpty())
+        m_queue.RunFor(FrameBudget);
+}
+
+void AvatarPrefetcher::Schedule(std::int32_t nPriority, const void* pOwner, PriorityJobQueue::Job job)
+{
+    m_queue.Push(nPriority, pOwner, std::move(job));
+}
+
+void AvatarPrefetcher::Cancel(const void* pOwner)
+{
+    m_queue.Cancel(pOwner);
+}
+
+} // namespace ms
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "app/IUpdatable.h"
+#include "util/PriorityJobQueue.h"
+#include "util/Singleton.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms
+{
+
+/**
+ * @brief Loads likely avatar actions ahead of time, a few per frame
+ *
+ * Avatar::NotifyAvatarModified queues the actions a look is about to need:
+ * stand, walk, jump, alert and prone for the local user and avatars near
+ * the view, plus the weapon's basic attacks for the local user. PostUpdate
+ * works through them in priority order within a small per-frame budget,
+ * and the composited frames land in ActionMan's CharacterFrameCache, so
+ * when PrepareActionLayer later switches to one of them the load is a
+ * cache hit instead of a WZ walk.
+ *
+ * Loading runs on the update thread: the WZ tree and ActionMan's image
+ * caches are not synchronised, so jobs cannot move to workers yet.
+ *
+ * Attaches itself to UpdateManager's post-update list on construction.
+ */
+class AvatarPrefetcher final : public IPostUpdatable, public Singleton<AvatarPrefetcher>
+{
+    friend class Singleton<AvatarPrefetcher>;
+
+public:
+    /// Priorities, highest first
+    enum Priority : std::int32_t
+    {
+        Priority_Attack = 10,
+        Priority_Move = 20,
+        Priority_Stand = 30,
+    };
+
+    /// Time spent on prefetching per frame
+    static constexpr std::chrono::microseconds FrameBudget{2000};
+
+    ~AvatarPrefetcher() override;
+
+    // IPostUpdatable
+    void PostUpdate() override;
+
+    void Schedule(std::int32_t nPriority, const void* pOwner, PriorityJobQueue::Job job);
+
+    /// Drop everything queued for pOwner (e.g. its look changed)
+    void Cancel(const void* pOwner);
+
+    /// Constructed and not yet destroyed; GetInstance() is safe to call
+    [[nodiscard]] static auto IsAlive() noexcept -> bool;
+
+    [[nodiscard]] auto GetPendingCount() const noexcept -> std::size_t { return m_queue.GetSize(); }
+
+private:
+    AvatarPrefetcher();
+
+    PriorityJobQueue m_queue;
+};
+
+} // namespace ms
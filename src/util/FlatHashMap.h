@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ms
+{
+
+/**
+ * @brief Open-addressing hash map for integer keys
+ *
+ * Replacement for std::map<int, ...> registries that are only ever looked up
+ * by key. Keys live in one contiguous slot array probed linearly, values in a
+ * parallel array, so a lookup touches one or two cache lines instead of
+ * chasing tree nodes. Composite keys are packed into a 64-bit integer by the
+ * owner (see FaceLookCodes::Pack).
+ *
+ * Erase uses backward-shift deletion, so there are no tombstones and probe
+ * sequences stay short after sweeps. Pointers returned by Find stay valid
+ * until the next insert or erase.
+ *
+ * @tparam KeyT   Integral key type
+ * @tparam ValueT Default-constructible value type
+ */
+template <std::integral KeyT, typename ValueT>
+class TFlatHashMap
+{
+public:
+    [[nodiscard]] auto Find(KeyT key) noexcept -> ValueT*
+    {
+        const auto nSlot = FindSlot(key);
+        return nSlot == npos ? nullptr : &m_aValue[nSlot];
+    }
+
+    [[nodiscard]] auto Find(KeyT key) const noexcept -> const ValueT*
+    {
+        const auto nSlot = FindSlot(key);
+        return nSlot == npos ? nullptr : &m_aValue[nSlot];
+    }
+
+    [[nodiscard]] auto Contains(KeyT key) const noexcept -> bool { return FindSlot(key) != npos; }
+
+    /// Value for key, default-constructed on first access
+    auto operator[](KeyT key) -> ValueT&
+    {
+        if (const auto nSlot = FindSlot(key); nSlot != npos)
+            return m_aValue[nSlot];
+
+        if ((m_nSize + 1) * 4 > m_aSlot.size() * 3)
+            Rehash(m_aSlot.empty() ? MinCapacity : m_aSlot.size() * 2);
+
+        auto nSlot = Home(key);
+        while (m_aSlot[nSlot].bUsed)
+            nSlot = (nSlot + 1) & m_uMask;
+
+        m_aSlot[nSlot] = Slot{key, true};
+        ++m_nSize;
+        return m_aValue[nSlot];
+    }
+
+    /// @return true when key was present
+    auto Erase(KeyT key) -> bool
+    {
+        auto nHole = FindSlot(key);
+        if (nHole == npos)
+            return false;
+
+        // Pull later members of the probe run back over the hole
+        for (auto nNext = (nHole + 1) & m_uMask; m_aSlot[nNext].bUsed; nNext = (nNext + 1) & m_uMask)
+        {
+            const auto nHome = Home(m_aSlot[nNext].key);
+            const auto bStays = nHole <= nNext
+                ? (nHole < nHome && nHome <= nNext)
+                : (nHole < nHome || nHome <= nNext);
+            if (bStays)
+                continue;
+
+            m_aSlot[nHole] = m_aSlot[nNext];
+            m_aValue[nHole] = std::move(m_aValue[nNext]);
+            nHole = nNext;
+        }
+
+        m_aSlot[nHole] = Slot{};
+        m_aValue[nHole] = ValueT{};
+        --m_nSize;
+        return true;
+    }
+
+    void Clear()
+    {
+        m_aSlot.clear();
+        m_aValue.clear();
+        m_nSize = 0;
+        m_uMask = 0;
+        m_nShift = 0;
+    }
+
+    /// Make room for n entries without rehashing
+    void Reserve(std::size_t n)
+    {
+        const auto nCapacity = std::bit_ceil(std::max<std::size_t>(MinCapacity, (n * 4 + 2) / 3));
+        if (nCapacity > m_aSlot.size())
+            Rehash(nCapacity);
+    }
+
+    /// Calls visit(key, value) for every entry, in no particular order
+    template <typename Visitor>
+    void ForEach(Visitor&& visit)
+    {
+        for (std::size_t i = 0; i < m_aSlot.size(); ++i)
+        {
+            if (m_aSlot[i].bUsed)
+                visit(m_aSlot[i].key, m_aValue[i]);
+        }
+    }
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_nSize; }
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_nSize == 0; }
+
+private:
+    struct Slot
+    {
+        KeyT key{};
+        bool bUsed{false};
+    };
+
+    static constexpr std::size_t MinCapacity = 16;
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// Fibonacci hashing: the high bits of key * 2^64/phi
+    [[nodiscard]] auto Home(KeyT key) const noexcept -> std::size_t
+    {
+        const auto uKey = static_cast<std::uint64_t>(key);
+        return static_cast<std::size_t>((uKey * 0x9E3779B97F4A7C15ull) >> m_nShift);
+    }
+
+    [[nodiscard]] auto FindSlot(KeyT key) const noexcept -> std::size_t
+    {
+        if (m_nSize == 0)
+            return npos;
+
+        for (auto nSlot = Home(key);; nSlot = (nSlot + 1) & m_uMask)
+        {
+            const auto& slot = m_aSlot[nSlot];
+            if (!slot.bUsed)
+                return npos;
+            if (slot.key == key)
+                return nSlot;
+        }
+    }
+
+    void Rehash(std::size_t nCapacity)
+    {
+        auto aOldSlot = std::exchange(m_aSlot, std::vector<Slot>(nCapacity));
+        auto aOldValue = std::exchange(m_aValue, std::vector<ValueT>(nCapacity));
+        m_uMask = nCapacity - 1;
+        m_nShift = 64 - std::countr_zero(nCapacity);
+
+        for (std::size_t i = 0; i < aOldSlot.size(); ++i)
+        {
+            if (!aOldSlot[i].bUsed)
+                continue;
+
+            auto nSlot = Home(aOldSlot[i].key);
+            while (m_aSlot[nSlot].bUsed)
+                nSlot = (nSlot + 1) & m_uMask;
+            m_aSlot[nSlot] = aOldSlot[i];
+            m_aValue[nSlot] = std::move(aOldValue[i]);
+        }
+    }
+
+    std::vector<Slot> m_aSlot;
+    std::vector<ValueT> m_aValue;
+    std::size_t m_nSize{0};
+    std::size_t m_uMask{0};
+    int m_nShift{0};
+};
+
+} // namespace ms
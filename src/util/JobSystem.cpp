@@ -0,0 +1,161 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+namespace ms
+{
+
+namespace
+{
+// Frame work is short; beyond this many threads, waking them costs more than it saves
+constexpr std::size_t MaxWorkers = 7;
+} // namespace
+
+JobSystem::JobSystem()
+{
+    const auto nHardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    const auto nWorker = std::min(nHardware > 1 ? nHardware - 1 : 0, MaxWorkers);
+
+    for (std::size_t i = 0; i <= nWorker; ++i)
+    {
+        m_aQueue.push_back(std::make_unique<Queue>());
+    }
+
+    m_aWorker.reserve(nWorker);
+    for (std::size_t i = 0; i < nWorker; ++i)
+    {
+        m_aWorker.emplace_back(&JobSystem::WorkerMain, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock(m_mtxWake);
+        m_bStop = true;
+    }
+    m_cvWake.notify_all();
+
+    for (auto& worker : m_aWorker)
+    {
+        worker.join();
+    }
+}
+
+void JobSystem::ParallelFor(std::size_t count, std::size_t grain, const RangeFn& fn)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    grain = std::max<std::size_t>(grain, 1);
+    if (m_aWorker.empty() || count <= grain)
+    {
+        for (std::size_t begin = 0; begin < count; begin += grain)
+        {
+            fn(begin, std::min(count, begin + grain));
+        }
+        return;
+    }
+
+    const auto nChunk = (count + grain - 1) / grain;
+    Batch batch;
+    batch.fn = &fn;
+    batch.nRemaining.store(nChunk, std::memory_order_relaxed);
+
+    // Deal the chunks out round-robin so every queue starts with work
+    for (std::size_t i = 0; i < nChunk; ++i)
+    {
+        auto& queue = *m_aQueue[i % m_aQueue.size()];
+        std::lock_guard lock(queue.mtx);
+        queue.jobs.push_back({&batch, i * grain, std::min(count, (i + 1) * grain)});
+    }
+
+    {
+        std::lock_guard lock(m_mtxWake);
+        m_nQueued.fetch_add(nChunk, std::memory_order_relaxed);
+    }
+    m_cvWake.notify_all();
+
+    // Help out until the last chunk (possibly on a worker) has finished
+    const auto self = m_aQueue.size() - 1;
+    Job job;
+    while (batch.nRemaining.load(std::memory_order_acquire) > 0)
+    {
+        if (PopOrSteal(self, job))
+        {
+            Run(job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::WorkerMain(std::size_t index)
+{
+    Job job;
+    for (;;)
+    {
+        if (PopOrSteal(index, job))
+        {
+            Run(job);
+            continue;
+        }
+
+        std::unique_lock lock(m_mtxWake);
+        m_cvWake.wait(lock, [this]
+        {
+            return m_bStop || m_nQueued.load(std::memory_order_relaxed) > 0;
+        });
+
+        if (m_bStop)
+        {
+            return;
+        }
+    }
+}
+
+auto JobSystem::PopOrSteal(std::size_t index, Job& job) -> bool
+{
+    // Own queue first (newest job, still warm in cache)...
+    {
+        auto& own = *m_aQueue[index];
+        std::lock_guard lock(own.mtx);
+        if (!own.jobs.empty())
+        {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            m_nQueued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // ...then the oldest job of whichever queue still has one
+    for (std::size_t i = 1; i < m_aQueue.size(); ++i)
+    {
+        auto& victim = *m_aQueue[(index + i) % m_aQueue.size()];
+        std::lock_guard lock(victim.mtx);
+        if (!victim.jobs.empty())
+        {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            m_nQueued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::Run(const Job& job)
+{
+    (*job.pBatch->fn)(job.begin, job.end);
+
+    // Last access to the batch: the caller may return as soon as this hits 0
+    job.pBatch->nRemaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace ms
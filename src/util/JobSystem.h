@@ -0,0 +1,83 @@
+#pragma once
+
+#include "util/Singleton.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ms
+{
+
+/**
+ * @brief Small work-stealing worker pool for data-parallel frame work
+ *
+ * Each worker owns a job queue; it pops from the back of its own queue and,
+ * when that runs dry, steals from the front of the others. ParallelFor()
+ * spreads chunks of an index range over all queues and the calling thread
+ * works through them too, so a call returns only once every chunk has run.
+ *
+ * Jobs must not throw and must not call SDL; the caller stays responsible
+ * for anything that has to happen on the render thread.
+ */
+class JobSystem final : public Singleton<JobSystem>
+{
+    friend class Singleton<JobSystem>;
+
+public:
+    using RangeFn = std::function<void(std::size_t begin, std::size_t end)>;
+
+    /**
+     * @brief Run fn over [0, count) in chunks of at most grain indices
+     *
+     * Runs the chunks inline when there are no workers or there is only one.
+     */
+    void ParallelFor(std::size_t count, std::size_t grain, const RangeFn& fn);
+
+    /// Number of worker threads (the calling thread is not counted)
+    [[nodiscard]] auto GetWorkerCount() const noexcept -> std::size_t { return m_aWorker.size(); }
+
+private:
+    struct Batch
+    {
+        const RangeFn* fn = nullptr;
+        std::atomic<std::size_t> nRemaining{0};
+    };
+
+    struct Job
+    {
+        Batch* pBatch = nullptr;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    struct Queue
+    {
+        std::mutex mtx;
+        std::deque<Job> jobs;
+    };
+
+    JobSystem();
+    ~JobSystem() override;
+
+    void WorkerMain(std::size_t index);
+    auto PopOrSteal(std::size_t index, Job& job) -> bool;
+    static void Run(const Job& job);
+
+    // One queue per worker, plus the last one for the calling thread
+    std::vector<std::unique_ptr<Queue>> m_aQueue;
+    std::vector<std::thread> m_aWorker;
+
+    std::mutex m_mtxWake;
+    std::condition_variable m_cvWake;
+    std::atomic<std::size_t> m_nQueued{0};
+    bool m_bStop{false};
+};
+
+} // namespace ms
@@ -0,0 +1,60 @@
+#include "PriorityJobQueue.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace ms
+{
+
+auto PriorityJobQueue::Before(const Entry& a, const Entry& b) noexcept -> bool
+{
+    // std heap keeps the "largest" on top: that must be the job to run next
+    if (a.nPriority != b.nPriority)
+        return a.nPriority < b.nPriority;
+    return a.uSeq > b.uSeq;
+}
+
+void PriorityJobQueue::Push(std::int32_t nPriority, const void* pOwner, Job job)
+{
+    m_aHeap.push_back(Entry{nPriority, m_uSeq++, pOwner, std::move(job)});
+    std::push_heap(m_aHeap.begin(), m_aHeap.end(), &Before);
+}
+
+auto PriorityJobQueue::Cancel(const void* pOwner) -> std::size_t
+{
+    const auto nDropped = std::erase_if(m_aHeap, [pOwner](const Entry& e) { return e.pOwner == pOwner; });
+    if (nDropped != 0)
+        std::make_heap(m_aHeap.begin(), m_aHeap.end(), &Before);
+    return nDropped;
+}
+
+auto PriorityJobQueue::RunOne() -> bool
+{
+    if (m_aHeap.empty())
+        return false;
+
+    // Detach before running: the job may push or cancel
+    std::pop_heap(m_aHeap.begin(), m_aHeap.end(), &Before);
+    auto job = std::move(m_aHeap.back().job);
+    m_aHeap.pop_back();
+
+    if (job)
+        job();
+    return true;
+}
+
+auto PriorityJobQueue::RunFor(std::chrono::microseconds budget) -> std::size_t
+{
+    const auto tEnd = std::chrono::steady_clock::now() + budget;
+    std::size_t nRun = 0;
+    while (std::chrono::steady_clock::now() < tEnd && RunOne())
+        ++nRun;
+    return nRun;
+}
+
+void PriorityJobQueue::Clear()
+{
+    m_aHeap.clear();
+}
+
+} // namespace ms
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ms
+{
+
+/**
+ * @brief Deferred jobs run in priority order within a time budget
+ *
+ * Jobs with a higher priority run first; equal priorities run in push
+ * order. Each job carries an opaque owner tag so everything queued on
+ * behalf of one object can be dropped at once when it goes stale.
+ *
+ * Not thread-safe: pushing and running happen on the thread that owns
+ * the data the jobs touch.
+ */
+class PriorityJobQueue
+{
+public:
+    using Job = std::function<void()>;
+
+    void Push(std::int32_t nPriority, const void* pOwner, Job job);
+
+    /// Drop every queued job of pOwner; returns how many were dropped
+    auto Cancel(const void* pOwner) -> std::size_t;
+
+    /// Run the highest-priority job; false when the queue is empty
+    auto RunOne() -> bool;
+
+    /**
+     * @brief Run jobs until the queue is empty or the budget is used up
+     *
+     * The budget is checked before each job, so a zero budget runs
+     * nothing; only the last job started may overrun it.
+     * @return Number of jobs run
+     */
+    auto RunFor(std::chrono::microseconds budget) -> std::size_t;
+
+    void Clear();
+
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_aHeap.size(); }
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_aHeap.empty(); }
+
+private:
+    struct Entry
+    {
+        std::int32_t nPriority{0};
+        std::uint64_t uSeq{0};
+        const void* pOwner{nullptr};
+        Job job;
+    };
+
+    /// Heap order: lower priority, then later push, sinks
+    static auto Before(const Entry& a, const Entry& b) noexcept -> bool;
+
+    std::vector<Entry> m_aHeap;
+    std::uint64_t m_uSeq{0};
+};
+
+} // namespace ms
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ms
+{
+
+/**
+ * @brief Fixed-capacity single-producer/single-consumer ring
+ *
+ * Lock-free and allocation-free: slots are stored inline and exchanged
+ * through two monotonically increasing indices. The producer only writes
+ * the tail and the consumer only writes the head. Each side keeps a cached
+ * copy of the other side's index, so an uncontended push or pop touches no
+ * shared cache line beyond its own index.
+ *
+ * Exactly one thread may push and exactly one (possibly different) thread
+ * may pop at any time. Values are moved into and out of the slots; a
+ * popped slot keeps its moved-from value until it is overwritten.
+ *
+ * @tparam T        Value type (default-constructible, nothrow-movable)
+ * @tparam Capacity Number of slots, a power of two
+ */
+template <typename T, std::size_t Capacity>
+class TSpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+    static_assert(std::is_default_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
+
+public:
+    /// Producer: append value; false (value untouched) when the ring is full
+    auto TryPush(T&& value) noexcept -> bool
+    {
+        const auto nTail = m_nTail.load(std::memory_order_relaxed);
+        if (nTail - m_nHeadCache == Capacity)
+        {
+            m_nHeadCache = m_nHead.load(std::memory_order_acquire);
+            if (nTail - m_nHeadCache == Capacity)
+            {
+                return false;
+            }
+        }
+
+        m_aSlot[nTail & Mask] = std::move(value);
+        m_nTail.store(nTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto TryPush(const T& value) -> bool
+    {
+        T copy(value);
+        return TryPush(std::move(copy));
+    }
+
+    /// Consumer: move the oldest value into out; false when the ring is empty
+    auto TryPop(T& out) noexcept -> bool
+    {
+        const auto nHead = m_nHead.load(std::memory_order_relaxed);
+        if (nHead == m_nTailCache)
+        {
+            m_nTailCache = m_nTail.load(std::memory_order_acquire);
+            if (nHead == m_nTailCache)
+            {
+                return false;
+            }
+        }
+
+        out = std::move(m_aSlot[nHead & Mask]);
+        m_nHead.store(nHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer: drop everything pushed so far
+    void Clear() noexcept
+    {
+        m_nTailCache = m_nTail.load(std::memory_order_acquire);
+        m_nHead.store(m_nTailCache, std::memory_order_release);
+    }
+
+    /// Number of queued values; exact only when called from one of the two sides while the other is idle
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t
+    {
+        return m_nTail.load(std::memory_order_acquire) - m_nHead.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return GetSize() == 0; }
+
+    [[nodiscard]] static constexpr auto GetCapacity() noexcept -> std::size_t { return Capacity; }
+
+private:
+    static constexpr std::size_t Mask = Capacity - 1;
+    static constexpr std::size_t CacheLine = 64;
+
+    // Consumer side
+    alignas(CacheLine) std::atomic<std::size_t> m_nHead{0};
+    std::size_t m_nTailCache{0};
+
+    // Producer side
+    alignas(CacheLine) std::atomic<std::size_t> m_nTail{0};
+    std::size_t m_nHeadCache{0};
+
+    alignas(CacheLine) std::array<T, Capacity> m_aSlot{};
+};
+
+} // namespace ms
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace ms
+{
+
+/**
+ * @brief Perfect hash over a fixed set of strings, built at compile time
+ *
+ * Hash-and-displace: every key falls into a bucket by one hash, and each
+ * bucket stores the seed of a second hash that sends its keys to distinct
+ * free slots. Buckets are placed largest first while the table is still
+ * empty. Both hashes derive from one pass over the string, so a lookup is
+ * one string hash, a remix, one slot read and one string compare to reject
+ * names outside the set.
+ *
+ * When a key occurs more than once the lowest index wins.
+ *
+ * Meant to be used as a constexpr object so the seed search runs in the
+ * compiler; a set that cannot be placed fails to compile.
+ *
+ * @tparam N Number of keys
+ */
+template <std::size_t N>
+class TStaticPerfectHash
+{
+    static_assert(N > 0 && N < 0x8000, "key index must fit in int16");
+
+public:
+    /// Load factor between 1/3 and 2/3
+    static constexpr std::size_t SlotCount = std::bit_ceil(N + N / 2 + 1);
+    /// About 2.5 keys per bucket
+    static constexpr std::size_t BucketCount = SlotCount / 4 < 1 ? 1 : SlotCount / 4;
+
+    constexpr explicit TStaticPerfectHash(const std::array<std::string_view, N>& asKey)
+        : m_asKey(asKey)
+    {
+        m_anSlot.fill(-1);
+
+        // Group key indices by bucket
+        std::array<std::size_t, BucketCount + 1> anStart{};
+        std::array<std::uint64_t, N> auHash{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            auHash[i] = Hash(m_asKey[i]);
+            ++anStart[Bucket(auHash[i]) + 1];
+        }
+        std::size_t nLargest = 0;
+        for (std::size_t b = 0; b < BucketCount; ++b)
+        {
+            nLargest = nLargest < anStart[b + 1] ? anStart[b + 1] : nLargest;
+            anStart[b + 1] += anStart[b];
+        }
+
+        std::array<std::size_t, N> anByBucket{};
+        auto anFill = anStart;
+        for (std::size_t i = 0; i < N; ++i)
+            anByBucket[anFill[Bucket(auHash[i])]++] = i;
+
+        std::array<bool, SlotCount> abTaken{};
+        std::array<std::size_t, N> anUnique{};
+        std::array<std::size_t, N> anTry{};
+        for (auto nCount = nLargest; nCount > 0; --nCount)
+        {
+            for (std::size_t b = 0; b < BucketCount; ++b)
+            {
+                if (anStart[b + 1] - anStart[b] != nCount)
+                    continue;
+
+                // Duplicates share a bucket; keep the first
+                std::size_t nUnique = 0;
+                for (auto k = anStart[b]; k < anStart[b + 1]; ++k)
+                {
+                    bool bSeen = false;
+                    for (std::size_t u = 0; u < nUnique; ++u)
+                        bSeen = bSeen || m_asKey[anUnique[u]] == m_asKey[anByBucket[k]];
+                    if (!bSeen)
+                        anUnique[nUnique++] = anByBucket[k];
+                }
+
+                for (std::uint32_t uSeed = 1;; ++uSeed)
+                {
+                    if (uSeed > 0xFFFF)
+                        throw std::logic_error("TStaticPerfectHash: no seed places this bucket");
+
+                    bool bFits = true;
+                    for (std::size_t u = 0; u < nUnique && bFits; ++u)
+                    {
+                        anTry[u] = Slot(auHash[anUnique[u]], uSeed);
+                        bFits = !abTaken[anTry[u]];
+                        for (std::size_t v = 0; v < u && bFits; ++v)
+                            bFits = anTry[v] != anTry[u];
+                    }
+                    if (!bFits)
+                        continue;
+
+                    for (std::size_t u = 0; u < nUnique; ++u)
+                    {
+                        abTaken[anTry[u]] = true;
+                        m_anSlot[anTry[u]] = static_cast<std::int16_t>(anUnique[u]);
+                    }
+                    m_auSeed[b] = static_cast<std::uint16_t>(uSeed);
+                    break;
+                }
+            }
+        }
+    }
+
+    /// Index of sKey in the key array, or -1
+    [[nodiscard]] constexpr auto Find(std::string_view sKey) const noexcept -> std::int32_t
+    {
+        const auto uHash = Hash(sKey);
+        const auto uSeed = m_auSeed[Bucket(uHash)];
+        if (uSeed == 0)
+            return -1;
+        const auto nIndex = m_anSlot[Slot(uHash, uSeed)];
+        if (nIndex < 0 || m_asKey[static_cast<std::size_t>(nIndex)] != sKey)
+            return -1;
+        return nIndex;
+    }
+
+    [[nodiscard]] constexpr auto GetKey(std::size_t nIndex) const noexcept -> std::string_view { return m_asKey[nIndex]; }
+
+    /// 64-bit FNV-1a
+    static constexpr auto Hash(std::string_view s) noexcept -> std::uint64_t
+    {
+        std::uint64_t h = 14695981039346656037ull;
+        for (const char c : s)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+private:
+    static constexpr auto Bucket(std::uint64_t uHash) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(uHash >> 32) & (BucketCount - 1);
+    }
+
+    /// Seeded murmur finaliser over the string hash
+    static constexpr auto Slot(std::uint64_t uHash, std::uint32_t uSeed) noexcept -> std::size_t
+    {
+        auto h = uHash ^ (static_cast<std::uint64_t>(uSeed) * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h) & (SlotCount - 1);
+    }
+
+    std::array<std::string_view, N> m_asKey{};
+    std::array<std::uint16_t, BucketCount> m_auSeed{};
+    std::array<std::int16_t, SlotCount> m_anSlot{};
+};
+
+} // namespace ms
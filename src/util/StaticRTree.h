@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ms
+{
+
+/**
+ * @brief Read-only 2D R-tree, bulk-loaded once (Sort-Tile-Recursive)
+ *
+ * For data that never changes after loading, e.g. footholds. Unlike TRSTree
+ * there is no incremental insert: Build() packs every item at once, which
+ * gives full, barely overlapping nodes. Nodes live in one flat array and
+ * refer to each other by index; leaves store a 32-bit payload index that the
+ * owner maps back to its own objects.
+ *
+ * Nodes are appended level by level, so children always come before their
+ * parent and the root is the last node.
+ *
+ * @tparam KeyT   Coordinate type (e.g. int32_t)
+ * @tparam Fanout Maximum entries per node (default 16)
+ */
+template <typename KeyT, std::size_t Fanout = 16>
+class TStaticRTree
+{
+    static_assert(Fanout >= 2, "Fanout must be >= 2");
+
+public:
+    // ========== Bounding Box ==========
+
+    struct Bounds
+    {
+        KeyT xMin{};
+        KeyT yMin{};
+        KeyT xMax{};
+        KeyT yMax{};
+
+        [[nodiscard]] auto Intersects(const Bounds& o) const noexcept -> bool
+        {
+            return !(xMax < o.xMin || xMin > o.xMax || yMax < o.yMin || yMin > o.yMax);
+        }
+
+        void Extend(const Bounds& o) noexcept
+        {
+            xMin = std::min(xMin, o.xMin);
+            yMin = std::min(yMin, o.yMin);
+            xMax = std::max(xMax, o.xMax);
+            yMax = std::max(yMax, o.yMax);
+        }
+    };
+
+    static auto MakeBounds2D(KeyT x1, KeyT y1, KeyT x2, KeyT y2) -> Bounds
+    {
+        return {std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2)};
+    }
+
+    struct Item
+    {
+        Bounds bbox{};
+        std::uint32_t nIndex{};
+    };
+
+    // ========== Operations ==========
+
+    /// Replace the tree with one packed from items
+    void Build(std::vector<Item> aItem)
+    {
+        m_aNode.clear();
+        m_nSize = aItem.size();
+        if (aItem.empty())
+            return;
+
+        m_aNode.reserve(CountNodes(aItem.size()));
+
+        // Pack the items into leaves, then each level's nodes into parents
+        auto aLevel = std::move(aItem);
+        bool bLeaf = true;
+        for (;;)
+        {
+            aLevel = PackLevel(aLevel, bLeaf);
+            bLeaf = false;
+            if (aLevel.size() == 1)
+                break;
+        }
+    }
+
+    /// Search: append the payload index of every item whose bbox intersects query
+    template <typename Container>
+        requires requires(Container& c, std::uint32_t n) { c.push_back(n); }
+    void Search(const Bounds& query, Container& results) const
+    {
+        Search(query, [&results](std::uint32_t nIndex) { results.push_back(nIndex); });
+    }
+
+    /// Search: call visit(payload index) for every item whose bbox intersects query
+    template <typename Visitor>
+        requires std::invocable<Visitor&, std::uint32_t>
+    void Search(const Bounds& query, Visitor&& visit) const
+    {
+        if (m_aNode.empty())
+            return;
+
+        // Depth is at most log_Fanout(2^32), so the stack never overflows
+        std::array<std::uint32_t, MaxStack> aStack;
+        std::size_t nStack = 0;
+        aStack[nStack++] = static_cast<std::uint32_t>(m_aNode.size() - 1);
+
+        while (nStack > 0)
+        {
+            const auto& node = m_aNode[aStack[--nStack]];
+            for (std::size_t i = 0; i < node.nCount; ++i)
+            {
+                if (!node.aBounds[i].Intersects(query))
+                    continue;
+
+                if (node.bLeaf)
+                    visit(node.aChild[i]);
+                else
+                    aStack[nStack++] = node.aChild[i];
+            }
+        }
+    }
+
+    void Clear()
+    {
+        m_aNode.clear();
+        m_nSize = 0;
+    }
+
+    [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_aNode.empty(); }
+    [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_nSize; }
+    [[nodiscard]] auto GetNodeCount() const noexcept -> std::size_t { return m_aNode.size(); }
+
+private:
+    // ========== Internal Types ==========
+
+    struct Node
+    {
+        std::array<Bounds, Fanout> aBounds{};       // Scanned together on search
+        std::array<std::uint32_t, Fanout> aChild{}; // Node index, or payload index in leaves
+        std::uint32_t nCount{};
+        bool bLeaf{true};
+    };
+
+    static constexpr std::size_t MaxStack = 32 * (Fanout - 1) + 1;
+
+    std::vector<Node> m_aNode;
+    std::size_t m_nSize{};
+
+    // ========== Build ==========
+
+    static auto CountNodes(std::size_t nItem) -> std::size_t
+    {
+        std::size_t nTotal = 0;
+        do
+        {
+            nItem = (nItem + Fanout - 1) / Fanout;
+            nTotal += nItem;
+        } while (nItem > 1);
+        return nTotal;
+    }
+
+    static auto CenterX(const Item& item) -> KeyT
+    {
+        return item.bbox.xMin + (item.bbox.xMax - item.bbox.xMin) / 2;
+    }
+
+    static auto CenterY(const Item& item) -> KeyT
+    {
+        return item.bbox.yMin + (item.bbox.yMax - item.bbox.yMin) / 2;
+    }
+
+    /// Sort-Tile-Recursive: sqrt(P) vertical slices of sqrt(P) nodes each,
+    /// every slice sorted by y, then cut into runs of Fanout entries
+    auto PackLevel(std::vector<Item>& aEntry, bool bLeaf) -> std::vector<Item>
+    {
+        const auto nEntry = aEntry.size();
+        const auto nNode = (nEntry + Fanout - 1) / Fanout;
+        const auto nSlice = static_cast<std::size_t>(
+            std::ceil(std::sqrt(static_cast<double>(nNode))));
+        const auto nSliceEntry = nSlice * Fanout;
+
+        auto byX = [](const Item& a, const Item& b) { return CenterX(a) < CenterX(b); };
+        auto byY = [](const Item& a, const Item& b) { return CenterY(a) < CenterY(b); };
+
+        std::stable_sort(aEntry.begin(), aEntry.end(), byX);
+
+        std::vector<Item> aParent;
+        aParent.reserve(nNode);
+
+        for (std::size_t slice = 0; slice < nEntry; slice += nSliceEntry)
+        {
+            const auto sliceEnd = std::min(nEntry, slice + nSliceEntry);
+            std::stable_sort(aEntry.begin() + static_cast<std::ptrdiff_t>(slice),
+                             aEntry.begin() + static_cast<std::ptrdiff_t>(sliceEnd), byY);
+
+            for (std::size_t first = slice; first < sliceEnd; first += Fanout)
+            {
+                const auto last = std::min(sliceEnd, first + Fanout);
+
+                Node node;
+                node.bLeaf = bLeaf;
+                Item parent{aEntry[first].bbox, static_cast<std::uint32_t>(m_aNode.size())};
+                for (auto i = first; i < last; ++i)
+                {
+                    node.aBounds[node.nCount] = aEntry[i].bbox;
+                    node.aChild[node.nCount] = aEntry[i].nIndex;
+                    ++node.nCount;
+                    parent.bbox.Extend(aEntry[i].bbox);
+                }
+
+                m_aNode.push_back(node);
+                aParent.push_back(parent);
+            }
+        }
+
+        return aParent;
+    }
+};
+
+} // namespace ms
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -105,10 +106,19 @@ public:
 
     /// Search: find all entries whose bbox intersects query
     template <typename Container>
+        requires requires(Container& c, const DataT& d) { c.push_back(d); }
     void Search(const Bounds& query, Container& results) const
+    {
+        Search(query, [&results](const DataT& data) { results.push_back(data); });
+    }
+
+    /// Search: call visit(data) for every entry whose bbox intersects query
+    template <typename Visitor>
+        requires std::invocable<Visitor&, const DataT&>
+    void Search(const Bounds& query, Visitor&& visit) const
     {
         if (m_pRoot)
-            SearchImpl(m_pRoot, query, results);
+            SearchImpl(m_pRoot, query, visit);
     }
 
     /// Insert a data entry with given bounding box
@@ -186,8 +196,8 @@ private:
 
     // ========== Search ==========
 
-    template <typename Container>
-    static void SearchImpl(const Node* node, const Bounds& query, Container& results)
+    template <typename Visitor>
+    static void SearchImpl(const Node* node, const Bounds& query, Visitor& visit)
     {
         for (std::size_t i = 0; i < node->nCount; ++i)
         {
@@ -196,9 +206,9 @@ private:
                 continue;
 
             if (node->bLeaf)
-                results.push_back(e.data);
+                visit(e.data);
             else
-                SearchImpl(e.child, query, results);
+                SearchImpl(e.child, query, visit);
         }
     }
 
@@ -16,6 +16,13 @@ WzCanvas::WzCanvas(int width, int height)
     }
 }
 
+WzCanvas::WzCanvas(int width, int height, std::vector<std::uint8_t>&& data)
+    : m_nWidth(width)
+    , m_nHeight(height)
+    , m_pixelData(std::move(data))
+{
+}
+
 WzCanvas::~WzCanvas() = default;
 
 WzCanvas::WzCanvas(WzCanvas&& other) noexcept
@@ -19,6 +19,8 @@ class WzCanvas
 public:
     WzCanvas();
     WzCanvas(int width, int height);
+    /// Adopt width * height RGBA32 pixels
+    WzCanvas(int width, int height, std::vector<std::uint8_t>&& data);
     ~WzCanvas();
 
     // Non-copyable, movable
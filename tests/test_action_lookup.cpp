@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "animation/ActionSpec.h"
+#include "util/FlatHashMap.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+
+using namespace ms;
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    TFlatHashMap<std::int32_t, std::shared_ptr<int>> map;
+    EXPECT_EQ(map.Find(5), nullptr);
+
+    map[5] = std::make_shared<int>(50);
+    map[-7] = std::make_shared<int>(-70);
+    map[0] = nullptr;
+
+    ASSERT_NE(map.Find(5), nullptr);
+    EXPECT_EQ(**map.Find(5), 50);
+    EXPECT_EQ(**map.Find(-7), -70);
+    ASSERT_NE(map.Find(0), nullptr);
+    EXPECT_EQ(*map.Find(0), nullptr);
+    EXPECT_EQ(map.GetSize(), 3u);
+
+    EXPECT_TRUE(map.Erase(5));
+    EXPECT_FALSE(map.Erase(5));
+    EXPECT_FALSE(map.Contains(5));
+    EXPECT_TRUE(map.Contains(-7));
+    EXPECT_EQ(map.GetSize(), 2u);
+
+    map.Clear();
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_EQ(map.Find(-7), nullptr);
+}
+
+TEST(FlatHashMapTest, MatchesStdMapUnderRandomChurn)
+{
+    TFlatHashMap<std::uint64_t, std::int32_t> flat;
+    std::map<std::uint64_t, std::int32_t> ref;
+    std::mt19937 rng(43);
+    // Small key range so erases hit and probe runs wrap around
+    std::uniform_int_distribution<std::uint64_t> key(0, 300);
+
+    for (std::int32_t i = 0; i < 20000; ++i)
+    {
+        const auto k = key(rng);
+        if (rng() % 3 == 0)
+        {
+            EXPECT_EQ(flat.Erase(k), ref.erase(k) != 0);
+        }
+        else
+        {
+            flat[k] = i;
+            ref[k] = i;
+        }
+    }
+
+    ASSERT_EQ(flat.GetSize(), ref.size());
+    for (std::uint64_t k = 0; k <= 300; ++k)
+    {
+        const auto* p = flat.Find(k);
+        const auto it = ref.find(k);
+        ASSERT_EQ(p != nullptr, it != ref.end()) << k;
+        if (p)
+        {
+            EXPECT_EQ(*p, it->second);
+        }
+    }
+
+    std::size_t nVisited = 0;
+    flat.ForEach([&](std::uint64_t k, std::int32_t v)
+    {
+        EXPECT_EQ(ref.at(k), v);
+        ++nVisited;
+    });
+    EXPECT_EQ(nVisited, ref.size());
+}
+
+TEST(ActionNameHashTest, EveryNameMapsToItsFirstCode)
+{
+    for (std::size_t i = 0; i < ACTIONDATA_COUNT; ++i)
+    {
+        const auto sName = s_aActionSpec[i].sName;
+        std::int32_t nFirst = -1;
+        for (std::size_t j = 0; j <= i && nFirst < 0; ++j)
+        {
+            if (s_aActionSpec[j].sName == sName)
+                nFirst = static_cast<std::int32_t>(j);
+        }
+        EXPECT_EQ(get_action_code_from_name(sName), nFirst) << sName;
+    }
+}
+
+TEST(ActionNameHashTest, RejectsUnknownNames)
+{
+    static_assert(get_action_code_from_name("walk1") == 0);
+    static_assert(get_action_code_from_name("stand1") == 2);
+    static_assert(get_action_code_from_name("noSuchAction") == -1);
+
+    EXPECT_EQ(get_action_code_from_name(""), -1);
+    EXPECT_EQ(get_action_code_from_name("Walk1"), -1);
+    EXPECT_EQ(get_action_code_from_name("walk1 "), -1);
+}
+
+TEST(ActionSpecTest, FlagsAreKnownAtCompileTime)
+{
+    static_assert(s_aActionSpec[2].sName == "stand1" && s_aActionSpec[2].bZigzag);
+    static_assert(s_aActionSpec[34].sName == "rune" && s_aActionSpec[34].bPieced);
+
+    // ActionMan reads bZigzag from the spec without loading the action,
+    // which is only sound because the loader never touches it: it would
+    // clear it for pieced actions.
+    for (const auto& spec : s_aActionSpec)
+        EXPECT_FALSE(spec.bPieced && spec.bZigzag) << spec.sName;
+}
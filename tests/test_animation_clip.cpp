@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2DAnimationClip.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DLayer.h"
+#include "wz/WzCanvas.h"
+#include "wz/WzProperty.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+auto MakeInt(const std::string& sName, std::int32_t n) -> std::shared_ptr<WzProperty>
+{
+    auto p = std::make_shared<WzProperty>(sName);
+    p->SetInt(n);
+    return p;
+}
+
+/// "0".."n-1" frames with a canvas and delay 100 * (i + 1)
+auto MakeAnimation(std::int32_t nFrame) -> std::shared_ptr<WzProperty>
+{
+    auto pAnim = std::make_shared<WzProperty>("anim");
+    for (std::int32_t i = 0; i < nFrame; ++i)
+    {
+        auto pFrame = std::make_shared<WzProperty>(std::to_string(i));
+        pFrame->SetCanvas(std::make_shared<WzCanvas>(8, 8));
+        pFrame->AddChild(MakeInt("delay", 100 * (i + 1)));
+        if (i == 1)
+        {
+            pFrame->AddChild(MakeInt("a0", 0));
+            pFrame->AddChild(MakeInt("a1", 128));
+        }
+        auto pOrigin = std::make_shared<WzProperty>("origin");
+        pOrigin->SetVector(i, 2 * i);
+        pFrame->AddChild(pOrigin);
+        pAnim->AddChild(pFrame);
+    }
+    return pAnim;
+}
+
+} // namespace
+
+TEST(AnimationClipTest, LoadsFramesDelaysAlphaAndOrigin)
+{
+    auto pClip = WzGr2DAnimationClip::Load(MakeAnimation(3));
+    ASSERT_NE(pClip, nullptr);
+    ASSERT_EQ(pClip->GetFrameCount(), 3u);
+    EXPECT_EQ(pClip->GetTotalDelay(), 600);
+
+    const auto& aFrame = pClip->GetFrames();
+    EXPECT_EQ(aFrame[0].nDelay, 100);
+    EXPECT_EQ(aFrame[2].nDelay, 300);
+    EXPECT_EQ(aFrame[1].nAlpha0, 0);
+    EXPECT_EQ(aFrame[1].nAlpha1, 128);
+    EXPECT_EQ(aFrame[0].nAlpha0, 255);
+    EXPECT_EQ(aFrame[2].pCanvas->GetOrigin(), (Point2D{2, 4}));
+}
+
+TEST(AnimationClipTest, LayersOfOneTemplateShareCanvases)
+{
+    WzGr2DAnimationClipCache cache;
+    auto pAnim = MakeAnimation(4);
+
+    std::vector<std::shared_ptr<WzGr2DLayer>> aLayer;
+    for (int i = 0; i < 50; ++i)
+    {
+        auto pLayer = std::make_shared<WzGr2DLayer>();
+        EXPECT_EQ(pLayer->InsertClip(cache.Get(pAnim)), 4u);
+        aLayer.push_back(pLayer);
+    }
+
+    EXPECT_EQ(cache.GetMissCount(), 1u);
+    EXPECT_EQ(cache.GetHitCount(), 49u);
+    for (const auto& pLayer : aLayer)
+    {
+        ASSERT_EQ(pLayer->GetCanvasCount(), 4u);
+        for (std::size_t f = 0; f < 4; ++f)
+            EXPECT_EQ(pLayer->GetCanvas(f), aLayer[0]->GetCanvas(f));
+    }
+
+    // Each instance keeps its own playback position
+    aLayer[1]->SetCurrentFrame(2);
+    EXPECT_EQ(aLayer[0]->GetCurrentFrame(), 0u);
+    EXPECT_EQ(aLayer[1]->GetCurrentFrame(), 2u);
+}
+
+TEST(AnimationClipTest, LayerPlaysClipFramesInOrder)
+{
+    WzGr2DAnimationClipCache cache;
+    auto pClip = cache.Get(MakeAnimation(3));
+
+    WzGr2DLayer layer;
+    layer.InsertClip(pClip);
+    ASSERT_TRUE(layer.Animate(Gr2DAnimationType::Repeat));
+
+    // Frame delays are 100, 200 and 300 ms
+    layer.Update(0);
+    EXPECT_EQ(layer.GetCurrentFrame(), 0u);
+    layer.Update(100);
+    EXPECT_EQ(layer.GetCurrentFrame(), 1u);
+    EXPECT_EQ(layer.GetCurrentCanvas(), pClip->GetFrames()[1].pCanvas);
+    layer.Update(250);
+    EXPECT_EQ(layer.GetCurrentFrame(), 1u);
+    layer.Update(300);
+    EXPECT_EQ(layer.GetCurrentFrame(), 2u);
+    layer.Update(600);
+    EXPECT_EQ(layer.GetCurrentFrame(), 0u);
+}
+
+TEST(AnimationClipTest, AppendingToAClipLayerKeepsFrameOrder)
+{
+    WzGr2DAnimationClipCache cache;
+    auto pFirst = cache.Get(MakeAnimation(2));
+    auto pSecond = WzGr2DAnimationClip::Load(MakeAnimation(3));
+
+    WzGr2DLayer layer;
+    layer.InsertClip(pFirst);
+    layer.SetCurrentFrame(1);
+    EXPECT_EQ(layer.InsertClip(pSecond), 3u);
+
+    ASSERT_EQ(layer.GetCanvasCount(), 5u);
+    EXPECT_EQ(layer.GetCurrentFrame(), 1u);
+    EXPECT_EQ(layer.GetCanvas(0), pFirst->GetFrames()[0].pCanvas);
+    EXPECT_EQ(layer.GetCanvas(1), pFirst->GetFrames()[1].pCanvas);
+    EXPECT_EQ(layer.GetCanvas(4), pSecond->GetFrames()[2].pCanvas);
+}
+
+TEST(AnimationClipTest, ClipDiesWithItsLastLayer)
+{
+    WzGr2DAnimationClipCache cache;
+    auto pAnim = MakeAnimation(2);
+
+    std::weak_ptr<WzGr2DCanvas> pFirstCanvas;
+    {
+        WzGr2DLayer layer;
+        layer.InsertClip(cache.Get(pAnim));
+        pFirstCanvas = layer.GetCanvas(0);
+        EXPECT_FALSE(pFirstCanvas.expired());
+    }
+    EXPECT_TRUE(pFirstCanvas.expired());
+
+    // Next instance reloads rather than resurrecting the old clip
+    auto pClip = cache.Get(pAnim);
+    EXPECT_EQ(cache.GetMissCount(), 2u);
+    EXPECT_EQ(pClip->GetFrameCount(), 2u);
+
+    pClip.reset();
+    pAnim.reset();
+    cache.Prune();
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+TEST(AnimationClipTest, ClampsFrameAlpha)
+{
+    auto pAnim = MakeAnimation(1);
+    auto pFrame = pAnim->GetChild("0");
+    pFrame->AddChild(MakeInt("a0", 300));
+    pFrame->AddChild(MakeInt("a1", -20));
+
+    auto pClip = WzGr2DAnimationClip::Load(pAnim);
+    ASSERT_EQ(pClip->GetFrameCount(), 1u);
+    EXPECT_EQ(pClip->GetFrames()[0].nAlpha0, 255);
+    EXPECT_EQ(pClip->GetFrames()[0].nAlpha1, 0);
+}
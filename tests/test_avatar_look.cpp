@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "enums/BodyPart.h"
+#include "user/avatar/AvatarLook.h"
+
+#include <cstdint>
+#include <unordered_set>
+
+using namespace ms;
+
+namespace
+{
+
+auto Slot(BodyPart ePart) -> std::size_t
+{
+    return static_cast<std::size_t>(ePart);
+}
+
+auto MakeLook() -> AvatarLook
+{
+    AvatarLook al;
+    al.Initialize();
+    al.nGender = 1;
+    al.nSkin = 2;
+    al.nFace = 21001;
+    al.nJob = 112;
+    al.anHairEquip[Slot(BodyPart::BP_HAIR)] = 31000;
+    al.anHairEquip[Slot(BodyPart::BP_CLOTHES)] = 1040002;
+    al.anHairEquip[Slot(BodyPart::BP_WEAPON)] = 1302000;
+    return al;
+}
+
+} // namespace
+
+TEST(AvatarLookTest, EqualLooksHashEqual)
+{
+    const auto a = MakeLook();
+    auto b = MakeLook();
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.GetHash(), b.GetHash());
+    EXPECT_TRUE(a.Diff(b).IsEmpty());
+
+    // Every field takes part in the digest
+    std::unordered_set<std::uint64_t> seen{a.GetHash()};
+    for (std::size_t i = 0; i < AvatarLook::kMaxHairEquip; ++i)
+    {
+        b = MakeLook();
+        b.anHairEquip[i] += 1;
+        EXPECT_TRUE(seen.insert(b.GetHash()).second) << i;
+    }
+    b = MakeLook();
+    b.anPetID[2] = 5000000;
+    EXPECT_TRUE(seen.insert(b.GetHash()).second);
+    b = MakeLook();
+    b.nMixHairPercent = 50;
+    EXPECT_TRUE(seen.insert(b.GetHash()).second);
+    b = MakeLook();
+    b.bDrawElfEar = true;
+    EXPECT_TRUE(seen.insert(b.GetHash()).second);
+}
+
+TEST(AvatarLookTest, DiffReportsChangedSlots)
+{
+    const auto a = MakeLook();
+    auto b = MakeLook();
+    b.anHairEquip[Slot(BodyPart::BP_CAP)] = 1002000;
+    b.anHairEquip[Slot(BodyPart::BP_WEAPON)] = 1302001;
+
+    const auto diff = a.Diff(b);
+    EXPECT_EQ(diff.uField, AvatarLookDiff::HairEquip);
+    EXPECT_EQ(diff.uHairEquipSlot, (1u << 1) | (1u << 11));
+    EXPECT_TRUE(diff.AffectsAction());
+    EXPECT_FALSE(diff.AffectsFace());
+}
+
+TEST(AvatarLookTest, DiffRoutesChangesToTheLayersTheyTouch)
+{
+    const auto a = MakeLook();
+
+    // Face only
+    auto b = MakeLook();
+    b.nFace = 21002;
+    EXPECT_FALSE(a.Diff(b).AffectsAction());
+    EXPECT_TRUE(a.Diff(b).AffectsFace());
+
+    // Face accessory is drawn on the face, not in the action frames
+    b = MakeLook();
+    b.anHairEquip[Slot(BodyPart::BP_FACEACC)] = 1012000;
+    EXPECT_FALSE(a.Diff(b).AffectsAction());
+    EXPECT_TRUE(a.Diff(b).AffectsFace());
+
+    // Rings, pet wear and pets need no avatar rebuild
+    b = MakeLook();
+    b.anHairEquip[Slot(BodyPart::BP_RING1)] = 1112000;
+    b.anHairEquip[Slot(BodyPart::BP_PETWEAR)] = 1802000;
+    b.anPetID[0] = 5000000;
+    b.anUnseenEquip[3] = 1002000;
+    EXPECT_FALSE(b.Diff(a).IsEmpty());
+    EXPECT_FALSE(a.Diff(b).AffectsAction());
+    EXPECT_FALSE(a.Diff(b).AffectsFace());
+
+    // Taming mob slots only feed the taming mob frames
+    b = MakeLook();
+    b.anHairEquip[Slot(BodyPart::BP_TAMINGMOB)] = 1902000;
+    b.anHairEquip[Slot(BodyPart::BP_SADDLE)] = 1912000;
+    EXPECT_FALSE(a.Diff(b).AffectsAction());
+    EXPECT_TRUE(a.Diff(b).AffectsTamingMob());
+    EXPECT_FALSE(a.Diff(b).AffectsFace());
+
+    // Skin colours both body and face
+    b = MakeLook();
+    b.nSkin = 3;
+    EXPECT_TRUE(a.Diff(b).AffectsAction());
+    EXPECT_TRUE(a.Diff(b).AffectsFace());
+}
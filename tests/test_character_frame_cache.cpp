@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include "animation/CharacterActionFrameEntry.h"
+#include "animation/CharacterFrameCache.h"
+#include "animation/SpriteInstance.h"
+#include "animation/SpriteSource.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "wz/WzCanvas.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+/// Solid-colour sprite at pt (top-left, frame coordinates) with z order
+auto MakeSprite(std::int32_t x, std::int32_t y, int w, int h, std::int32_t z,
+                std::uint32_t rgba) -> std::shared_ptr<SpriteInstance>
+{
+    std::vector<std::uint8_t> aPixel(static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4);
+    for (std::size_t i = 0; i < aPixel.size(); i += 4)
+    {
+        aPixel[i] = static_cast<std::uint8_t>(rgba >> 24);
+        aPixel[i + 1] = static_cast<std::uint8_t>(rgba >> 16);
+        aPixel[i + 2] = static_cast<std::uint8_t>(rgba >> 8);
+        aPixel[i + 3] = static_cast<std::uint8_t>(rgba);
+    }
+
+    auto pSource = std::make_shared<SpriteSource>();
+    pSource->m_pSprite = std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(w, h, std::move(aPixel)));
+    pSource->m_cx = w;
+    pSource->m_cy = h;
+    pSource->m_z = z;
+
+    auto pSprite = std::make_shared<SpriteInstance>();
+    pSprite->m_pSource = std::move(pSource);
+    pSprite->m_pt = {x, y};
+    return pSprite;
+}
+
+auto PixelAt(const WzGr2DCanvas& canvas, int x, int y) -> std::uint32_t
+{
+    const auto& aPixel = canvas.GetCanvas()->GetPixelData();
+    const auto i = (static_cast<std::size_t>(y) * static_cast<std::size_t>(canvas.GetWidth())
+                  + static_cast<std::size_t>(x)) * 4;
+    return (static_cast<std::uint32_t>(aPixel[i]) << 24) | (static_cast<std::uint32_t>(aPixel[i + 1]) << 16)
+         | (static_cast<std::uint32_t>(aPixel[i + 2]) << 8) | aPixel[i + 3];
+}
+
+auto MakeLook(std::int32_t nHair) -> CharacterLook
+{
+    CharacterLook look;
+    look.nSkin = 2;
+    look.aEquip[0] = nHair;
+    look.aEquip[5] = 1040036;
+    look.Seal();
+    return look;
+}
+
+auto MakeAction(std::size_t nFrame, int nEdge) -> std::vector<std::shared_ptr<CharacterActionFrameEntry>>
+{
+    std::vector<std::shared_ptr<CharacterActionFrameEntry>> apFE;
+    for (std::size_t i = 0; i < nFrame; ++i)
+    {
+        auto pEntry = std::make_shared<CharacterActionFrameEntry>();
+        std::vector<std::shared_ptr<SpriteInstance>> aSprite{MakeSprite(0, 0, nEdge, nEdge, 0, 0xFFFFFFFF)};
+        CharacterFrameCache::Composite(aSprite, 100, *pEntry);
+        apFE.push_back(std::move(pEntry));
+    }
+    return apFE;
+}
+
+} // namespace
+
+TEST(CharacterFrameCacheTest, CompositeSplitsAtFaceZ)
+{
+    // Body and arm below the face, hat above it
+    std::vector<std::shared_ptr<SpriteInstance>> aSprite{
+        MakeSprite(-10, -20, 20, 30, 1, 0xFF0000FF),
+        MakeSprite(5, -5, 10, 10, 2, 0x00FF00FF),
+        MakeSprite(-8, -30, 16, 8, 50, 0x0000FFFF)};
+
+    CharacterActionFrameEntry entry;
+    entry.tDelay = 180;
+    CharacterFrameCache::Composite(aSprite, 10, entry);
+
+    ASSERT_NE(entry.pCanvasUnderFace, nullptr);
+    ASSERT_NE(entry.pCanvasOverFace, nullptr);
+
+    // Under-face covers both lower sprites, origin stays at the frame origin
+    const auto& under = *entry.pCanvasUnderFace;
+    EXPECT_EQ(under.GetWidth(), 25);
+    EXPECT_EQ(under.GetHeight(), 30);
+    EXPECT_EQ(under.GetOrigin().x, 10);
+    EXPECT_EQ(under.GetOrigin().y, 20);
+    EXPECT_EQ(under.GetDelay(), 180);
+    EXPECT_EQ(PixelAt(under, 0, 0), 0xFF0000FFu);         // body
+    EXPECT_EQ(PixelAt(under, 16, 16), 0x00FF00FFu);       // arm drawn over body
+    EXPECT_EQ(PixelAt(under, 22, 2), 0x00000000u);        // outside both
+
+    const auto& over = *entry.pCanvasOverFace;
+    EXPECT_EQ(over.GetWidth(), 16);
+    EXPECT_EQ(over.GetHeight(), 8);
+    EXPECT_EQ(over.GetOrigin().x, 8);
+    EXPECT_EQ(over.GetOrigin().y, 30);
+    EXPECT_EQ(PixelAt(over, 3, 3), 0x0000FFFFu);
+}
+
+TEST(CharacterFrameCacheTest, CompositeSkipsHiddenAndLeavesEmptySideNull)
+{
+    auto pHidden = MakeSprite(-50, -50, 10, 10, 60, 0xFFFFFFFF);
+    pHidden->m_bVisible = false;
+    std::vector<std::shared_ptr<SpriteInstance>> aSprite{
+        MakeSprite(0, 0, 4, 4, 1, 0x102030FF), pHidden};
+
+    CharacterActionFrameEntry entry;
+    CharacterFrameCache::Composite(aSprite, 10, entry);
+
+    ASSERT_NE(entry.pCanvasUnderFace, nullptr);
+    EXPECT_EQ(entry.pCanvasUnderFace->GetWidth(), 4);
+    EXPECT_EQ(entry.pCanvasOverFace, nullptr);
+}
+
+TEST(CharacterFrameCacheTest, CompositeBlendsTranslucentParts)
+{
+    std::vector<std::shared_ptr<SpriteInstance>> aSprite{
+        MakeSprite(0, 0, 2, 2, 1, 0x000000FF),
+        MakeSprite(0, 0, 2, 2, 2, 0xFF000080)};
+
+    CharacterActionFrameEntry entry;
+    CharacterFrameCache::Composite(aSprite, 10, entry);
+
+    ASSERT_NE(entry.pCanvasUnderFace, nullptr);
+    const auto px = PixelAt(*entry.pCanvasUnderFace, 1, 1);
+    EXPECT_EQ(px & 0xFFu, 0xFFu);                   // still opaque
+    EXPECT_NEAR(static_cast<int>(px >> 24), 128, 1); // half red over black
+    EXPECT_EQ((px >> 16) & 0xFFu, 0u);
+}
+
+TEST(CharacterFrameCacheTest, EqualLooksShareFrames)
+{
+    CharacterFrameCache cache;
+    auto apFE = MakeAction(3, 8);
+    cache.InsertAction(MakeLook(30000), 5, apFE);
+
+    std::vector<std::shared_ptr<CharacterActionFrameEntry>> apFound;
+    ASSERT_TRUE(cache.FindAction(MakeLook(30000), 5, apFound));
+    ASSERT_EQ(apFound.size(), 3u);
+    for (std::size_t i = 0; i < 3; ++i)
+        EXPECT_EQ(apFound[i], apFE[i]);
+
+    EXPECT_FALSE(cache.FindAction(MakeLook(30010), 5, apFound));
+    EXPECT_FALSE(cache.FindAction(MakeLook(30000), 6, apFound));
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+    EXPECT_EQ(cache.GetMissCount(), 2u);
+    EXPECT_EQ(cache.GetByteSize(), 3u * 8u * 8u * 4u);
+}
+
+TEST(CharacterFrameCacheTest, EvictsLeastRecentlyUsed)
+{
+    CharacterFrameCache cache;
+    constexpr std::size_t FrameBytes = 16u * 16u * 4u;
+    cache.SetBudget(4 * FrameBytes);
+
+    cache.InsertAction(MakeLook(1), 0, MakeAction(2, 16));
+    cache.InsertAction(MakeLook(2), 0, MakeAction(2, 16));
+
+    // Touch look 1 so look 2 is the oldest
+    std::vector<std::shared_ptr<CharacterActionFrameEntry>> apFound;
+    ASSERT_TRUE(cache.FindAction(MakeLook(1), 0, apFound));
+
+    cache.InsertAction(MakeLook(3), 0, MakeAction(2, 16));
+    EXPECT_EQ(cache.GetFrameCount(), 4u);
+    EXPECT_LE(cache.GetByteSize(), cache.GetBudget());
+
+    EXPECT_TRUE(cache.FindAction(MakeLook(1), 0, apFound));
+    EXPECT_FALSE(cache.FindAction(MakeLook(2), 0, apFound));
+    EXPECT_TRUE(cache.FindAction(MakeLook(3), 0, apFound));
+
+    // Frames handed out stay alive after eviction
+    cache.Clear();
+    EXPECT_EQ(cache.GetByteSize(), 0u);
+    ASSERT_EQ(apFound.size(), 2u);
+    EXPECT_NE(apFound[0]->pCanvasUnderFace, nullptr);
+}
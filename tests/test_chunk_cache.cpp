@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DChunkCache.h"
+#include "graphics/WzGr2DLayer.h"
+#include "graphics/WzGr2DRenderList.h"
+#include "graphics/WzGr2DTypes.h"
+#include "wz/WzCanvas.h"
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+using namespace ms;
+
+class ChunkCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        get_gr().RemoveAllLayers();
+    }
+
+    void TearDown() override
+    {
+        get_gr().RemoveAllLayers();
+    }
+
+    static auto makeStatic(std::int32_t z) -> std::shared_ptr<WzGr2DLayer>
+    {
+        auto layer = get_gr().CreateLayer(0, 0, 8, 8, z);
+        layer->InsertCanvas(std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(8, 8)));
+        layer->SetColor(0xFFFFFFFF);
+        return layer;
+    }
+
+    /// A static layer with real pixels, so it gets a texture when drawn
+    static auto makeOpaque(std::int32_t x, std::int32_t y, std::int32_t z)
+        -> std::shared_ptr<WzGr2DLayer>
+    {
+        auto canvas = std::make_shared<WzCanvas>(8, 8);
+        canvas->SetPixelData(std::vector<std::uint8_t>(8 * 8 * 4, 0xFF));
+        auto layer = get_gr().CreateLayer(x, y, 8, 8, z);
+        layer->InsertCanvas(std::make_shared<WzGr2DCanvas>(std::move(canvas)));
+        layer->SetColor(0xFFFFFFFF);
+        return layer;
+    }
+};
+
+TEST_F(ChunkCacheTest, StaticLayerIsBakeable)
+{
+    auto layer = makeStatic(0);
+    EXPECT_TRUE(WzGr2DChunkCache::IsBakeable(*layer));
+
+    layer->SetVisible(false);
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*layer));
+}
+
+TEST_F(ChunkCacheTest, ChangingLayersAreNotBakeable)
+{
+    auto animated = makeStatic(0);
+    animated->InsertCanvas(std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(8, 8)));
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*animated));
+
+    auto tiled = makeStatic(0);
+    tiled->SetTiling(8, 0);
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*tiled));
+
+    auto moving = makeStatic(0);
+    moving->RelMove(10, 0, 0, 1000);
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*moving));
+
+    auto faded = makeStatic(0);
+    faded->SetColor(0x80FFFFFF);
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*faded));
+
+    auto empty = get_gr().CreateLayer(0, 0, 8, 8, 0);
+    EXPECT_FALSE(WzGr2DChunkCache::IsBakeable(*empty));
+}
+
+TEST_F(ChunkCacheTest, RunsSplitAtForeignLayers)
+{
+    auto a = makeStatic(1);
+    auto b = makeStatic(2);
+    auto foreign = makeStatic(3);
+    auto c = makeStatic(4);
+    auto d = makeStatic(5);
+    auto e = makeStatic(6);
+
+    const std::unordered_set<const WzGr2DLayer*> candidates{
+        a.get(), b.get(), c.get(), d.get(), e.get()};
+    auto runs = WzGr2DChunkCache::FindRuns(get_gr().GetLayerList(), candidates);
+
+    ASSERT_EQ(runs.size(), 2);
+    ASSERT_EQ(runs[0].size(), 2);
+    EXPECT_EQ(runs[0][0], a);
+    EXPECT_EQ(runs[0][1], b);
+    ASSERT_EQ(runs[1].size(), 3);
+    EXPECT_EQ(runs[1][0], c);
+    EXPECT_EQ(runs[1][2], e);
+    (void)foreign;
+}
+
+TEST_F(ChunkCacheTest, RunsFollowRenderOrderNotCandidateOrder)
+{
+    auto high = makeStatic(10);
+    auto low = makeStatic(-10);
+    auto mid = makeStatic(0);
+
+    const std::unordered_set<const WzGr2DLayer*> candidates{high.get(), low.get(), mid.get()};
+    auto runs = WzGr2DChunkCache::FindRuns(get_gr().GetLayerList(), candidates);
+
+    ASSERT_EQ(runs.size(), 1);
+    ASSERT_EQ(runs[0].size(), 3);
+    EXPECT_EQ(runs[0][0], low);
+    EXPECT_EQ(runs[0][1], mid);
+    EXPECT_EQ(runs[0][2], high);
+}
+
+TEST_F(ChunkCacheTest, BakeWithoutRendererLeavesLayersLive)
+{
+    auto a = makeStatic(1);
+    auto b = makeStatic(2);
+
+    WzGr2DChunkCache cache;
+    cache.Bake({a, b});
+
+    EXPECT_EQ(cache.GetRunCount(), 0);
+    EXPECT_FALSE(cache.IsBaked(a.get()));
+    EXPECT_TRUE(a->IsVisible());
+    EXPECT_TRUE(b->IsVisible());
+    EXPECT_TRUE(a->GetBakedChunks().empty());
+}
+
+TEST_F(ChunkCacheTest, StaticLayersAreReplacedByAChunk)
+{
+    auto* surface = SDL_CreateSurface(256, 256, SDL_PIXELFORMAT_RGBA32);
+    auto* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (!renderer)
+    {
+        SDL_DestroySurface(surface);
+        GTEST_SKIP() << "No software renderer: " << SDL_GetError();
+    }
+
+    {
+        auto a = makeOpaque(0, 0, 1);
+        auto b = makeOpaque(16, 0, 2);
+        auto c = makeOpaque(0, 24, 3);
+
+        WzGr2DChunkCache cache{renderer};
+        cache.Bake({a, b, c});
+
+        ASSERT_EQ(cache.GetRunCount(), 1);
+        ASSERT_EQ(cache.GetChunkCount(), 1);
+        EXPECT_TRUE(cache.IsBaked(a.get()));
+        EXPECT_TRUE(cache.IsBaked(c.get()));
+
+        // The head draws the chunk; the rest are hidden behind it
+        ASSERT_EQ(a->GetBakedChunks().size(), 1);
+        EXPECT_TRUE(a->IsVisible());
+        EXPECT_FALSE(b->IsVisible());
+        EXPECT_FALSE(c->IsVisible());
+
+        // One premultiplied quad covering all three layers
+        const auto& chunk = a->GetBakedChunks().front();
+        WzGr2DRenderList list;
+        a->CollectRenderItems(list, renderer, 0, 0, 0, 0);
+        ASSERT_EQ(list.GetCount(), 1);
+        EXPECT_EQ(list.GetTexture(0), chunk.pCanvas->GetTexture());
+        EXPECT_EQ(list.GetBlend(0), static_cast<std::int32_t>(LayerBlendType::Premultiplied));
+        EXPECT_FLOAT_EQ(list.GetBounds(0).x, static_cast<float>(chunk.x));
+        EXPECT_FLOAT_EQ(list.GetBounds(0).y, static_cast<float>(chunk.y));
+        EXPECT_FLOAT_EQ(list.GetBounds(0).w, 24.0F);
+        EXPECT_FLOAT_EQ(list.GetBounds(0).h, 32.0F);
+
+        // A later layer inside the run's z span draws above it and leaves it baked
+        auto effect = makeOpaque(4, 4, 2);
+        effect->InsertCanvas(std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(8, 8)));
+        cache.Update();
+        EXPECT_EQ(cache.GetRunCount(), 1);
+
+        // Invalidating a layer that was never baked changes nothing
+        cache.Invalidate(effect);
+        cache.Update();
+        EXPECT_EQ(cache.GetRunCount(), 1);
+        get_gr().RemoveLayer(effect);
+        cache.Update();
+        EXPECT_EQ(cache.GetRunCount(), 1);
+
+        // A changed member is drawn live, then joins again once it is static
+        cache.Invalidate(b);
+        EXPECT_EQ(cache.GetRunCount(), 0);
+        EXPECT_TRUE(b->IsVisible());
+        b->SetColor(0x80FFFFFF);
+        cache.Update();
+        EXPECT_FALSE(cache.IsBaked(b.get()));
+        b->SetColor(0xFFFFFFFF);
+        cache.Update();
+        EXPECT_EQ(cache.GetRunCount(), 1);
+        EXPECT_TRUE(cache.IsBaked(a.get()));
+        EXPECT_TRUE(cache.IsBaked(b.get()));
+        EXPECT_TRUE(cache.IsBaked(c.get()));
+
+        cache.Clear();
+        EXPECT_TRUE(b->IsVisible());
+        EXPECT_TRUE(a->GetBakedChunks().empty());
+        get_gr().RemoveAllLayers();
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+}
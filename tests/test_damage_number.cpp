@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "animation/DamageNumberRenderer.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DGlyphAtlas.h"
+#include "graphics/WzGr2DRenderList.h"
+#include "wz/WzCanvas.h"
+#include "wz/WzProperty.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+auto fakeTexture(std::uintptr_t id) -> SDL_Texture*
+{
+    return reinterpret_cast<SDL_Texture*>(id);
+}
+
+/// w x h canvas filled with one RGBA value
+auto MakeSolid(int w, int h, std::uint8_t nTag) -> std::shared_ptr<WzCanvas>
+{
+    std::vector<std::uint8_t> aPixel(static_cast<std::size_t>(w * h * 4), nTag);
+    return std::make_shared<WzCanvas>(w, h, std::move(aPixel));
+}
+
+/// Digits "0".."9" of width 6 + d (large: 12 + d), origin at the bottom
+auto MakeDigitSet(const std::string& sName, bool bLarge) -> std::shared_ptr<WzProperty>
+{
+    auto pSet = std::make_shared<WzProperty>(sName);
+    auto addGlyph = [&](const std::string& sChild, int w, int h)
+    {
+        auto p = std::make_shared<WzProperty>(sChild);
+        p->SetCanvas(MakeSolid(w, h, static_cast<std::uint8_t>(w)));
+        auto pOrigin = std::make_shared<WzProperty>("origin");
+        pOrigin->SetVector(0, h);
+        p->AddChild(pOrigin);
+        pSet->AddChild(p);
+    };
+    for (int d = 0; d < 10; ++d)
+        addGlyph(std::to_string(d), (bLarge ? 12 : 6) + d, bLarge ? 20 : 14);
+    if (bLarge)
+        addGlyph("effect", 40, 40);
+    else
+        addGlyph("Miss", 30, 14);
+    return pSet;
+}
+
+auto MakeRenderer() -> DamageNumberRenderer
+{
+    DamageNumberRenderer renderer(5);
+    // Only the critical set keeps its burst
+    auto pRedLarge = std::make_shared<WzProperty>("NoRed1");
+    auto pFull = MakeDigitSet("NoRed1", true);
+    for (const auto& [sName, pChild] : pFull->GetChildren())
+        if (sName != "effect")
+            pRedLarge->AddChild(pChild);
+    renderer.LoadStyle(DamageStyle::Normal, MakeDigitSet("NoRed0", false), pRedLarge);
+    renderer.LoadStyle(DamageStyle::Critical, MakeDigitSet("NoCri0", false), MakeDigitSet("NoCri1", true));
+    renderer.Build();
+    return renderer;
+}
+
+} // namespace
+
+TEST(GlyphAtlasTest, PacksGlyphsIntoDisjointCells)
+{
+    WzGr2DGlyphAtlas atlas;
+    EXPECT_EQ(atlas.Add(std::make_shared<WzCanvas>(), {}), -1);
+    for (int i = 0; i < 30; ++i)
+        ASSERT_EQ(atlas.Add(MakeSolid(5 + i % 7, 4 + i % 5, static_cast<std::uint8_t>(i + 1)), {i, i}), i);
+    atlas.Build();
+
+    ASSERT_NE(atlas.GetCanvas(), nullptr);
+    const auto nWidth = atlas.GetWidth();
+    const auto& aPixel = atlas.GetCanvas()->GetCanvas()->GetPixelData();
+    ASSERT_EQ(aPixel.size(), static_cast<std::size_t>(nWidth * atlas.GetHeight() * 4));
+
+    for (std::size_t i = 0; i < atlas.GetGlyphCount(); ++i)
+    {
+        const auto& a = atlas.GetGlyph(i);
+        EXPECT_EQ(a.origin.x, static_cast<std::int32_t>(i));
+        EXPECT_LE(a.source.x + a.source.w, static_cast<float>(nWidth));
+        EXPECT_LE(a.source.y + a.source.h, static_cast<float>(atlas.GetHeight()));
+
+        // Every texel of the cell carries the glyph's own pixels
+        for (int y = 0; y < static_cast<int>(a.source.h); ++y)
+            for (int x = 0; x < static_cast<int>(a.source.w); ++x)
+            {
+                const auto px = static_cast<std::size_t>(((static_cast<int>(a.source.y) + y) * nWidth + static_cast<int>(a.source.x) + x) * 4);
+                ASSERT_EQ(aPixel[px], i + 1) << i;
+            }
+
+        for (std::size_t j = i + 1; j < atlas.GetGlyphCount(); ++j)
+        {
+            const auto& b = atlas.GetGlyph(j);
+            const bool bApart = a.source.x + a.source.w <= b.source.x || b.source.x + b.source.w <= a.source.x
+                || a.source.y + a.source.h <= b.source.y || b.source.y + b.source.h <= a.source.y;
+            EXPECT_TRUE(bApart) << i << " overlaps " << j;
+        }
+    }
+}
+
+TEST(DamageNumberTest, RiseAndFadeAreFunctionsOfAge)
+{
+    using R = DamageNumberRenderer;
+    EXPECT_FLOAT_EQ(R::GetRise(0), 0.0F);
+    EXPECT_FLOAT_EQ(R::GetRise(R::Lifetime), static_cast<float>(R::RiseDistance));
+    EXPECT_FLOAT_EQ(R::GetRise(-50), 0.0F);
+    for (std::int32_t t = 10; t <= R::Lifetime; t += 10)
+        EXPECT_GT(R::GetRise(t), R::GetRise(t - 10));
+
+    EXPECT_EQ(R::GetAlpha(0), 255);
+    EXPECT_EQ(R::GetAlpha(R::FadeStart), 255);
+    EXPECT_EQ(R::GetAlpha(R::Lifetime), 0);
+    for (std::int32_t t = R::FadeStart + 10; t < R::Lifetime; t += 10)
+        EXPECT_LT(R::GetAlpha(t), R::GetAlpha(t - 10));
+}
+
+TEST(DamageNumberTest, LaysOutDigitsWithALargeLeadingDigit)
+{
+    auto renderer = MakeRenderer();
+    renderer.Add(305, DamageStyle::Normal, 100, 200, 0);
+
+    WzGr2DRenderList list;
+    ASSERT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), 0, 10, 20), 3u);
+
+    // Large 3 (15 wide), small 0 (6), small 5 (11): 32 px centred on x
+    EXPECT_FLOAT_EQ(list.GetBounds(0).w, 15.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(0).h, 20.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(1).w, 6.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(2).w, 11.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(0).x, 110.0F - 16.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(1).x, 110.0F - 16.0F + 15.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(2).x, 110.0F - 16.0F + 21.0F);
+
+    // Bottom-aligned through the glyph origin
+    EXPECT_FLOAT_EQ(list.GetBounds(0).y + list.GetBounds(0).h, 220.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(2).y + list.GetBounds(2).h, 220.0F);
+
+    // Cells point into the atlas
+    const auto& uv = list.GetUV(1);
+    EXPECT_GT(uv.u1, uv.u0);
+    EXPECT_LE(uv.u1, 1.0F);
+    EXPECT_FLOAT_EQ(list.GetSource(1).w, 6.0F);
+}
+
+TEST(DamageNumberTest, CriticalBurstMissAndExpiry)
+{
+    auto renderer = MakeRenderer();
+    renderer.Add(7, DamageStyle::Critical, 0, 0, 0);
+    renderer.Add(0, DamageStyle::Normal, 0, 0, 0);
+    renderer.Add(12, DamageStyle::Normal, 0, 0, 300); // Staggered line
+
+    WzGr2DRenderList list;
+    // Burst + digit, Miss; the staggered line is not up yet
+    EXPECT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), 100, 0, 0), 3u);
+    EXPECT_FLOAT_EQ(list.GetBounds(0).w, 40.0F);
+    EXPECT_FLOAT_EQ(list.GetBounds(2).w, 30.0F);
+
+    list.Clear();
+    EXPECT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), 400, 0, 0), 5u);
+
+    // Faded out and dropped once their lifetime is over
+    list.Clear();
+    EXPECT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), DamageNumberRenderer::Lifetime + 100, 0, 0), 2u);
+    EXPECT_EQ(renderer.GetCount(), 1u);
+    EXPECT_LT(list.GetColor(0) >> 24, 255u);
+
+    list.Clear();
+    EXPECT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), DamageNumberRenderer::Lifetime + 300, 0, 0), 0u);
+    EXPECT_EQ(renderer.GetCount(), 0u);
+}
+
+TEST(DamageNumberTest, ScreenOfNumbersIsOneBatch)
+{
+    auto renderer = MakeRenderer();
+    std::size_t nDigit = 0;
+    for (std::int32_t i = 0; i < 300; ++i)
+    {
+        const auto nValue = 1 + i * 7919;
+        renderer.Add(nValue, i % 2 ? DamageStyle::Critical : DamageStyle::Normal,
+                     (i * 37) % 700, (i * 53) % 500, -(i % 400));
+        nDigit += std::to_string(nValue).size() + (i % 2 ? 1 : 0);
+    }
+
+    WzGr2DRenderList list;
+    EXPECT_EQ(renderer.AppendGlyphs(list, fakeTexture(1), 0, 200, 100), nDigit);
+    list.Cull(10000.0F, 10000.0F);
+    ASSERT_EQ(list.GetBatches().size(), 1u);
+    EXPECT_EQ(list.GetBatches()[0].nCount, nDigit);
+    EXPECT_EQ(list.GetVertices().size(), nDigit * 4);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "physics/FootholdColumnIndex.h"
+#include "field/foothold/StaticFoothold.h"
+
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+struct FootholdSet
+{
+    std::vector<std::shared_ptr<StaticFoothold>> aOwner;
+    std::vector<StaticFoothold*> apFoothold;
+
+    void Add(std::int32_t x1, std::int32_t y1, std::int32_t x2, std::int32_t y2)
+    {
+        const auto sn = static_cast<std::uint32_t>(aOwner.size() + 1);
+        aOwner.push_back(std::make_shared<StaticFoothold>(
+            sn, x1, y1, x2, y2, 0, 0, 0, 0, std::make_shared<CAttrFoothold>()));
+        apFoothold.push_back(aOwner.back().get());
+    }
+};
+
+/// Platforms and slopes spread over a wide map, plus a few walls
+auto MakeMap(std::size_t count, std::uint32_t seed) -> FootholdSet
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::int32_t> x(-3000, 3000);
+    std::uniform_int_distribution<std::int32_t> y(-1500, 1500);
+    std::uniform_int_distribution<std::int32_t> len(10, 900);
+    std::uniform_int_distribution<std::int32_t> slope(-300, 300);
+    std::uniform_int_distribution<int> kind(0, 9);
+
+    FootholdSet set;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto x1 = x(rng);
+        const auto y1 = y(rng);
+        switch (kind(rng))
+        {
+        case 0: // Wall
+            set.Add(x1, y1, x1, y1 + len(rng));
+            break;
+        case 1: // Right to left (ceiling side)
+            set.Add(x1 + len(rng), y1, x1, y1 + slope(rng));
+            break;
+        default:
+            set.Add(x1, y1, x1 + len(rng), y1 + slope(rng));
+            break;
+        }
+    }
+    return set;
+}
+
+/// The linear scan WvsPhysicalSpace2D::GetFootholdUnderneath narrows down with its R-tree
+auto BruteForce(const FootholdSet& set, std::int32_t x, std::int32_t y, std::int32_t yMin)
+    -> std::int32_t
+{
+    for (const auto* pfh : set.apFoothold)
+    {
+        if (pfh->IsOff() || pfh->GetX1() >= pfh->GetX2())
+            continue;
+        if (pfh->GetX1() > x || pfh->GetX2() < x)
+            continue;
+
+        const auto yAtX = (pfh->GetY2() - pfh->GetY1()) * (x - pfh->GetX1())
+                          / (pfh->GetX2() - pfh->GetX1())
+                          + pfh->GetY1();
+        if (yAtX >= y && yAtX < yMin)
+            yMin = yAtX;
+    }
+    return yMin;
+}
+
+auto GetYAt(const StaticFoothold& fh, std::int32_t x) -> std::int32_t
+{
+    return (fh.GetY2() - fh.GetY1()) * (x - fh.GetX1()) / (fh.GetX2() - fh.GetX1()) + fh.GetY1();
+}
+
+} // namespace
+
+TEST(FootholdColumnIndexTest, EmptyIndexFindsNothing)
+{
+    FootholdColumnIndex index;
+    index.Build({});
+
+    std::int32_t cy = 0;
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_EQ(index.FindUnderneath(0, 0, INT_MAX, cy), nullptr);
+    EXPECT_EQ(cy, INT_MAX);
+}
+
+TEST(FootholdColumnIndexTest, WallsAreNotIndexed)
+{
+    FootholdSet set;
+    set.Add(100, 0, 100, 500);
+    set.Add(200, 0, 150, 0);
+
+    FootholdColumnIndex index;
+    index.Build(set.apFoothold);
+    EXPECT_TRUE(index.IsEmpty());
+}
+
+TEST(FootholdColumnIndexTest, PicksClosestFloorBelow)
+{
+    FootholdSet set;
+    set.Add(0, 100, 1000, 100);
+    set.Add(0, 300, 1000, 300);
+    set.Add(0, -50, 1000, -50);
+
+    FootholdColumnIndex index;
+    index.Build(set.apFoothold);
+
+    std::int32_t cy = 0;
+    EXPECT_EQ(index.FindUnderneath(500, 0, INT_MAX, cy), set.apFoothold[0]);
+    EXPECT_EQ(cy, 100);
+
+    // Standing exactly on a floor counts as underneath
+    EXPECT_EQ(index.FindUnderneath(500, 100, INT_MAX, cy), set.apFoothold[0]);
+    EXPECT_EQ(cy, 100);
+
+    EXPECT_EQ(index.FindUnderneath(500, 101, INT_MAX, cy), set.apFoothold[1]);
+    EXPECT_EQ(cy, 300);
+
+    // yMin is exclusive
+    EXPECT_EQ(index.FindUnderneath(500, 101, 300, cy), nullptr);
+    EXPECT_EQ(cy, 300);
+
+    EXPECT_EQ(index.FindUnderneath(500, 301, INT_MAX, cy), nullptr);
+}
+
+TEST(FootholdColumnIndexTest, OutsideTheMap)
+{
+    FootholdSet set;
+    set.Add(0, 100, 1000, 100);
+
+    FootholdColumnIndex index;
+    index.Build(set.apFoothold);
+
+    std::int32_t cy = 0;
+    EXPECT_EQ(index.FindUnderneath(-1, 0, INT_MAX, cy), nullptr);
+    EXPECT_EQ(index.FindUnderneath(1001, 0, INT_MAX, cy), nullptr);
+    EXPECT_EQ(index.FindUnderneath(INT_MIN, 0, INT_MAX, cy), nullptr);
+    EXPECT_EQ(index.FindUnderneath(INT_MAX, 0, INT_MAX, cy), nullptr);
+
+    // Both ends are inclusive
+    EXPECT_EQ(index.FindUnderneath(0, 0, INT_MAX, cy), set.apFoothold[0]);
+    EXPECT_EQ(index.FindUnderneath(1000, 0, INT_MAX, cy), set.apFoothold[0]);
+}
+
+TEST(FootholdColumnIndexTest, SlopeAcrossColumnBoundaries)
+{
+    FootholdSet set;
+    set.Add(-450, 0, 1350, -600);
+
+    FootholdColumnIndex index;
+    index.Build(set.apFoothold);
+
+    for (std::int32_t x = -450; x <= 1350; ++x)
+    {
+        std::int32_t cy = 0;
+        ASSERT_EQ(index.FindUnderneath(x, -1000, INT_MAX, cy), set.apFoothold[0]) << "x=" << x;
+        ASSERT_EQ(cy, GetYAt(*set.apFoothold[0], x)) << "x=" << x;
+    }
+}
+
+TEST(FootholdColumnIndexTest, MatchesBruteForce)
+{
+    const auto set = MakeMap(3000, 42);
+    FootholdColumnIndex index;
+    index.Build(set.apFoothold);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<std::int32_t> x(-3200, 4200);
+    std::uniform_int_distribution<std::int32_t> y(-1900, 1900);
+    std::uniform_int_distribution<std::int32_t> reach(0, 2000);
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        const auto px = x(rng);
+        const auto py = y(rng);
+        const auto yMin = i % 2 ? INT_MAX : py + reach(rng);
+
+        std::int32_t cy = 0;
+        const auto* pfh = index.FindUnderneath(px, py, yMin, cy);
+
+        ASSERT_EQ(cy, BruteForce(set, px, py, yMin)) << "x=" << px << " y=" << py;
+        if (pfh)
+            ASSERT_EQ(GetYAt(*pfh, px), cy);
+        else
+            ASSERT_EQ(cy, yMin);
+    }
+}
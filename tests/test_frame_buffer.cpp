@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DFrame.h"
+#include "graphics/WzGr2DLayer.h"
+#include "wz/WzCanvas.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+using namespace ms;
+
+TEST(FrameBufferTest, NothingToAcquireBeforePublish)
+{
+    WzGr2DFrameBuffer buffer;
+    EXPECT_EQ(buffer.AcquireLatest(), nullptr);
+}
+
+TEST(FrameBufferTest, AcquireReturnsPublishedFrameOnce)
+{
+    WzGr2DFrameBuffer buffer;
+    buffer.BeginWrite().nSerial = 1;
+    buffer.Publish();
+
+    const auto* frame = buffer.AcquireLatest();
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->nSerial, 1);
+    EXPECT_EQ(buffer.AcquireLatest(), nullptr);
+}
+
+TEST(FrameBufferTest, NewerFrameReplacesUnconsumedOne)
+{
+    WzGr2DFrameBuffer buffer;
+    for (std::uint64_t serial = 1; serial <= 3; ++serial)
+    {
+        buffer.BeginWrite().nSerial = serial;
+        buffer.Publish();
+    }
+
+    const auto* frame = buffer.AcquireLatest();
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->nSerial, 3);
+}
+
+TEST(FrameBufferTest, ProducerNeverWritesTheAcquiredFrame)
+{
+    WzGr2DFrameBuffer buffer;
+    buffer.BeginWrite().nSerial = 1;
+    buffer.Publish();
+    const auto* held = buffer.AcquireLatest();
+    ASSERT_NE(held, nullptr);
+
+    for (std::uint64_t serial = 2; serial <= 10; ++serial)
+    {
+        auto& slot = buffer.BeginWrite();
+        EXPECT_NE(&slot, held);
+        slot.nSerial = serial;
+        buffer.Publish();
+    }
+
+    EXPECT_EQ(held->nSerial, 1);
+}
+
+TEST(FrameBufferTest, ConsumerSeesWholeFramesInOrder)
+{
+    WzGr2DFrameBuffer buffer;
+    constexpr std::uint64_t FrameCount = 20000;
+    std::atomic<bool> bDone{false};
+
+    std::thread producer([&]
+    {
+        for (std::uint64_t serial = 1; serial <= FrameCount; ++serial)
+        {
+            auto& frame = buffer.BeginWrite();
+            frame.nSerial = serial;
+            frame.tCur = static_cast<std::int32_t>(serial * 2);
+            buffer.Publish();
+        }
+        bDone = true;
+    });
+
+    std::uint64_t last = 0;
+    for (;;)
+    {
+        const bool bFinal = bDone;
+        if (const auto* frame = buffer.AcquireLatest())
+        {
+            ASSERT_GT(frame->nSerial, last);
+            ASSERT_EQ(frame->tCur, static_cast<std::int32_t>(frame->nSerial * 2));
+            last = frame->nSerial;
+        }
+        else if (bFinal)
+        {
+            break;
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(last, FrameCount);
+}
+
+// The threaded build collects with no renderer (WzGr2D::PublishFrame)
+TEST(ThreadedFrameTest, LayersCollectWithoutARenderer)
+{
+    auto* fakeTexture = reinterpret_cast<SDL_Texture*>(std::uintptr_t{0x10});
+    auto pCanvas = std::make_shared<WzGr2DCanvas>(fakeTexture, 16, 8);
+
+    WzGr2DLayer layer(10, 20, 16, 8, 0);
+    layer.InsertCanvas(pCanvas, 100, 255, 255);
+
+    WzGr2DFrame frame;
+    layer.CollectRenderItems(frame.renderList, nullptr, 0, 0, 800, 600);
+    ASSERT_EQ(frame.renderList.GetCount(), 1u);
+    EXPECT_EQ(frame.renderList.GetTexture(0), fakeTexture);
+    EXPECT_FLOAT_EQ(frame.renderList.GetBounds(0).x, 10.0F);
+    EXPECT_FLOAT_EQ(frame.renderList.GetBounds(0).y, 20.0F);
+
+    // Not a real texture; keep the canvas from destroying it
+    EXPECT_EQ(pCanvas->DetachTexture(), fakeTexture);
+}
+
+TEST(ThreadedFrameTest, MissingTextureIsRequestedFromTheRenderThread)
+{
+    auto& gr = get_gr();
+    gr.SetThreadedRender(true);
+    {
+        std::vector<std::uint8_t> aPixel(8 * 8 * 4, 0xFF);
+        auto pCanvas = std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(8, 8, std::move(aPixel)));
+        WzGr2DLayer layer(0, 0, 8, 8, 0);
+        layer.InsertCanvas(pCanvas, 100, 255, 255);
+
+        WzGr2DFrame frame;
+        layer.CollectRenderItems(frame.renderList, nullptr, 0, 0, 800, 600);
+        EXPECT_EQ(frame.renderList.GetCount(), 0u);
+        EXPECT_EQ(gr.GetTextureRequestCount(), 1u);
+
+        // Asked once, not every frame
+        layer.CollectRenderItems(frame.renderList, nullptr, 0, 0, 800, 600);
+        EXPECT_EQ(gr.GetTextureRequestCount(), 1u);
+    }
+    EXPECT_EQ(gr.GetTextureRequestCount(), 0u);
+    gr.SetThreadedRender(false);
+}
@@ -0,0 +1,312 @@
+#include <gtest/gtest.h>
+
+#include "graphics/Gr2DEasing.h"
+#include "graphics/Gr2DVector.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+/// EasingNode::evaluatePos as it was before the kernels (per-period loop, doubles)
+struct ReferenceEase
+{
+    std::int32_t accum_x = 0, accum_y = 0;
+    std::int32_t dx = 0, dy = 0;
+    std::int32_t startTime = 0, endTime = 0;
+    bool bounce = false;
+    bool pingpong = false;
+    std::int32_t looseLevel = 0;
+    std::int32_t looseTimer = 0;
+
+    auto evaluatePos(std::int32_t& x, std::int32_t& y, std::int32_t frame, bool commit) -> int
+    {
+        std::int32_t ax = accum_x, ay = accum_y;
+        std::int32_t st = startTime, et = endTime;
+        std::int32_t curDx = dx, curDy = dy;
+
+        if (et - st <= 0)
+        {
+            x += curDx;
+            y += curDy;
+            return 1;
+        }
+
+        std::int32_t loose = 0;
+        if (frame >= et)
+        {
+            if (!bounce)
+            {
+                x += curDx;
+                y += curDy;
+                return 1;
+            }
+
+            if (pingpong)
+            {
+                do
+                {
+                    ax = ax != 0 ? 0 : curDx;
+                    ay = ay != 0 ? 0 : curDy;
+                    std::int32_t period = et - st;
+                    curDx = -curDx;
+                    curDy = -curDy;
+                    st = et;
+                    et += period;
+                } while (frame >= et);
+
+                if (commit)
+                {
+                    dx = curDx;
+                    dy = curDy;
+                }
+            }
+            else
+            {
+                do
+                {
+                    ax += curDx;
+                    ay += curDy;
+                    std::int32_t period = et - st;
+                    st = et;
+                    et += period;
+                } while (frame >= et);
+            }
+        }
+
+        if (frame > st)
+        {
+            x += ax;
+            y += ay;
+            double progress = static_cast<double>(frame - st);
+            double total = static_cast<double>(et - st);
+            x += static_cast<std::int32_t>(static_cast<double>(curDx) * progress / total);
+            y += static_cast<std::int32_t>(static_cast<double>(curDy) * progress / total);
+
+            if (commit)
+            {
+                if (frame - looseTimer >= 30)
+                {
+                    loose = looseLevel;
+                    looseTimer = frame;
+                }
+                startTime = st;
+                endTime = et - loose;
+                accum_x = ax;
+                accum_y = ay;
+            }
+        }
+        return 0;
+    }
+};
+
+/// RotateNode::evaluateAngle as it was before the kernels
+auto ReferenceTurn(const RotateNode& n, double& angle, std::int32_t frame) -> int
+{
+    if (std::fabs(n.totalAngle) < 1.0e-10)
+    {
+        if (n.period == 0) return 1;
+
+        std::int32_t elapsed = frame - n.startTime;
+        double pd = static_cast<double>(n.period);
+        if (n.easeFrames > 0 && elapsed < n.easeFrames)
+        {
+            angle += 360.0 / pd / static_cast<double>(n.easeFrames)
+                   * static_cast<double>(elapsed) * static_cast<double>(elapsed) * 0.5;
+            return 0;
+        }
+
+        double cyclePos;
+        if (n.easeFrames > 0)
+            cyclePos = static_cast<double>(elapsed % n.period - n.easeFrames / 2) * 360.0;
+        else
+            cyclePos = static_cast<double>(elapsed % n.period) * 360.0;
+        angle += cyclePos / pd;
+        return 0;
+    }
+
+    if (frame >= n.period)
+    {
+        angle += n.totalAngle;
+        return 1;
+    }
+
+    std::int32_t elapsed = frame - n.startTime;
+    std::int32_t dur = n.period - n.startTime;
+    if (n.easeFrames == 0)
+    {
+        angle += n.totalAngle * static_cast<double>(elapsed) / static_cast<double>(dur);
+        return 0;
+    }
+
+    std::int32_t coastDur = dur - 2 * n.easeFrames;
+    double ease_d = static_cast<double>(n.easeFrames);
+    double rate = n.totalAngle / static_cast<double>(coastDur + n.easeFrames);
+    if (elapsed < n.easeFrames)
+    {
+        angle += rate / ease_d * static_cast<double>(elapsed) * static_cast<double>(elapsed) * 0.5;
+    }
+    else if (elapsed < coastDur + n.easeFrames)
+    {
+        angle += rate * static_cast<double>(elapsed - n.easeFrames) + ease_d * rate * 0.5;
+    }
+    else
+    {
+        double t = static_cast<double>(elapsed - coastDur - n.easeFrames);
+        angle += (-rate / ease_d * t + 2.0 * rate) * t * 0.5
+               + static_cast<double>(coastDur) * rate + ease_d * rate * 0.5;
+    }
+    return 0;
+}
+
+void Copy(const ReferenceEase& from, EasingNode& to)
+{
+    to.accum_x = from.accum_x;
+    to.accum_y = from.accum_y;
+    to.dx = from.dx;
+    to.dy = from.dy;
+    to.startTime = from.startTime;
+    to.endTime = from.endTime;
+    to.bounce = from.bounce;
+    to.pingpong = from.pingpong;
+    to.looseLevel = from.looseLevel;
+    to.looseTimer = from.looseTimer;
+    to.UpdateMode();
+}
+
+auto RandomEase(std::mt19937& rng) -> ReferenceEase
+{
+    auto In = [&rng](std::int32_t lo, std::int32_t hi)
+    {
+        return std::uniform_int_distribution<std::int32_t>(lo, hi)(rng);
+    };
+
+    ReferenceEase ref;
+    ref.dx = In(-2000, 2000);
+    ref.dy = In(0, 3) == 0 ? 0 : In(-2000, 2000);
+    ref.startTime = In(0, 1000);
+    ref.endTime = ref.startTime + (In(0, 9) == 0 ? In(-20, 0) : In(10, 1500));
+    ref.bounce = In(0, 2) != 0;
+    ref.pingpong = In(0, 1) != 0;
+    ref.looseLevel = In(0, 2) == 0 ? In(1, 40) : 0;
+    ref.looseTimer = ref.startTime;
+    return ref;
+}
+
+} // namespace
+
+TEST(Gr2DEasingTest, EaseMatchesReference)
+{
+    std::mt19937 rng(1234);
+    for (int nCase = 0; nCase < 2000; ++nCase)
+    {
+        ReferenceEase ref = RandomEase(rng);
+        EasingNode node;
+        Copy(ref, node);
+
+        std::int32_t frame = std::uniform_int_distribution<std::int32_t>(-100, 500)(rng);
+        for (int nStep = 0; nStep < 50; ++nStep)
+        {
+            const bool commit = std::uniform_int_distribution<int>(0, 3)(rng) != 0;
+            std::int32_t rx = 7, ry = -3;
+            std::int32_t nx = 7, ny = -3;
+            const int refRet = ref.evaluatePos(rx, ry, frame, commit);
+            const int ret = node.evaluatePos(nx, ny, frame, commit);
+
+            ASSERT_EQ(ret, refRet) << "case " << nCase << " step " << nStep;
+            ASSERT_EQ(nx, rx) << "case " << nCase << " step " << nStep;
+            ASSERT_EQ(ny, ry) << "case " << nCase << " step " << nStep;
+            ASSERT_EQ(node.startTime, ref.startTime);
+            ASSERT_EQ(node.endTime, ref.endTime);
+            ASSERT_EQ(node.accum_x, ref.accum_x);
+            ASSERT_EQ(node.accum_y, ref.accum_y);
+            ASSERT_EQ(node.dx, ref.dx);
+            ASSERT_EQ(node.dy, ref.dy);
+            ASSERT_EQ(node.looseTimer, ref.looseTimer);
+            if (ret == 1)
+                break;
+
+            // Mostly frame-sized steps, sometimes a long unevaluated gap
+            frame += std::uniform_int_distribution<int>(0, 9)(rng) == 0
+                ? std::uniform_int_distribution<std::int32_t>(1000, 100000)(rng)
+                : std::uniform_int_distribution<std::int32_t>(0, 40)(rng);
+        }
+    }
+}
+
+TEST(Gr2DEasingTest, TurnMatchesReference)
+{
+    std::mt19937 rng(99);
+    auto In = [&rng](std::int32_t lo, std::int32_t hi)
+    {
+        return std::uniform_int_distribution<std::int32_t>(lo, hi)(rng);
+    };
+
+    for (int nCase = 0; nCase < 2000; ++nCase)
+    {
+        RotateNode node;
+        node.startTime = In(0, 1000);
+        if (In(0, 1) == 0)
+        {
+            node.totalAngle = 0.0;
+            node.period = In(0, 5) == 0 ? 0 : In(1, 3000);
+            node.easeFrames = In(0, 1) == 0 ? 0 : In(-10, 500);
+        }
+        else
+        {
+            node.totalAngle = std::uniform_real_distribution<double>(-720.0, 720.0)(rng);
+            const auto dur = In(10, 3000);
+            node.period = node.startTime + dur;
+            node.easeFrames = In(0, 1) == 0 ? 0 : In(1, (dur - 1) / 2);
+        }
+        node.UpdateMode();
+
+        for (std::int32_t frame = node.startTime; frame < node.startTime + 4000; frame += In(1, 97))
+        {
+            double refAngle = 12.5;
+            double angle = 12.5;
+            const int refRet = ReferenceTurn(node, refAngle, frame);
+            const int ret = node.evaluateAngle(angle, frame, true);
+            ASSERT_EQ(ret, refRet) << "case " << nCase << " frame " << frame;
+            ASSERT_EQ(angle, refAngle) << "case " << nCase << " frame " << frame;
+        }
+    }
+}
+
+TEST(Gr2DEasingTest, NodesKeepTheModeOfTheirParameters)
+{
+    EasingNode ease;
+    EXPECT_EQ(ease.mode, Gr2DEasing::EaseMode::Once);
+    ease.bounce = true;
+    ease.pingpong = true;
+    ease.UpdateMode();
+    EXPECT_EQ(ease.mode, Gr2DEasing::EaseMode::PingPong);
+
+    RotateNode turn;
+    EXPECT_EQ(turn.mode, Gr2DEasing::TurnMode::Stopped);
+    turn.totalAngle = 90.0;
+    turn.period = 500;
+    turn.easeFrames = 50;
+    turn.UpdateMode();
+    EXPECT_EQ(turn.mode, Gr2DEasing::TurnMode::Eased);
+}
+
+TEST(Gr2DEasingTest, PingPongAccumFollowsToggle)
+{
+    // Step the client's toggle and compare with the parity closed form
+    for (std::int32_t start : {0, 40, -40})
+    {
+        std::int32_t accum = start;
+        std::int32_t delta = 40;
+        for (int n = 1; n <= 6; ++n)
+        {
+            accum = accum != 0 ? 0 : delta;
+            delta = -delta;
+            EXPECT_EQ(Gr2DEasing::PingPongAccum(start, 40, n), accum) << "start " << start << " n " << n;
+        }
+    }
+}
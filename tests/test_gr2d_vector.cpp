@@ -799,6 +799,61 @@ TEST_F(Gr2DVectorTest, ScaleDivisionByZero)
     EXPECT_EQ(vec.GetY(), 200);
 }
 
+// =============================================================================
+// Node Pool
+// =============================================================================
+
+TEST_F(Gr2DVectorTest, TwoNodesStayInline)
+{
+    Gr2DVector vec(0, 0);
+    vec.RelMove(100, 0, 0, 1000);
+    vec.Rotate(90.0, 1000);
+
+    const auto& pool = vec.Chain()->node_pool;
+    EXPECT_EQ(pool.liveCount(), 2u);
+    EXPECT_EQ(pool.blockCount(), 0u);
+}
+
+TEST_F(Gr2DVectorTest, ExtraNodesShareOneBlock)
+{
+    Gr2DVector vec(0, 0);
+    vec.RelMove(100, 0, 0, 1000);
+    vec.Rotate(90.0, 1000);
+    vec.WrapClip(nullptr, 0, 0, 800, 600, false);
+    vec.RelOffset(0, 50, 0, 1000);
+
+    const auto& pool = vec.Chain()->node_pool;
+    EXPECT_EQ(pool.liveCount(), 4u);
+    EXPECT_EQ(pool.blockCount(), 1u);
+
+    // Reset releases every node; the block is kept for the next tweens
+    vec.Move(0, 0);
+    EXPECT_EQ(pool.liveCount(), 0u);
+
+    for (int i = 0; i < 4; ++i)
+        vec.RelOffset(10, 0, 0, 1000);
+    EXPECT_EQ(pool.liveCount(), 4u);
+    EXPECT_EQ(pool.blockCount(), 1u);
+}
+
+TEST_F(Gr2DVectorTest, FinishedTweensReuseSlots)
+{
+    Gr2DVector vec(0, 0);
+
+    std::int32_t now = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.RelMove(i % 2 ? 0 : 100, 0, now, now + 100);
+        vec.Rotate(45.0, 100);
+        now += 200;
+        Gr2DTime::SetCurrentTime(now);
+        (void)vec.GetX();
+    }
+
+    EXPECT_EQ(vec.GetX(), 0);
+    EXPECT_EQ(vec.Chain()->node_pool.blockCount(), 0u);
+}
+
 // =============================================================================
 // Performance Tests
 // =============================================================================
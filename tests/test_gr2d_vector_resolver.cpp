@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include "graphics/Gr2DVector.h"
+#include "graphics/Gr2DVectorResolver.h"
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DLayer.h"
+#include "util/JobSystem.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+auto IndexOf(const Gr2DVectorResolver& resolver, const Gr2DVector& vec) -> std::ptrdiff_t
+{
+    const auto& aOrder = resolver.GetOrder();
+    return std::find(aOrder.begin(), aOrder.end(), &vec) - aOrder.begin();
+}
+
+// Stands in for VecCtrl: a parent the resolver can't see into
+class OpaqueVector : public Gr2DVector
+{
+public:
+    using Gr2DVector::Gr2DVector;
+    [[nodiscard]] auto GetResolveTarget() -> Gr2DVector* override { return nullptr; }
+};
+
+} // namespace
+
+class Gr2DVectorResolverTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Gr2DTime::SetCurrentTime(0);
+    }
+};
+
+TEST_F(Gr2DVectorResolverTest, OrdersOriginsBeforeDependents)
+{
+    Gr2DVector grandparent(100, 100);
+    Gr2DVector parent(50, 50);
+    Gr2DVector child(25, 25);
+    parent.PutOrigin(&grandparent);
+    child.PutOrigin(&parent);
+
+    Gr2DVectorResolver resolver;
+    resolver.Add(&child);
+    resolver.Add(&grandparent);
+    resolver.Resolve(0);
+
+    ASSERT_EQ(resolver.GetOrder().size(), 3u);
+    EXPECT_LT(IndexOf(resolver, grandparent), IndexOf(resolver, parent));
+    EXPECT_LT(IndexOf(resolver, parent), IndexOf(resolver, child));
+
+    const auto* pChild = resolver.Find(child);
+    ASSERT_NE(pChild, nullptr);
+    EXPECT_EQ(pChild->x, 175);
+    EXPECT_EQ(pChild->y, 175);
+}
+
+TEST_F(Gr2DVectorResolverTest, PullsInRatioAndWrapTargets)
+{
+    Gr2DVector target(10, 10);
+    Gr2DVector bounds(0, 0);
+    Gr2DVector vec(0, 0);
+    vec.Ratio(&target, 1, 1, 1, 1);
+    vec.WrapClip(&bounds, 0, 0, 800, 600, false);
+
+    Gr2DVectorResolver resolver;
+    resolver.Add(&vec);
+    resolver.Resolve(0);
+
+    ASSERT_EQ(resolver.GetOrder().size(), 3u);
+    EXPECT_LT(IndexOf(resolver, target), IndexOf(resolver, vec));
+    EXPECT_LT(IndexOf(resolver, bounds), IndexOf(resolver, vec));
+}
+
+TEST_F(Gr2DVectorResolverTest, MatchesDirectEvaluation)
+{
+    auto Build = [](std::vector<std::unique_ptr<Gr2DVector>>& aVec)
+    {
+        aVec.push_back(std::make_unique<Gr2DVector>(0, 0));
+        aVec[0]->RelMove(400, 200, 0, 1000);
+        aVec[0]->Rotate(90.0, 1000);
+        for (int i = 1; i < 6; ++i)
+        {
+            aVec.push_back(std::make_unique<Gr2DVector>(10 * i, -5 * i));
+            aVec.back()->PutOrigin(aVec[static_cast<std::size_t>(i - 1)].get());
+        }
+    };
+
+    std::vector<std::unique_ptr<Gr2DVector>> aResolved;
+    std::vector<std::unique_ptr<Gr2DVector>> aDirect;
+    Build(aResolved);
+    Build(aDirect);
+
+    Gr2DVectorResolver resolver;
+    for (auto& vec : aResolved)
+        resolver.Add(vec.get());
+
+    for (std::int32_t t = 0; t <= 1200; t += 100)
+    {
+        resolver.Resolve(t);
+        for (std::size_t i = 0; i < aDirect.size(); ++i)
+        {
+            const auto* pResolved = resolver.Find(*aResolved[i]);
+            ASSERT_NE(pResolved, nullptr);
+            EXPECT_EQ(pResolved->x, aDirect[i]->GetX()) << "t=" << t << " i=" << i;
+            EXPECT_EQ(pResolved->y, aDirect[i]->GetY()) << "t=" << t << " i=" << i;
+            EXPECT_DOUBLE_EQ(pResolved->a, aDirect[i]->GetA()) << "t=" << t << " i=" << i;
+        }
+    }
+}
+
+TEST_F(Gr2DVectorResolverTest, FindOnlyCoversLatestPass)
+{
+    Gr2DVector a(1, 2);
+    Gr2DVector b(3, 4);
+
+    Gr2DVectorResolver resolver;
+    EXPECT_EQ(resolver.Find(a), nullptr);
+
+    resolver.Add(&a);
+    resolver.Resolve(0);
+    EXPECT_NE(resolver.Find(a), nullptr);
+    EXPECT_EQ(resolver.Find(b), nullptr);
+
+    resolver.Clear();
+    resolver.Add(&b);
+    resolver.Resolve(16);
+    EXPECT_EQ(resolver.Find(a), nullptr);
+    ASSERT_NE(resolver.Find(b), nullptr);
+    EXPECT_EQ(resolver.Find(b)->x, 3);
+}
+
+TEST_F(Gr2DVectorResolverTest, OpaqueParentsMarkDependentsIncomplete)
+{
+    OpaqueVector ctrl(0, 0);
+    Gr2DVector viaCtrl(0, 0);
+    Gr2DVector child(5, 5);
+    Gr2DVector plain(1, 1);
+    viaCtrl.PutOrigin(&ctrl);
+    child.PutOrigin(&viaCtrl);
+
+    Gr2DVectorResolver resolver;
+    resolver.Add(&child);
+    resolver.Add(&plain);
+    resolver.Resolve(0);
+
+    EXPECT_FALSE(resolver.IsComplete(viaCtrl));
+    EXPECT_FALSE(resolver.IsComplete(child));
+    EXPECT_TRUE(resolver.IsComplete(plain));
+}
+
+TEST_F(Gr2DVectorResolverTest, WalksAlphaAndColourVectors)
+{
+    auto layer = get_gr().CreateLayer(0, 0, 8, 8, 0);
+    Gr2DVector fade(0, 0);
+    layer->get_alpha()->Ratio(&fade, 1, 1, 1, 1);
+
+    Gr2DVectorResolver resolver;
+    layer->AddVectors(resolver);
+    resolver.Resolve(0);
+
+    EXPECT_NE(resolver.Find(*layer->get_alpha()), nullptr);
+    EXPECT_NE(resolver.Find(*layer->get_redTone()), nullptr);
+    EXPECT_NE(resolver.Find(*layer->get_greenBlueTone()), nullptr);
+    EXPECT_NE(resolver.Find(fade), nullptr);
+
+    get_gr().RemoveLayer(layer);
+}
+
+// Mirrors WzGr2D::UpdateLayers: one pass, then Update() on the job pool
+TEST_F(Gr2DVectorResolverTest, LayersSharingAParentChainUpdateConcurrently)
+{
+    Gr2DVector root(0, 0);
+    root.RelMove(1000, 500, 0, 1000);
+    Gr2DVector mid(10, 20);
+    mid.PutOrigin(&root);
+
+    OpaqueVector ctrl(0, 0);
+    std::vector<std::shared_ptr<WzGr2DLayer>> aLayer;
+    for (int i = 0; i < 512; ++i)
+    {
+        auto layer = get_gr().CreateLayer(0, 0, 8, 8, 0);
+        layer->Move(i, 0);
+        layer->PutOrigin(i % 64 == 0 ? static_cast<IWzVector2D*>(&ctrl) : &mid);
+        aLayer.push_back(std::move(layer));
+    }
+
+    Gr2DVectorResolver resolver;
+    for (auto& layer : aLayer)
+        layer->AddVectors(resolver);
+
+    for (std::int32_t t = 0; t <= 1000; t += 250)
+    {
+        resolver.Resolve(t);
+
+        std::vector<WzGr2DLayer*> aParallel;
+        for (auto& layer : aLayer)
+        {
+            if (layer->PrepareUpdate(resolver))
+                aParallel.push_back(layer.get());
+            else
+                layer->Update(t);
+        }
+        ASSERT_EQ(aParallel.size(), aLayer.size() - aLayer.size() / 64);
+
+        JobSystem::GetInstance().ParallelFor(aParallel.size(), 16,
+            [&aParallel, t](std::size_t begin, std::size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                    aParallel[i]->Update(t);
+            });
+
+        const auto midX = mid.GetX();
+        for (std::size_t i = 0; i < aLayer.size(); ++i)
+        {
+            if (i % 64 != 0)
+            {
+                ASSERT_EQ(aLayer[i]->GetLeft(), midX + static_cast<std::int32_t>(i)) << "t=" << t;
+            }
+        }
+    }
+
+    for (auto& layer : aLayer)
+        get_gr().RemoveLayer(layer);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "util/JobSystem.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace ms;
+
+TEST(JobSystemTest, ParallelForVisitsEveryIndexOnce)
+{
+    constexpr std::size_t Count = 10000;
+    std::vector<std::atomic<int>> hits(Count);
+
+    JobSystem::GetInstance().ParallelFor(Count, 37,
+        [&hits](std::size_t begin, std::size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+}
+
+TEST(JobSystemTest, ChunksRespectGrain)
+{
+    std::atomic<std::size_t> maxChunk{0};
+    std::atomic<std::size_t> total{0};
+
+    JobSystem::GetInstance().ParallelFor(1000, 64,
+        [&](std::size_t begin, std::size_t end)
+        {
+            auto size = end - begin;
+            auto prev = maxChunk.load();
+            while (size > prev && !maxChunk.compare_exchange_weak(prev, size)) {}
+            total.fetch_add(size);
+        });
+
+    EXPECT_LE(maxChunk.load(), 64u);
+    EXPECT_EQ(total.load(), 1000u);
+}
+
+TEST(JobSystemTest, EmptyRangeDoesNothing)
+{
+    bool called = false;
+    JobSystem::GetInstance().ParallelFor(0, 16,
+        [&called](std::size_t, std::size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
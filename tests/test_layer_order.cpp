@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DLayer.h"
+
+#include <vector>
+
+using namespace ms;
+
+class LayerOrderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        get_gr().RemoveAllLayers();
+    }
+
+    void TearDown() override
+    {
+        get_gr().RemoveAllLayers();
+    }
+
+    static auto renderOrder() -> std::vector<WzGr2DLayer*>
+    {
+        std::vector<WzGr2DLayer*> order;
+        for (const auto& [key, layer] : get_gr().GetLayerList())
+        {
+            order.push_back(layer.get());
+        }
+        return order;
+    }
+};
+
+TEST_F(LayerOrderTest, OrderedByZ)
+{
+    auto& gr = get_gr();
+    auto a = gr.CreateLayer(0, 0, 10, 10, 5);
+    auto b = gr.CreateLayer(0, 0, 10, 10, -3);
+    auto c = gr.CreateLayer(0, 0, 10, 10, 0);
+
+    auto order = renderOrder();
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order[0], b.get());
+    EXPECT_EQ(order[1], c.get());
+    EXPECT_EQ(order[2], a.get());
+}
+
+TEST_F(LayerOrderTest, EqualZKeepsCreationOrder)
+{
+    auto& gr = get_gr();
+    auto a = gr.CreateLayer(0, 0, 10, 10, 1);
+    auto b = gr.CreateLayer(0, 0, 10, 10, 1);
+    auto c = gr.CreateLayer(0, 0, 10, 10, 0);
+    auto d = gr.CreateLayer(0, 0, 10, 10, 1);
+
+    auto order = renderOrder();
+    ASSERT_EQ(order.size(), 4);
+    EXPECT_EQ(order[0], c.get());
+    EXPECT_EQ(order[1], a.get());
+    EXPECT_EQ(order[2], b.get());
+    EXPECT_EQ(order[3], d.get());
+}
+
+TEST_F(LayerOrderTest, RemoveLayer)
+{
+    auto& gr = get_gr();
+    auto a = gr.CreateLayer(0, 0, 10, 10, 1);
+    auto b = gr.CreateLayer(0, 0, 10, 10, 2);
+
+    gr.RemoveLayer(a);
+    EXPECT_EQ(gr.GetLayerCount(), 1);
+    EXPECT_EQ(renderOrder()[0], b.get());
+
+    // Removing an unknown layer is a no-op
+    gr.RemoveLayer(a);
+    gr.RemoveLayer(std::make_shared<WzGr2DLayer>());
+    EXPECT_EQ(gr.GetLayerCount(), 1);
+}
+
+TEST_F(LayerOrderTest, RefreshLayerZMatchesStableSort)
+{
+    auto& gr = get_gr();
+    auto a = gr.CreateLayer(0, 0, 10, 10, 0);
+    auto b = gr.CreateLayer(0, 0, 10, 10, 0);
+    auto c = gr.CreateLayer(0, 0, 10, 10, 5);
+
+    // Moving the first layer into c's band keeps it ahead of c (created earlier)
+    a->put_z(5);
+    gr.RefreshLayerZ(a);
+
+    auto order = renderOrder();
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order[0], b.get());
+    EXPECT_EQ(order[1], a.get());
+    EXPECT_EQ(order[2], c.get());
+
+    // Removal still finds the layer under its new key
+    gr.RemoveLayer(a);
+    EXPECT_EQ(gr.GetLayerCount(), 2);
+}
+
+TEST_F(LayerOrderTest, ChurnKeepsOrder)
+{
+    auto& gr = get_gr();
+    std::vector<std::shared_ptr<WzGr2DLayer>> live;
+    for (std::int32_t i = 0; i < 10000; ++i)
+    {
+        live.push_back(gr.CreateLayer(0, 0, 1, 1, (i * 7919) % 257));
+    }
+
+    for (std::int32_t frame = 0; frame < 10; ++frame)
+    {
+        for (std::int32_t i = 0; i < 100; ++i)
+        {
+            auto idx = static_cast<std::size_t>((frame * 100 + i) * 31 % 10000);
+            gr.RemoveLayer(live[idx]);
+            live[idx] = gr.CreateLayer(0, 0, 1, 1, (frame + i) % 257);
+        }
+    }
+
+    EXPECT_EQ(gr.GetLayerCount(), 10000);
+
+    std::int32_t prevZ = INT32_MIN;
+    for (const auto& [key, layer] : gr.GetLayerList())
+    {
+        EXPECT_LE(prevZ, layer->GetZ());
+        prevZ = layer->GetZ();
+    }
+}
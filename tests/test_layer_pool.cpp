@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2D.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DLayer.h"
+#include "graphics/WzGr2DLayerPool.h"
+#include "wz/WzCanvas.h"
+
+#include <memory>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+auto MakeCanvas() -> std::shared_ptr<WzGr2DCanvas>
+{
+    return std::make_shared<WzGr2DCanvas>(std::make_shared<WzCanvas>(4, 4));
+}
+
+} // namespace
+
+TEST(LayerPoolTest, RecycledLayerLooksNew)
+{
+    WzGr2DLayerPool pool;
+
+    auto pLayer = pool.Acquire(0, 0, 0, 0, 0);
+    std::weak_ptr<WzGr2DCanvas> pCanvas = MakeCanvas();
+    pLayer->InsertCanvas(pCanvas.lock(), 50);
+    pLayer->InsertCanvas(MakeCanvas(), 50);
+    pLayer->Animate(Gr2DAnimationType::Repeat);
+    pLayer->put_color(0x40102030);
+    pLayer->put_flip(1);
+    pLayer->put_blend(1);
+    pLayer->put_visible(false);
+    pLayer->put_overlay(std::make_shared<WzGr2DLayer>());
+    pLayer->get_lt()->RelMove(30, 40, 0, 1000);
+    auto* pRaw = pLayer.get();
+
+    EXPECT_TRUE(pool.Release(std::move(pLayer)));
+    EXPECT_TRUE(pCanvas.expired()) << "released layers must not pin canvases";
+
+    auto pAgain = pool.Acquire(7, 9, 16, 32, 3);
+    ASSERT_EQ(pAgain.get(), pRaw);
+    EXPECT_EQ(pool.GetAllocCount(), 1u);
+    EXPECT_EQ(pool.GetReuseCount(), 1u);
+
+    const WzGr2DLayer fresh(7, 9, 16, 32, 3);
+    EXPECT_EQ(pAgain->GetCanvasCount(), 0u);
+    EXPECT_FALSE(pAgain->IsAnimating());
+    EXPECT_EQ(pAgain->get_color(), fresh.get_color());
+    EXPECT_EQ(pAgain->get_flip(), 0);
+    EXPECT_EQ(pAgain->get_blend(), 0);
+    EXPECT_TRUE(pAgain->get_visible());
+    EXPECT_EQ(pAgain->get_overlay(), nullptr);
+    EXPECT_EQ(pAgain->get_z(), 3);
+    EXPECT_EQ(pAgain->GetWidth(), 16u);
+    EXPECT_EQ(pAgain->GetHeight(), 32u);
+    EXPECT_EQ(pAgain->GetX(), 7);
+    EXPECT_EQ(pAgain->GetY(), 9);
+
+    // Frames inserted after the reset behave as on a new layer
+    pAgain->InsertCanvas(MakeCanvas(), 10);
+    pAgain->InsertCanvas(MakeCanvas(), 20);
+    EXPECT_EQ(pAgain->GetCanvasCount(), 2u);
+    EXPECT_EQ(pAgain->GetCurrentFrame(), 0u);
+    pAgain->SetCurrentFrame(1);
+    EXPECT_EQ(pAgain->GetCurrentFrame(), 1u);
+}
+
+TEST(LayerPoolTest, SharedLayersAreNotRecycled)
+{
+    WzGr2DLayerPool pool;
+    auto pLayer = pool.Acquire(0, 0, 0, 0, 0);
+    auto pOther = pLayer;
+
+    EXPECT_FALSE(pool.Release(std::move(pLayer)));
+    EXPECT_EQ(pool.GetFreeCount(), 0u);
+    EXPECT_NE(pool.Acquire(0, 0, 0, 0, 0), pOther);
+}
+
+TEST(LayerPoolTest, SteadyStateEffectsAllocateNoLayers)
+{
+    auto& gr = get_gr();
+    gr.RemoveAllLayers();
+    const auto nBaseAlloc = gr.GetLayerPool().GetAllocCount();
+
+    // A burst of up to 40 short-lived effects per tick, each retired a
+    // few ticks later, like hit sparks under a multi-hit skill
+    std::vector<std::shared_ptr<WzGr2DLayer>> apAlive;
+    auto tick = [&](std::int32_t nTick)
+    {
+        const auto nSpawn = 20 + nTick % 21;
+        for (std::int32_t i = 0; i < nSpawn; ++i)
+        {
+            auto pLayer = gr.CreateEffectLayer(i, nTick, 0, 0, i % 5);
+            pLayer->InsertCanvas(MakeCanvas(), 30);
+            pLayer->InsertCanvas(MakeCanvas(), 30);
+            apAlive.push_back(std::move(pLayer));
+        }
+        while (apAlive.size() > 90)
+        {
+            gr.RecycleLayer(std::move(apAlive.front()));
+            apAlive.erase(apAlive.begin());
+        }
+    };
+
+    for (std::int32_t t = 0; t < 50; ++t)
+        tick(t);
+    const auto nWarmAlloc = gr.GetLayerPool().GetAllocCount();
+
+    for (std::int32_t t = 50; t < 2000; ++t)
+        tick(t);
+
+    EXPECT_EQ(gr.GetLayerPool().GetAllocCount(), nWarmAlloc);
+    EXPECT_GT(gr.GetLayerPool().GetReuseCount(), 40000u);
+    EXPECT_LE(nWarmAlloc - nBaseAlloc, 130u);
+    EXPECT_EQ(gr.GetLayerCount(), apAlive.size());
+
+    // Render order still follows z over recycled nodes
+    std::int32_t nPrevZ = -1;
+    for (const auto& [key, pLayer] : gr.GetLayerList())
+    {
+        EXPECT_LE(nPrevZ, key.z);
+        EXPECT_EQ(key.z, pLayer->get_z());
+        nPrevZ = key.z;
+    }
+
+    for (auto& pLayer : apAlive)
+        gr.RecycleLayer(std::move(pLayer));
+    EXPECT_EQ(gr.GetLayerCount(), 0u);
+    gr.RemoveAllLayers();
+}
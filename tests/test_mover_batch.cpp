@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "physics/FootholdColumnIndex.h"
+#include "physics/MoverBatch.h"
+#include "field/foothold/StaticFoothold.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+constexpr double Tick = 0.03;
+
+struct Map
+{
+    std::vector<std::shared_ptr<StaticFoothold>> aOwner;
+    std::vector<StaticFoothold*> apFoothold;
+    FootholdColumnIndex index;
+
+    auto Add(std::int32_t x1, std::int32_t y1, std::int32_t x2, std::int32_t y2) -> StaticFoothold*
+    {
+        const auto sn = static_cast<std::uint32_t>(aOwner.size() + 1);
+        aOwner.push_back(std::make_shared<StaticFoothold>(
+            sn, x1, y1, x2, y2, 0, 0, 0, 0, std::make_shared<CAttrFoothold>()));
+        apFoothold.push_back(aOwner.back().get());
+        return apFoothold.back();
+    }
+
+    static void Link(StaticFoothold* pPrev, StaticFoothold* pNext)
+    {
+        pPrev->SetNextLink(pNext);
+        pNext->SetPrevLink(pPrev);
+    }
+
+    void Build() { index.Build(apFoothold); }
+};
+
+} // namespace
+
+TEST(MoverBatchTest, FallsAndLands)
+{
+    Map map;
+    auto* pfh = map.Add(0, 100, 1000, 100);
+    map.Build();
+
+    MoverBatch batch;
+    batch.Add(500.0, 0.0, 0.0, 0.0, 0, nullptr, {});
+
+    for (int i = 0; i < 100 && !batch.GetFoothold(0); ++i)
+        batch.Step(Tick, map.index);
+
+    EXPECT_EQ(batch.GetFoothold(0), pfh);
+    EXPECT_DOUBLE_EQ(batch.GetY(0), 100.0);
+    EXPECT_DOUBLE_EQ(batch.GetVY(0), 0.0);
+}
+
+TEST(MoverBatchTest, FallSpeedIsCapped)
+{
+    Map map;
+    map.Build();
+
+    MoverBatch batch;
+    batch.Add(0.0, 0.0, 0.0, 0.0, 0, nullptr, {});
+    for (int i = 0; i < 100; ++i)
+        batch.Step(Tick, map.index);
+
+    EXPECT_DOUBLE_EQ(batch.GetVY(0), MoverBatch::FallSpeed);
+}
+
+TEST(MoverBatchTest, WalksAtShoeSpeedAndStops)
+{
+    Map map;
+    auto* pfh = map.Add(-10000, 0, 10000, 0);
+    map.Build();
+
+    MoverBatch::Param param;
+    param.dWalkSpeed = 1.2;
+
+    MoverBatch batch;
+    batch.Add(0.0, 0.0, 0.0, 0.0, 1, pfh, param);
+    for (int i = 0; i < 100; ++i)
+        batch.Step(Tick, map.index);
+
+    EXPECT_DOUBLE_EQ(batch.GetVX(0), MoverBatch::WalkSpeed * 1.2);
+    EXPECT_DOUBLE_EQ(batch.GetY(0), 0.0);
+
+    // Drag brings it back to rest once input is released
+    MoverBatch release;
+    release.Add(batch.GetX(0), 0.0, batch.GetVX(0), 0.0, 0, pfh, param);
+    for (int i = 0; i < 100; ++i)
+        release.Step(Tick, map.index);
+
+    EXPECT_DOUBLE_EQ(release.GetVX(0), 0.0);
+}
+
+TEST(MoverBatchTest, FollowsLinkedSlope)
+{
+    Map map;
+    auto* pFlat = map.Add(0, 100, 300, 100);
+    auto* pSlope = map.Add(300, 100, 600, 40);
+    Map::Link(pFlat, pSlope);
+    map.Build();
+
+    MoverBatch batch;
+    batch.Add(299.0, 100.0, 125.0, 0.0, 1, pFlat, {});
+    batch.Step(Tick, map.index);
+
+    ASSERT_EQ(batch.GetFoothold(0), pSlope);
+    const auto x = batch.GetX(0);
+    EXPECT_GT(x, 300.0);
+    EXPECT_DOUBLE_EQ(batch.GetY(0), 100.0 - 60.0 * (x - 300.0) / 300.0);
+}
+
+TEST(MoverBatchTest, RisingWallBlocks)
+{
+    Map map;
+    auto* pFloor = map.Add(0, 100, 300, 100);
+    auto* pWall = map.Add(300, 100, 300, 0);
+    Map::Link(pFloor, pWall);
+    map.Build();
+
+    MoverBatch batch;
+    batch.Add(299.0, 100.0, 125.0, 0.0, 1, pFloor, {});
+    batch.Step(Tick, map.index);
+
+    EXPECT_EQ(batch.GetFoothold(0), pFloor);
+    EXPECT_DOUBLE_EQ(batch.GetX(0), 300.0);
+    EXPECT_DOUBLE_EQ(batch.GetVX(0), 0.0);
+}
+
+TEST(MoverBatchTest, WalksOffLedge)
+{
+    Map map;
+    auto* pLedge = map.Add(0, 100, 300, 100);
+    auto* pBelow = map.Add(0, 400, 1000, 400);
+    map.Build();
+
+    MoverBatch batch;
+    batch.Add(299.0, 100.0, 125.0, 0.0, 1, pLedge, {});
+    batch.Step(Tick, map.index);
+
+    EXPECT_EQ(batch.GetFoothold(0), nullptr);
+
+    for (int i = 0; i < 100 && !batch.GetFoothold(0); ++i)
+        batch.Step(Tick, map.index);
+
+    EXPECT_EQ(batch.GetFoothold(0), pBelow);
+    EXPECT_DOUBLE_EQ(batch.GetY(0), 400.0);
+}
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2DTypes.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+/// The per-Particle (array of structs) update ParticleEmitter used to run
+struct ReferenceEmitter
+{
+    std::vector<Particle> particles;
+    std::int32_t maxParticles = 0;
+    std::int32_t activeCount = 0;
+    float emitInterval = 0.0F;
+    float frameAccumulator = 0.0F;
+    bool usePhysics = false;
+    bool affectGravity = false;
+    std::int32_t mirrorDirection = 1;
+    float forceXA = 0, forceXB = 0;
+    float forceYA = 0, forceYB = 0;
+    float velocityX = 0, velocityY = 0;
+
+    void update(float dt)
+    {
+        frameAccumulator += dt;
+        while (frameAccumulator >= emitInterval && activeCount < maxParticles)
+        {
+            int slot = -1;
+            for (int i = 0; i < static_cast<int>(particles.size()); ++i)
+            {
+                if (particles[static_cast<std::size_t>(i)].timeRemaining <= 0.0F)
+                {
+                    slot = i;
+                    break;
+                }
+            }
+            if (slot < 0)
+            {
+                particles.emplace_back();
+                slot = static_cast<int>(particles.size()) - 1;
+            }
+
+            auto& p = particles[static_cast<std::size_t>(slot)];
+            p = Particle{};
+            p.baseVelX = velocityX;
+            p.baseVelY = velocityY;
+            p.totalLifetime = 1.0F;
+            p.timeRemaining = p.totalLifetime;
+            p.forceScaleA = 1.0F;
+            p.forceScaleB = 1.0F;
+
+            activeCount++;
+            frameAccumulator -= emitInterval;
+        }
+
+        int newActiveCount = 0;
+        for (auto& p : particles)
+        {
+            if (p.timeRemaining <= 0.0F)
+                continue;
+
+            p.timeRemaining -= dt;
+            if (p.timeRemaining <= 0.0F)
+            {
+                p.timeRemaining = 0.0F;
+                continue;
+            }
+
+            newActiveCount++;
+
+            float progress = 1.0F - p.timeRemaining / p.totalLifetime;
+            p.colorR = p.startR + (p.endR - p.startR) * progress;
+            p.colorG = p.startG + (p.endG - p.startG) * progress;
+            p.colorB = p.startB + (p.endB - p.startB) * progress;
+            p.colorA = p.startA + (p.endA - p.startA) * progress;
+
+            p.sizeCurrent += p.sizeRate * dt;
+            p.rotationRate += p.rotationAccel * dt;
+            p.angularData[0] += p.rotationRate * dt;
+
+            if (usePhysics)
+            {
+                float totalForceX = (forceXA + forceXB) * p.forceScaleA;
+                float totalForceY = (forceYA + forceYB) * p.forceScaleB;
+
+                p.driftX += totalForceX * dt;
+                p.driftY += totalForceY * dt;
+
+                p.posX += (p.baseVelX + p.driftX) * dt;
+                p.posY += (p.baseVelY + p.driftY) * dt * static_cast<float>(mirrorDirection);
+
+                if (affectGravity)
+                    p.baseVelY += 9.8F * dt;
+            }
+            else
+            {
+                p.posX += p.baseVelX * dt;
+                p.posY += p.baseVelY * dt * static_cast<float>(mirrorDirection);
+            }
+        }
+
+        activeCount = newActiveCount;
+    }
+};
+
+void Configure(ParticleEmitter& emitter, ReferenceEmitter& reference, std::int32_t maxParticles,
+               float emitInterval)
+{
+    emitter.maxParticles = reference.maxParticles = maxParticles;
+    emitter.emitInterval = reference.emitInterval = emitInterval;
+    emitter.usePhysics = reference.usePhysics = true;
+    emitter.affectGravity = reference.affectGravity = true;
+    emitter.mirrorDirection = reference.mirrorDirection = -1;
+    emitter.forceXA = reference.forceXA = 3.0F;
+    emitter.forceXB = reference.forceXB = -1.0F;
+    emitter.forceYA = reference.forceYA = 5.0F;
+    emitter.velocityX = reference.velocityX = 40.0F;
+    emitter.velocityY = reference.velocityY = -20.0F;
+}
+
+auto SortedPositions(const ParticleStore& store) -> std::vector<std::pair<float, float>>
+{
+    std::vector<std::pair<float, float>> aPos;
+    for (std::size_t i = 0; i < store.GetSize(); ++i)
+        aPos.emplace_back(store.GetX(i), store.GetY(i));
+    std::sort(aPos.begin(), aPos.end());
+    return aPos;
+}
+
+auto SortedPositions(const ReferenceEmitter& reference) -> std::vector<std::pair<float, float>>
+{
+    std::vector<std::pair<float, float>> aPos;
+    for (const auto& p : reference.particles)
+    {
+        if (p.timeRemaining > 0.0F)
+            aPos.emplace_back(p.posX, p.posY);
+    }
+    std::sort(aPos.begin(), aPos.end());
+    return aPos;
+}
+
+} // namespace
+
+TEST(ParticleStoreTest, CullSwapRemovesExpired)
+{
+    ParticleStore store;
+    store.Emit(0.0F, 0.0F, 0.0F, 0.0F, 0.5F);
+    store.Emit(1.0F, 0.0F, 0.0F, 0.0F, 2.0F);
+    store.Emit(2.0F, 0.0F, 0.0F, 0.0F, 0.5F);
+    store.Emit(3.0F, 0.0F, 0.0F, 0.0F, 2.0F);
+
+    store.Cull(1.0F);
+
+    ASSERT_EQ(store.GetSize(), 2);
+    EXPECT_FLOAT_EQ(store.GetTimeRemaining(0), 1.0F);
+    EXPECT_FLOAT_EQ(store.GetTimeRemaining(1), 1.0F);
+    EXPECT_FLOAT_EQ(store.GetX(0) + store.GetX(1), 4.0F);
+}
+
+TEST(ParticleStoreTest, ColorLerpsByAge)
+{
+    ParticleStore store;
+    const auto i = store.Emit(0.0F, 0.0F, 0.0F, 0.0F, 2.0F);
+    store.SetColorRange(i, {0.0F, 100.0F, 200.0F, 255.0F}, {200.0F, 100.0F, 0.0F, 55.0F});
+
+    store.Cull(0.5F);
+    store.Animate(0.5F, 0.5F);
+
+    // A quarter of the way through its life, alpha then halved
+    EXPECT_FLOAT_EQ(store.GetColorA(0), (255.0F - 200.0F * 0.25F) * 0.5F);
+}
+
+TEST(ParticleStoreTest, EmitterMatchesPerParticleUpdate)
+{
+    ParticleEmitter emitter;
+    ReferenceEmitter reference;
+    Configure(emitter, reference, 300, 0.005F);
+
+    for (int step = 0; step < 200; ++step)
+    {
+        emitter.update(0.016F, 0.0F, 0, 0.0F);
+        reference.update(0.016F);
+        ASSERT_EQ(emitter.activeCount, reference.activeCount) << "step " << step;
+    }
+
+    const auto aActual = SortedPositions(emitter.particles);
+    const auto aExpected = SortedPositions(reference);
+    ASSERT_EQ(aActual.size(), aExpected.size());
+    for (std::size_t i = 0; i < aActual.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(aActual[i].first, aExpected[i].first);
+        EXPECT_FLOAT_EQ(aActual[i].second, aExpected[i].second);
+    }
+}
+
+TEST(ParticleStoreTest, ResetDropsEverything)
+{
+    ParticleEmitter emitter;
+    emitter.maxParticles = 10;
+    emitter.emitInterval = 0.001F;
+    emitter.update(0.016F, 0.0F, 0, 0.0F);
+    ASSERT_EQ(emitter.activeCount, 10);
+
+    emitter.reset();
+    EXPECT_EQ(emitter.activeCount, 0);
+    EXPECT_TRUE(emitter.particles.IsEmpty());
+}
+
+TEST(ParticleStoreTest, AppendQuadsBuildsOneQuadPerParticle)
+{
+    ParticleStore store;
+    const auto i = store.Emit(10.0F, 20.0F, 0.0F, 0.0F, 1.0F);
+    store.SetSizeRate(i, 1.0F);
+    store.Emit(-5.0F, 0.0F, 0.0F, 0.0F, 1.0F);
+    store.Animate(2.0F, 1.0F); // First particle grows to size 2
+
+    std::vector<SDL_Vertex> aVertex(1);
+    std::vector<int> aIndex;
+    store.AppendQuads(aVertex, aIndex, 100.0F, 0.0F, 8.0F);
+
+    ASSERT_EQ(aVertex.size(), 1 + 2 * 4);
+    ASSERT_EQ(aIndex.size(), 2 * 6);
+    EXPECT_EQ(aIndex[0], 1);
+    EXPECT_EQ(aIndex[11], 8);
+
+    // 16 px quad around (110, 20), unrotated
+    EXPECT_FLOAT_EQ(aVertex[1].position.x, 102.0F);
+    EXPECT_FLOAT_EQ(aVertex[1].position.y, 12.0F);
+    EXPECT_FLOAT_EQ(aVertex[3].position.x, 118.0F);
+    EXPECT_FLOAT_EQ(aVertex[3].position.y, 28.0F);
+}
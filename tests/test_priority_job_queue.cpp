@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "util/PriorityJobQueue.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace ms;
+
+TEST(PriorityJobQueueTest, RunsHighestPriorityFirstThenPushOrder)
+{
+    PriorityJobQueue queue;
+    std::vector<int> aRan;
+    queue.Push(1, nullptr, [&] { aRan.push_back(10); });
+    queue.Push(5, nullptr, [&] { aRan.push_back(50); });
+    queue.Push(1, nullptr, [&] { aRan.push_back(11); });
+    queue.Push(5, nullptr, [&] { aRan.push_back(51); });
+    queue.Push(3, nullptr, [&] { aRan.push_back(30); });
+
+    while (queue.RunOne())
+    {
+    }
+
+    EXPECT_EQ(aRan, (std::vector<int>{50, 51, 30, 10, 11}));
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(PriorityJobQueueTest, CancelDropsOnlyThatOwner)
+{
+    PriorityJobQueue queue;
+    int a = 0;
+    int b = 0;
+    std::vector<int> aRan;
+    for (int i = 0; i < 4; ++i)
+    {
+        queue.Push(i, &a, [&aRan, i] { aRan.push_back(i); });
+        queue.Push(i, &b, [&aRan, i] { aRan.push_back(100 + i); });
+    }
+
+    EXPECT_EQ(queue.Cancel(&a), 4u);
+    EXPECT_EQ(queue.Cancel(&a), 0u);
+    EXPECT_EQ(queue.GetSize(), 4u);
+
+    while (queue.RunOne())
+    {
+    }
+    EXPECT_EQ(aRan, (std::vector<int>{103, 102, 101, 100}));
+}
+
+TEST(PriorityJobQueueTest, JobsMayQueueMoreWork)
+{
+    PriorityJobQueue queue;
+    std::vector<int> aRan;
+    queue.Push(1, nullptr, [&]
+    {
+        aRan.push_back(1);
+        queue.Push(9, nullptr, [&] { aRan.push_back(9); });
+    });
+    queue.Push(0, nullptr, [&] { aRan.push_back(0); });
+
+    while (queue.RunOne())
+    {
+    }
+    EXPECT_EQ(aRan, (std::vector<int>{1, 9, 0}));
+}
+
+TEST(PriorityJobQueueTest, RunForChecksTheBudgetBeforeEachJob)
+{
+    using namespace std::chrono_literals;
+
+    PriorityJobQueue queue;
+    int nRan = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        queue.Push(0, nullptr, [&nRan]
+        {
+            ++nRan;
+            std::this_thread::sleep_for(2ms);
+        });
+    }
+
+    // A spent budget runs nothing
+    EXPECT_EQ(queue.RunFor(0us), 0u);
+    EXPECT_EQ(nRan, 0);
+    EXPECT_EQ(queue.GetSize(), 10u);
+
+    const auto nRun = queue.RunFor(5ms);
+    EXPECT_GE(nRun, 1u);
+    EXPECT_LT(nRun, 9u);
+
+    while (queue.RunFor(1s) != 0)
+    {
+    }
+    EXPECT_EQ(nRan, 10);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "graphics/WzGr2DRenderList.h"
+#include "graphics/WzGr2DTypes.h"
+
+using namespace ms;
+
+namespace
+{
+
+auto fakeTexture(std::uintptr_t id) -> SDL_Texture*
+{
+    return reinterpret_cast<SDL_Texture*>(id);
+}
+
+} // namespace
+
+TEST(RenderListTest, AppendKeepsOrderAndFields)
+{
+    WzGr2DRenderList list;
+    list.Append(5, {10.0F, 20.0F, 30.0F, 40.0F}, fakeTexture(0x10), 0x80FF0000, 1,
+                static_cast<std::int32_t>(LayerFlipState::Horizontal), 45.0F, 7);
+    list.Append(-1, {0.0F, 0.0F, 1.0F, 1.0F}, fakeTexture(0x20), 0xFFFFFFFF, 0, 0, 0.0F, 0);
+
+    ASSERT_EQ(list.GetCount(), 2);
+    EXPECT_EQ(list.GetZ(0), 5);
+    EXPECT_EQ(list.GetZ(1), -1);
+    EXPECT_FLOAT_EQ(list.GetBounds(0).w, 30.0F);
+    EXPECT_EQ(list.GetTexture(0), fakeTexture(0x10));
+    EXPECT_EQ(list.GetColor(0), 0x80FF0000);
+    EXPECT_EQ(list.GetBlend(0), 1);
+    EXPECT_EQ(list.GetFlip(0), 1);
+    EXPECT_FLOAT_EQ(list.GetRotation(0), 45.0F);
+    EXPECT_EQ(list.GetFrameId(0), 7);
+}
+
+TEST(RenderListTest, CullDropsOffscreenItems)
+{
+    WzGr2DRenderList list;
+    list.Append(0, {-50.0F, 0.0F, 40.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0); // left
+    list.Append(0, {100.0F, 100.0F, 40.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0); // inside
+    list.Append(0, {-20.0F, -20.0F, 40.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0); // overlaps corner
+    list.Append(0, {801.0F, 0.0F, 40.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0); // right
+    list.Append(0, {0.0F, 601.0F, 40.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0); // below
+
+    EXPECT_EQ(list.Cull(800.0F, 600.0F), 2);
+    ASSERT_EQ(list.GetDrawIndices().size(), 2);
+    EXPECT_EQ(list.GetDrawIndices()[0], 1);
+    EXPECT_EQ(list.GetDrawIndices()[1], 2);
+}
+
+TEST(RenderListTest, ClearResetsItems)
+{
+    WzGr2DRenderList list;
+    list.Append(0, {0.0F, 0.0F, 1.0F, 1.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0);
+    list.Cull(10.0F, 10.0F);
+
+    list.Clear();
+    EXPECT_EQ(list.GetCount(), 0);
+    EXPECT_EQ(list.GetDrawCount(), 0);
+}
+
+TEST(RenderListTest, CullBatchesRunsOfOneTexture)
+{
+    WzGr2DRenderList list;
+    // A crowd of one mob type, then a different sprite, then the crowd again
+    for (int i = 0; i < 50; ++i)
+    {
+        list.Append(0, {static_cast<float>(i * 10), 0.0F, 8.0F, 8.0F}, fakeTexture(1),
+                    0xFFFFFFFF, 0, i % 2, 0.0F, 0);
+    }
+    list.Append(0, {0.0F, 50.0F, 8.0F, 8.0F}, fakeTexture(2), 0xFFFFFFFF, 0, 0, 0.0F, 0);
+    list.Append(0, {20.0F, 50.0F, 8.0F, 8.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 0.0F, 0);
+    list.Append(0, {30.0F, 50.0F, 8.0F, 8.0F}, fakeTexture(1), 0xFFFFFFFF, 1, 0, 0.0F, 0); // other blend
+
+    EXPECT_EQ(list.Cull(800.0F, 600.0F), 53u);
+    const auto& aBatch = list.GetBatches();
+    ASSERT_EQ(aBatch.size(), 4u);
+    EXPECT_EQ(aBatch[0].nFirst, 0u);
+    EXPECT_EQ(aBatch[0].nCount, 50u);
+    EXPECT_EQ(aBatch[1].nCount, 1u);
+    EXPECT_EQ(aBatch[2].nCount, 1u);
+    EXPECT_EQ(aBatch[3].nCount, 1u);
+
+    // Only the multi-item batch needs vertices
+    EXPECT_EQ(list.GetVertices().size(), 200u);
+}
+
+TEST(RenderListTest, BatchVerticesCarryPositionFlipAndAlpha)
+{
+    WzGr2DRenderList list;
+    list.Append(0, {10.0F, 20.0F, 30.0F, 40.0F}, fakeTexture(1), 0x80FF0000, 0, 0, 0.0F, 0);
+    list.Append(0, {100.0F, 20.0F, 30.0F, 40.0F}, fakeTexture(1), 0xFFFFFFFF, 0,
+                static_cast<std::int32_t>(LayerFlipState::Horizontal), 0.0F, 0);
+    list.Append(0, {200.0F, 200.0F, 20.0F, 10.0F}, fakeTexture(1), 0xFFFFFFFF, 0, 0, 90.0F, 0);
+    list.Cull(800.0F, 600.0F);
+
+    ASSERT_EQ(list.GetBatches().size(), 1u);
+    const auto& v = list.GetVertices();
+    ASSERT_EQ(v.size(), 12u);
+
+    // Quad 0: TL, TR, BL, BR with the colour in every vertex
+    EXPECT_FLOAT_EQ(v[0].x, 10.0F);
+    EXPECT_FLOAT_EQ(v[0].y, 20.0F);
+    EXPECT_FLOAT_EQ(v[3].x, 40.0F);
+    EXPECT_FLOAT_EQ(v[3].y, 60.0F);
+    EXPECT_FLOAT_EQ(v[0].r, 1.0F);
+    EXPECT_FLOAT_EQ(v[0].g, 0.0F);
+    EXPECT_NEAR(v[0].a, 128.0F / 255.0F, 1e-6F);
+    EXPECT_FLOAT_EQ(v[0].u, 0.0F);
+    EXPECT_FLOAT_EQ(v[1].u, 1.0F);
+
+    // Quad 1: mirrored texture coordinates, same positions
+    EXPECT_FLOAT_EQ(v[4].x, 100.0F);
+    EXPECT_FLOAT_EQ(v[4].u, 1.0F);
+    EXPECT_FLOAT_EQ(v[5].u, 0.0F);
+
+    // Quad 2: rotated 90 degrees clockwise about its centre (210, 205)
+    EXPECT_NEAR(v[8].x, 215.0F, 1e-4F);
+    EXPECT_NEAR(v[8].y, 195.0F, 1e-4F);
+    EXPECT_NEAR(v[11].x, 205.0F, 1e-4F);
+    EXPECT_NEAR(v[11].y, 215.0F, 1e-4F);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "graphics/CameraCtrl.h"
+#include "util/SpscRing.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace ms;
+
+TEST(SpscRingTest, PopsInPushOrder)
+{
+    TSpscRing<int, 4> ring;
+    int value = 0;
+    EXPECT_FALSE(ring.TryPop(value));
+
+    EXPECT_TRUE(ring.TryPush(1));
+    EXPECT_TRUE(ring.TryPush(2));
+    EXPECT_TRUE(ring.TryPop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(ring.TryPop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST(SpscRingTest, RejectsPushWhenFullAndWrapsAround)
+{
+    TSpscRing<int, 4> ring;
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(ring.TryPush(round * 10 + i));
+        EXPECT_FALSE(ring.TryPush(99));
+        EXPECT_EQ(ring.GetSize(), 4u);
+
+        int value = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(ring.TryPop(value));
+            EXPECT_EQ(value, round * 10 + i);
+        }
+    }
+}
+
+TEST(SpscRingTest, ClearDropsQueuedValues)
+{
+    TSpscRing<int, 8> ring;
+    ring.TryPush(1);
+    ring.TryPush(2);
+    ring.Clear();
+
+    int value = 0;
+    EXPECT_FALSE(ring.TryPop(value));
+    EXPECT_TRUE(ring.TryPush(3));
+    EXPECT_TRUE(ring.TryPop(value));
+    EXPECT_EQ(value, 3);
+}
+
+TEST(SpscRingTest, CarriesCameraCommandsByValue)
+{
+    TSpscRing<CameraCtrl::AnyCommand, CameraCtrl::Manager::QueueCapacity> ring;
+
+    CameraCtrl::AbsMoveCommand move;
+    move.ptDest = {120, -40};
+    move.tDelay = 500;
+    move.type = Interpolation::Sine;
+    EXPECT_TRUE(ring.TryPush(move));
+
+    CameraCtrl::ScaleCommand scale;
+    scale.nEndScale = 2000;
+    EXPECT_TRUE(ring.TryPush(scale));
+
+    CameraCtrl::AnyCommand cmd;
+    ASSERT_TRUE(ring.TryPop(cmd));
+    const auto* pMove = std::get_if<CameraCtrl::AbsMoveCommand>(&cmd);
+    ASSERT_NE(pMove, nullptr);
+    EXPECT_EQ(pMove->ptDest.x, 120);
+    EXPECT_EQ(pMove->ptDest.y, -40);
+    EXPECT_EQ(pMove->tDelay, 500);
+    EXPECT_EQ(pMove->type, Interpolation::Sine);
+
+    ASSERT_TRUE(ring.TryPop(cmd));
+    ASSERT_TRUE(std::holds_alternative<CameraCtrl::ScaleCommand>(cmd));
+    EXPECT_EQ(std::get<CameraCtrl::ScaleCommand>(cmd).nEndScale, 2000);
+}
+
+TEST(SpscRingTest, ThreadedTransferKeepsOrder)
+{
+    constexpr int Count = 200000;
+    TSpscRing<int, 64> ring;
+    std::atomic<bool> bStop{false};
+
+    std::thread producer([&ring, &bStop]
+    {
+        for (int i = 0; i < Count; ++i)
+        {
+            while (!ring.TryPush(i))
+            {
+                if (bStop.load(std::memory_order_relaxed))
+                    return;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Failing inside the loop would leave the producer joinable, so the
+    // first mismatch stops both sides and is checked after the join
+    int nExpected = 0;
+    int nMismatch = -1;
+    int value = 0;
+    while (nExpected < Count)
+    {
+        if (!ring.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != nExpected)
+        {
+            nMismatch = value;
+            bStop.store(true, std::memory_order_relaxed);
+            break;
+        }
+        ++nExpected;
+    }
+    producer.join();
+
+    ASSERT_EQ(nMismatch, -1) << "expected " << nExpected;
+    EXPECT_TRUE(ring.IsEmpty());
+}
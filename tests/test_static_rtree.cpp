@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "util/StaticRTree.h"
+#include "util/TRSTree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace ms;
+
+namespace
+{
+
+using Tree = TStaticRTree<std::int32_t, 16>;
+
+/// Foothold-like segments: mostly short and flat, spread over a wide map
+auto MakeSegments(std::size_t count, std::uint32_t seed) -> std::vector<Tree::Item>
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::int32_t> x(-3000, 3000);
+    std::uniform_int_distribution<std::int32_t> y(-1500, 1500);
+    std::uniform_int_distribution<std::int32_t> len(10, 300);
+    std::uniform_int_distribution<std::int32_t> slope(-40, 40);
+
+    std::vector<Tree::Item> items;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto x1 = x(rng);
+        const auto y1 = y(rng);
+        items.push_back({Tree::MakeBounds2D(x1, y1, x1 + len(rng), y1 + slope(rng)),
+                         static_cast<std::uint32_t>(i)});
+    }
+    return items;
+}
+
+auto BruteForce(const std::vector<Tree::Item>& items, const Tree::Bounds& query)
+    -> std::vector<std::uint32_t>
+{
+    std::vector<std::uint32_t> hits;
+    for (const auto& item : items)
+    {
+        if (item.bbox.Intersects(query))
+            hits.push_back(item.nIndex);
+    }
+    return hits;
+}
+
+} // namespace
+
+TEST(StaticRTreeTest, EmptyTreeFindsNothing)
+{
+    Tree tree;
+    tree.Build({});
+
+    std::vector<std::uint32_t> hits;
+    tree.Search(Tree::MakeBounds2D(-100, -100, 100, 100), hits);
+
+    EXPECT_TRUE(tree.IsEmpty());
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(StaticRTreeTest, SingleItem)
+{
+    Tree tree;
+    tree.Build({{Tree::MakeBounds2D(0, 0, 10, 0), 7}});
+
+    std::vector<std::uint32_t> hits;
+    tree.Search(Tree::MakeBounds2D(5, -1, 5, 1), hits);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0], 7);
+
+    hits.clear();
+    tree.Search(Tree::MakeBounds2D(11, -1, 20, 1), hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(StaticRTreeTest, NodesAreFull)
+{
+    Tree tree;
+    tree.Build(MakeSegments(16 * 16, 1));
+
+    // 16 full leaves and one root
+    EXPECT_EQ(tree.GetSize(), 256);
+    EXPECT_EQ(tree.GetNodeCount(), 17);
+}
+
+TEST(StaticRTreeTest, MatchesBruteForce)
+{
+    const auto items = MakeSegments(5000, 42);
+    Tree tree;
+    tree.Build(items);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<std::int32_t> x(-3200, 3200);
+    std::uniform_int_distribution<std::int32_t> y(-1700, 1700);
+    std::uniform_int_distribution<std::int32_t> size(0, 400);
+
+    for (int i = 0; i < 500; ++i)
+    {
+        const auto x1 = x(rng);
+        const auto y1 = y(rng);
+        const auto query = Tree::MakeBounds2D(x1, y1, x1 + size(rng), y1 + size(rng));
+
+        std::vector<std::uint32_t> hits;
+        tree.Search(query, hits);
+        std::sort(hits.begin(), hits.end());
+
+        ASSERT_EQ(hits, BruteForce(items, query));
+    }
+}
+
+TEST(StaticRTreeTest, VisitorSeesSameHitsAsContainer)
+{
+    const auto items = MakeSegments(1000, 5);
+    Tree tree;
+    tree.Build(items);
+
+    const auto query = Tree::MakeBounds2D(-500, -500, 500, 500);
+
+    std::vector<std::uint32_t> hits;
+    tree.Search(query, hits);
+
+    std::vector<std::uint32_t> visited;
+    tree.Search(query, [&visited](std::uint32_t nIndex) { visited.push_back(nIndex); });
+
+    EXPECT_FALSE(hits.empty());
+    EXPECT_EQ(visited, hits);
+}
+
+TEST(StaticRTreeTest, TRSTreeVisitorSeesSameHitsAsContainer)
+{
+    TRSTree<std::int32_t, std::uint32_t, 2, 4, 2> tree;
+    for (const auto& item : MakeSegments(1000, 5))
+    {
+        tree.Insert(decltype(tree)::MakeBounds2D(item.bbox.xMin, item.bbox.yMin,
+                                                 item.bbox.xMax, item.bbox.yMax),
+                    item.nIndex);
+    }
+
+    const auto query = decltype(tree)::MakeBounds2D(-500, -500, 500, 500);
+
+    std::vector<std::uint32_t> hits;
+    tree.Search(query, hits);
+
+    std::vector<std::uint32_t> visited;
+    tree.Search(query, [&visited](const std::uint32_t& nIndex) { visited.push_back(nIndex); });
+
+    EXPECT_FALSE(hits.empty());
+    EXPECT_EQ(visited, hits);
+}
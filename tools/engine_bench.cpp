@@ -0,0 +1,676 @@
+/**
+ * @file engine_bench.cpp
+ * @brief Synthetic micro-benchmarks for engine hot paths
+ *
+ * Each case builds its own data set in memory and times one hot path,
+ * usually next to what it replaced. No WZ data, window or renderer is
+ * needed. A case whose two sides disagree on the result, or whose result
+ * is implausible, fails the run.
+ *
+ * Usage:
+ *   ./EngineBench [--list] [case...]
+ *
+ * Runs the named cases in order, or every case when none is named.
+ *
+ * Manual tool: timings depend on the machine and its load, so nothing runs
+ * it automatically. Compare numbers from the same machine only.
+ */
+
+#include "animation/ActionSpec.h"
+#include "animation/CharacterActionFrameEntry.h"
+#include "animation/CharacterFrameCache.h"
+#include "animation/SpriteInstance.h"
+#include "animation/SpriteSource.h"
+#include "field/foothold/StaticFoothold.h"
+#include "graphics/CameraCtrl.h"
+#include "graphics/Gr2DVector.h"
+#include "graphics/Gr2DVectorResolver.h"
+#include "graphics/WzGr2DCanvas.h"
+#include "graphics/WzGr2DTypes.h"
+#include "physics/FootholdColumnIndex.h"
+#include "physics/MoverBatch.h"
+#include "util/FlatHashMap.h"
+#include "util/Logger.h"
+#include "util/StaticRTree.h"
+#include "util/SpscRing.h"
+#include "util/TRSTree.h"
+#include "wz/WzCanvas.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+auto ElapsedNs(Clock::time_point tStart) -> double
+{
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tStart).count());
+}
+
+// ========== Cases ==========
+
+/// Ground probes (thin strips under a point, as GetFootholdUnderneath makes)
+/// against 2000 foothold-like segments: bulk-loaded tree vs insertion-built R*-tree
+auto BenchStaticRTree() -> bool
+{
+    using Tree = ms::TStaticRTree<std::int32_t, 16>;
+    using RSTree = ms::TRSTree<std::int32_t, std::uint32_t, 2, 4, 2>;
+    constexpr std::size_t SegmentCount = 2000;
+    constexpr std::size_t ProbeCount = 100000;
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<std::int32_t> x(-3000, 3000);
+    std::uniform_int_distribution<std::int32_t> y(-1500, 1500);
+    std::uniform_int_distribution<std::int32_t> len(10, 300);
+    std::uniform_int_distribution<std::int32_t> slope(-40, 40);
+
+    std::vector<Tree::Item> aItem;
+    RSTree rsTree;
+    for (std::size_t i = 0; i < SegmentCount; ++i)
+    {
+        const auto x1 = x(rng);
+        const auto y1 = y(rng);
+        const auto x2 = x1 + len(rng);
+        const auto y2 = y1 + slope(rng);
+        aItem.push_back({Tree::MakeBounds2D(x1, y1, x2, y2), static_cast<std::uint32_t>(i)});
+        rsTree.Insert(RSTree::MakeBounds2D(x1, y1, x2, y2), static_cast<std::uint32_t>(i));
+    }
+    Tree tree;
+    tree.Build(aItem);
+
+    std::vector<std::array<std::int32_t, 2>> aProbe(ProbeCount);
+    for (auto& probe : aProbe)
+        probe = {x(rng), y(rng)};
+
+    std::vector<std::uint32_t> aHit;
+    std::size_t nStaticHit = 0;
+    auto tStart = Clock::now();
+    for (const auto& [px, py] : aProbe)
+    {
+        aHit.clear();
+        tree.Search(Tree::MakeBounds2D(px - 1, py - 1, px + 1, py + 600), aHit);
+        nStaticHit += aHit.size();
+    }
+    const auto nsStatic = ElapsedNs(tStart);
+
+    std::size_t nRSHit = 0;
+    tStart = Clock::now();
+    for (const auto& [px, py] : aProbe)
+    {
+        aHit.clear();
+        rsTree.Search(RSTree::MakeBounds2D(px - 1, py - 1, px + 1, py + 600), aHit);
+        nRSHit += aHit.size();
+    }
+    const auto nsRS = ElapsedNs(tStart);
+
+    std::printf("  TStaticRTree: %.1f ns/probe, %zu hits\n", nsStatic / ProbeCount, nStaticHit);
+    std::printf("  TRSTree:      %.1f ns/probe, %zu hits\n", nsRS / ProbeCount, nRSHit);
+    return nStaticHit == nRSHit;
+}
+
+/// The same 100k ground probes against 2000 platforms, slopes and walls:
+/// per-column table vs R-tree candidates checked one by one
+auto BenchFootholdColumn() -> bool
+{
+    using Tree = ms::TStaticRTree<std::int32_t, 16>;
+    constexpr std::size_t FootholdCount = 2000;
+    constexpr std::size_t ProbeCount = 100000;
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<std::int32_t> x(-3000, 3000);
+    std::uniform_int_distribution<std::int32_t> y(-1500, 1500);
+    std::uniform_int_distribution<std::int32_t> len(10, 900);
+    std::uniform_int_distribution<std::int32_t> slope(-300, 300);
+    std::uniform_int_distribution<int> kind(0, 9);
+
+    std::vector<std::shared_ptr<ms::StaticFoothold>> aOwner;
+    std::vector<ms::StaticFoothold*> apFoothold;
+    std::vector<Tree::Item> aItem;
+    auto Add = [&](std::int32_t x1, std::int32_t y1, std::int32_t x2, std::int32_t y2)
+    {
+        const auto sn = static_cast<std::uint32_t>(aOwner.size());
+        aOwner.push_back(std::make_shared<ms::StaticFoothold>(
+            sn + 1, x1, y1, x2, y2, 0, 0, 0, 0, std::make_shared<ms::CAttrFoothold>()));
+        apFoothold.push_back(aOwner.back().get());
+        aItem.push_back({Tree::MakeBounds2D(std::min(x1, x2), std::min(y1, y2),
+                                            std::max(x1, x2), std::max(y1, y2)), sn});
+    };
+    for (std::size_t i = 0; i < FootholdCount; ++i)
+    {
+        const auto x1 = x(rng);
+        const auto y1 = y(rng);
+        switch (kind(rng))
+        {
+        case 0: // Wall
+            Add(x1, y1, x1, y1 + len(rng));
+            break;
+        case 1: // Right to left (ceiling side)
+            Add(x1 + len(rng), y1, x1, y1 + slope(rng));
+            break;
+        default:
+            Add(x1, y1, x1 + len(rng), y1 + slope(rng));
+            break;
+        }
+    }
+
+    ms::FootholdColumnIndex index;
+    index.Build(apFoothold);
+    Tree tree;
+    tree.Build(aItem);
+
+    std::vector<std::array<std::int32_t, 2>> aProbe(ProbeCount);
+    for (auto& probe : aProbe)
+        probe = {x(rng), y(rng)};
+
+    std::int64_t nIndexSum = 0;
+    auto tStart = Clock::now();
+    for (const auto& [px, py] : aProbe)
+    {
+        std::int32_t cy = 0;
+        (void)index.FindUnderneath(px, py, INT_MAX, cy);
+        nIndexSum += cy;
+    }
+    const auto nsIndex = ElapsedNs(tStart);
+
+    // Floors run left to right; walls and ceilings never hold anyone up
+    std::vector<std::uint32_t> aHit;
+    std::int64_t nTreeSum = 0;
+    tStart = Clock::now();
+    for (const auto& [px, py] : aProbe)
+    {
+        aHit.clear();
+        tree.Search(Tree::MakeBounds2D(px, py, px, INT_MAX), aHit);
+
+        std::int32_t cy = INT_MAX;
+        for (const auto nIndex : aHit)
+        {
+            const auto& fh = *apFoothold[nIndex];
+            if (fh.GetX1() >= fh.GetX2())
+                continue;
+            const auto yAtX = (fh.GetY2() - fh.GetY1()) * (px - fh.GetX1())
+                              / (fh.GetX2() - fh.GetX1()) + fh.GetY1();
+            if (yAtX >= py && yAtX < cy)
+                cy = yAtX;
+        }
+        nTreeSum += cy;
+    }
+    const auto nsTree = ElapsedNs(tStart);
+
+    std::printf("  FootholdColumnIndex: %.1f ns/probe\n", nsIndex / ProbeCount);
+    std::printf("  R-tree + scan:       %.1f ns/probe\n", nsTree / ProbeCount);
+    return nIndexSum == nTreeSum;
+}
+
+/// 1000 movers pacing on 10 rows of linked zigzag platforms for 1000 ticks
+auto BenchMoverBatch() -> bool
+{
+    constexpr std::size_t MoverCount = 1000;
+    constexpr int TickCount = 1000;
+    constexpr double Tick = 0.03;
+
+    std::vector<std::shared_ptr<ms::StaticFoothold>> aOwner;
+    std::vector<ms::StaticFoothold*> apFoothold;
+    for (std::int32_t row = 0; row < 10; ++row)
+    {
+        ms::StaticFoothold* pPrev = nullptr;
+        for (std::int32_t x = -3000; x < 3000; x += 200)
+        {
+            const auto sn = static_cast<std::uint32_t>(aOwner.size() + 1);
+            const auto y = row * 200;
+            aOwner.push_back(std::make_shared<ms::StaticFoothold>(
+                sn, x, y, x + 200, y + (x / 200 % 2 ? 20 : -20), 0, 0, 0, 0,
+                std::make_shared<ms::CAttrFoothold>()));
+            auto* pfh = aOwner.back().get();
+            if (pPrev)
+            {
+                pPrev->SetNextLink(pfh);
+                pfh->SetPrevLink(pPrev);
+            }
+            apFoothold.push_back(pfh);
+            pPrev = pfh;
+        }
+    }
+    ms::FootholdColumnIndex index;
+    index.Build(apFoothold);
+
+    ms::MoverBatch batch;
+    batch.Reserve(MoverCount);
+    for (std::size_t i = 0; i < MoverCount; ++i)
+    {
+        batch.Add(-2900.0 + static_cast<double>(i * 37 % 5800),
+                  -100.0 + static_cast<double>(i % 10) * 200.0, 0.0, 0.0,
+                  static_cast<std::int32_t>(i % 3) - 1, nullptr, {});
+    }
+
+    const auto tStart = Clock::now();
+    for (int i = 0; i < TickCount; ++i)
+        batch.Step(Tick, index);
+    const auto nsStep = ElapsedNs(tStart);
+
+    std::size_t nGrounded = 0;
+    for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        nGrounded += batch.GetFoothold(i) ? 1u : 0u;
+
+    std::printf("  MoverBatch::Step: %.0f ns/tick, %.1f ns/mover/tick\n",
+                nsStep / TickCount, nsStep / TickCount / MoverCount);
+    std::printf("  %zu/%zu movers on a foothold at the end\n", nGrounded, MoverCount);
+    return nGrounded > 0;
+}
+
+/// 10k live particles under gravity and drift force, 200 steps of 16 ms
+auto BenchParticles() -> bool
+{
+    constexpr std::int32_t ParticleCount = 10000;
+    constexpr int StepCount = 200;
+
+    ms::ParticleEmitter emitter;
+    emitter.maxParticles = ParticleCount;
+    emitter.emitInterval = 1.0F / ParticleCount / 10.0F;
+    emitter.usePhysics = true;
+    emitter.affectGravity = true;
+    emitter.mirrorDirection = -1;
+    emitter.forceXA = 3.0F;
+    emitter.forceXB = -1.0F;
+    emitter.forceYA = 5.0F;
+    emitter.velocityX = 40.0F;
+    emitter.velocityY = -20.0F;
+
+    // The first step fills the store, so only steady-state steps are timed
+    emitter.update(0.016F, 0.0F, 0, 0.0F);
+
+    const auto tStart = Clock::now();
+    for (int step = 0; step < StepCount; ++step)
+        emitter.update(0.016F, 0.0F, 0, 0.0F);
+    const auto nsUpdate = ElapsedNs(tStart);
+
+    std::printf("  ParticleEmitter::update: %.0f ns/step, %.2f ns/particle/step, %d live\n",
+                nsUpdate / StepCount, nsUpdate / StepCount / ParticleCount, emitter.activeCount);
+    return emitter.activeCount == ParticleCount;
+}
+
+/// 10k leaves under 100 shared origins, all following one animated root
+auto BenchVectorResolver() -> bool
+{
+    constexpr std::size_t MidCount = 100;
+    constexpr std::size_t LeafCount = 10000;
+    constexpr int FrameCount = 60;
+
+    ms::Gr2DTime::SetCurrentTime(0);
+    ms::Gr2DVector root(0, 0);
+    root.RelMove(1000, 500, 0, 1000);
+
+    std::vector<std::unique_ptr<ms::Gr2DVector>> aMid;
+    std::vector<std::unique_ptr<ms::Gr2DVector>> aLeaf;
+    for (std::size_t i = 0; i < MidCount; ++i)
+    {
+        aMid.push_back(std::make_unique<ms::Gr2DVector>(static_cast<std::int32_t>(i), 0));
+        aMid.back()->PutOrigin(&root);
+    }
+    for (std::size_t i = 0; i < LeafCount; ++i)
+    {
+        aLeaf.push_back(std::make_unique<ms::Gr2DVector>(0, static_cast<std::int32_t>(i)));
+        aLeaf.back()->PutOrigin(aMid[i % MidCount].get());
+    }
+
+    ms::Gr2DVectorResolver resolver;
+    for (auto& vec : aLeaf)
+        resolver.Add(vec.get());
+
+    const auto tStart = Clock::now();
+    for (int frame = 0; frame < FrameCount; ++frame)
+        resolver.Resolve(frame * 16);
+    const auto nsResolve = ElapsedNs(tStart);
+
+    const auto nVector = resolver.GetOrder().size();
+    std::printf("  Gr2DVectorResolver::Resolve: %.0f ns/frame, %.1f ns/vector\n",
+                nsResolve / FrameCount, nsResolve / FrameCount / static_cast<double>(nVector));
+
+    const auto* pLeaf = resolver.Find(*aLeaf[150]);
+    return nVector == 1 + MidCount + LeafCount && pLeaf && pLeaf->x == root.GetX() + 50;
+}
+
+/// 10k looping tweens (half of them ping-pong) for 600 frames, the last
+/// one after a 100 s pause
+auto BenchEasing() -> bool
+{
+    constexpr std::size_t NodeCount = 10000;
+    constexpr int FrameCount = 600;
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<std::int32_t> delta(-2000, 2000);
+    std::uniform_int_distribution<std::int32_t> start(0, 1000);
+    std::vector<ms::EasingNode> aNode(NodeCount);
+    for (std::size_t i = 0; i < NodeCount; ++i)
+    {
+        auto& node = aNode[i];
+        node.dx = delta(rng);
+        node.dy = delta(rng);
+        node.startTime = start(rng);
+        node.endTime = node.startTime + 50 + static_cast<std::int32_t>(i % 400);
+        node.bounce = true;
+        node.pingpong = i % 2 != 0;
+        node.looseTimer = node.startTime;
+        node.UpdateMode();
+    }
+
+    std::size_t nDone = 0;
+    std::int64_t nSum = 0;
+    const auto tStart = Clock::now();
+    for (int f = 0; f < FrameCount; ++f)
+    {
+        const std::int32_t frame = f == FrameCount - 1 ? 100000 : f * 16;
+        for (auto& node : aNode)
+        {
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+            nDone += static_cast<std::size_t>(node.evaluatePos(x, y, frame, true));
+            nSum += x + y;
+        }
+    }
+    const auto nsEase = ElapsedNs(tStart);
+
+    std::printf("  EasingNode::evaluatePos: %.1f ns/call (checksum %lld)\n",
+                nsEase / FrameCount / NodeCount, static_cast<long long>(nSum));
+    return nDone == 0;
+}
+
+/// Push-to-pop latency of camera commands between two threads, one
+/// command in flight at a time so queueing doesn't count
+auto BenchCameraQueue() -> bool
+{
+    constexpr std::size_t CommandCount = 2000;
+
+    ms::TSpscRing<ms::CameraCtrl::AnyCommand, ms::CameraCtrl::Manager::QueueCapacity> ring;
+    std::vector<Clock::time_point> aPushed(CommandCount);
+    std::vector<double> aLatencyNs(CommandCount);
+    std::atomic<std::size_t> nConsumed{0};
+    std::atomic<bool> bStop{false};
+
+    std::thread producer([&]
+    {
+        for (std::size_t i = 0; i < CommandCount && !bStop.load(std::memory_order_relaxed); ++i)
+        {
+            ms::CameraCtrl::RelMoveCommand cmd;
+            cmd.ptOffset = {static_cast<std::int32_t>(i), 0};
+            aPushed[i] = Clock::now();
+            while (!ring.TryPush(cmd))
+                std::this_thread::yield();
+
+            while (nConsumed.load(std::memory_order_acquire) <= i
+                   && !bStop.load(std::memory_order_relaxed))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // A command out of order stops both threads; the producer is joined
+    // before anything returns
+    bool bInOrder = true;
+    ms::CameraCtrl::AnyCommand cmd;
+    for (std::size_t i = 0; i < CommandCount;)
+    {
+        if (!ring.TryPop(cmd))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto* pMove = std::get_if<ms::CameraCtrl::RelMoveCommand>(&cmd);
+        if (!pMove || pMove->ptOffset.x != static_cast<std::int32_t>(i))
+        {
+            bInOrder = false;
+            bStop.store(true, std::memory_order_relaxed);
+            break;
+        }
+        aLatencyNs[i] = ElapsedNs(aPushed[i]);
+        nConsumed.store(++i, std::memory_order_release);
+    }
+    producer.join();
+    if (!bInOrder)
+        return false;
+
+    std::sort(aLatencyNs.begin(), aLatencyNs.end());
+    std::printf("  TSpscRing<AnyCommand>: p50 %.0f ns, p99 %.0f ns\n",
+                aLatencyNs[CommandCount / 2], aLatencyNs[CommandCount * 99 / 100]);
+    return true;
+}
+
+/// 120 avatars wearing 12 distinct looks, 4 frames of 12 parts each:
+/// compositing every avatar vs compositing each look once
+auto BenchCharacterFrames() -> bool
+{
+    constexpr int LookCount = 12;
+    constexpr int AvatarCount = 120;
+    constexpr int FrameCount = 4;
+    constexpr int PartCount = 12;
+    constexpr int Edge = 48;
+
+    std::vector<std::shared_ptr<ms::SpriteInstance>> aPart;
+    for (int i = 0; i < PartCount; ++i)
+    {
+        std::vector<std::uint8_t> aPixel(Edge * Edge * 4, static_cast<std::uint8_t>(0x80 + i));
+        auto pSource = std::make_shared<ms::SpriteSource>();
+        pSource->m_pSprite = std::make_shared<ms::WzGr2DCanvas>(
+            std::make_shared<ms::WzCanvas>(Edge, Edge, std::move(aPixel)));
+        pSource->m_cx = Edge;
+        pSource->m_cy = Edge;
+        pSource->m_z = i;
+
+        auto pSprite = std::make_shared<ms::SpriteInstance>();
+        pSprite->m_pSource = std::move(pSource);
+        pSprite->m_pt = {-30 + i * 2, -60 + i * 3};
+        aPart.push_back(std::move(pSprite));
+    }
+
+    auto MakeLook = [](std::int32_t nHair)
+    {
+        ms::CharacterLook look;
+        look.nSkin = 2;
+        look.aEquip[0] = nHair;
+        look.aEquip[5] = 1040036;
+        look.Seal();
+        return look;
+    };
+
+    auto tStart = Clock::now();
+    for (int nAvatar = 0; nAvatar < AvatarCount; ++nAvatar)
+    {
+        for (int nFrame = 0; nFrame < FrameCount; ++nFrame)
+        {
+            ms::CharacterActionFrameEntry entry;
+            ms::CharacterFrameCache::Composite(aPart, 100, entry);
+        }
+    }
+    const auto nsEveryAvatar = ElapsedNs(tStart);
+
+    ms::CharacterFrameCache cache;
+    std::size_t nComposited = 0;
+    tStart = Clock::now();
+    for (int nAvatar = 0; nAvatar < AvatarCount; ++nAvatar)
+    {
+        const auto look = MakeLook(30000 + nAvatar % LookCount);
+        std::vector<std::shared_ptr<ms::CharacterActionFrameEntry>> apFE;
+        if (cache.FindAction(look, 2, apFE))
+            continue;
+
+        for (int nFrame = 0; nFrame < FrameCount; ++nFrame)
+        {
+            auto pEntry = std::make_shared<ms::CharacterActionFrameEntry>();
+            ms::CharacterFrameCache::Composite(aPart, 100, *pEntry);
+            apFE.push_back(std::move(pEntry));
+            ++nComposited;
+        }
+        cache.InsertAction(look, 2, apFE);
+    }
+    const auto nsShared = ElapsedNs(tStart);
+
+    std::printf("  every avatar:  %.0f us\n", nsEveryAvatar / 1000.0);
+    std::printf("  shared looks:  %.0f us, %zu frames composited, %zu cache hits\n",
+                nsShared / 1000.0, nComposited, cache.GetHitCount());
+    return nComposited == LookCount * FrameCount
+        && cache.GetHitCount() == AvatarCount - LookCount;
+}
+
+/// Item-ID registry lookups (600 entries) and action-name lookups:
+/// node containers vs the flat table and the compile-time perfect hash
+auto BenchActionLookup() -> bool
+{
+    constexpr int Rounds = 400;
+
+    std::map<std::int32_t, std::shared_ptr<int>> mTree;
+    ms::TFlatHashMap<std::int32_t, std::shared_ptr<int>> mFlat;
+    std::vector<std::int32_t> anID;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 600; ++i)
+    {
+        const auto nID = 1000000 + static_cast<std::int32_t>(rng() % 800000);
+        auto p = std::make_shared<int>(i);
+        mTree[nID] = p;
+        mFlat[nID] = p;
+        anID.push_back(nID);
+    }
+
+    std::int64_t nSumTree = 0;
+    auto tStart = Clock::now();
+    for (int r = 0; r < Rounds; ++r)
+        for (const auto nID : anID)
+            nSumTree += *mTree.find(nID)->second;
+    const auto nsTree = ElapsedNs(tStart);
+
+    std::int64_t nSumFlat = 0;
+    tStart = Clock::now();
+    for (int r = 0; r < Rounds; ++r)
+        for (const auto nID : anID)
+            nSumFlat += **mFlat.Find(nID);
+    const auto nsFlat = ElapsedNs(tStart);
+
+    // Action names as they arrive from WZ strings
+    std::unordered_map<std::string, std::int32_t> mName;
+    std::vector<std::string> asName;
+    for (std::size_t i = 0; i < ms::ACTIONDATA_COUNT; ++i)
+    {
+        mName.emplace(std::string(ms::s_aActionSpec[i].sName), static_cast<std::int32_t>(i));
+        asName.emplace_back(ms::s_aActionSpec[i].sName);
+    }
+
+    std::int64_t nCodeMap = 0;
+    tStart = Clock::now();
+    for (int r = 0; r < Rounds / 4; ++r)
+        for (const auto& sName : asName)
+            nCodeMap += mName.find(sName)->second;
+    const auto nsMap = ElapsedNs(tStart);
+
+    std::int64_t nCodeHash = 0;
+    tStart = Clock::now();
+    for (int r = 0; r < Rounds / 4; ++r)
+        for (const auto& sName : asName)
+            nCodeHash += ms::get_action_code_from_name(sName);
+    const auto nsHash = ElapsedNs(tStart);
+
+    const double nIdLookups = static_cast<double>(Rounds) * static_cast<double>(anID.size());
+    const double nNameLookups = static_cast<double>(Rounds / 4) * static_cast<double>(asName.size());
+    std::printf("  id lookup:   std::map %.1f ns, TFlatHashMap %.1f ns\n",
+                nsTree / nIdLookups, nsFlat / nIdLookups);
+    std::printf("  name lookup: unordered_map %.1f ns, perfect hash %.1f ns\n",
+                nsMap / nNameLookups, nsHash / nNameLookups);
+    return nSumTree == nSumFlat && nCodeMap == nCodeHash;
+}
+
+// ========== Driver ==========
+
+struct Case
+{
+    std::string_view sName;
+    std::string_view sInfo;
+    auto (*pfnRun)() -> bool;
+};
+
+constexpr Case s_aCase[] = {
+    {"rtree", "100k ground probes, 2000 segments: static R-tree vs R*-tree", BenchStaticRTree},
+    {"column", "100k ground probes, 2000 footholds: column table vs R-tree", BenchFootholdColumn},
+    {"movers", "1000 movers x 1000 ticks on stacked platforms", BenchMoverBatch},
+    {"particles", "10k particles x 200 steps through the array-per-field store", BenchParticles},
+    {"resolver", "60 frames x 10101 vectors resolved in dependency order", BenchVectorResolver},
+    {"easing", "10k bouncing tweens x 600 frames through the mode kernels", BenchEasing},
+    {"camera", "2000 camera commands handed between two threads", BenchCameraQueue},
+    {"looks", "120 avatars over 12 looks: per-avatar vs shared composited frames", BenchCharacterFrames},
+    {"actions", "id and action-name lookups: node containers vs flat tables", BenchActionLookup},
+};
+
+auto RunCase(const Case& c) -> bool
+{
+    std::printf("%.*s: %.*s\n", static_cast<int>(c.sName.size()), c.sName.data(),
+                static_cast<int>(c.sInfo.size()), c.sInfo.data());
+    const bool bOk = c.pfnRun();
+    if (!bOk)
+        std::printf("  FAILED: results differ\n");
+    return bOk;
+}
+
+void PrintUsage(const char* prog)
+{
+    std::printf("Usage: %s [--list] [case...]\n", prog);
+    std::printf("  --list    List the cases and exit\n");
+    std::printf("  case      Case to run (default: all)\n");
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::vector<const Case*> apCase;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--list")
+        {
+            for (const auto& c : s_aCase)
+                std::printf("%-10.*s %.*s\n", static_cast<int>(c.sName.size()), c.sName.data(),
+                            static_cast<int>(c.sInfo.size()), c.sInfo.data());
+            return EXIT_SUCCESS;
+        }
+
+        const Case* pCase = nullptr;
+        for (const auto& c : s_aCase)
+        {
+            if (c.sName == arg)
+                pCase = &c;
+        }
+        if (!pCase)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        apCase.push_back(pCase);
+    }
+    if (apCase.empty())
+    {
+        for (const auto& c : s_aCase)
+            apCase.push_back(&c);
+    }
+
+    ms::Logger::Initialize();
+    bool bOk = true;
+    for (const auto* pCase : apCase)
+        bOk = RunCase(*pCase) && bOk;
+    ms::Logger::Shutdown();
+
+    return bOk ? EXIT_SUCCESS : EXIT_FAILURE;
+}
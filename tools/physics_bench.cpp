@@ -0,0 +1,399 @@
+/**
+ * @file physics_bench.cpp
+ * @brief Headless physics replay for benchmarking and regression checks
+ *
+ * Loads one map's footholds into WvsPhysicalSpace2D and times the foothold
+ * queries (GetFootholdUnderneath, GetCrossCandidate) at seeded points over
+ * the map. Then drops N movers with scripted walk input at seeded positions
+ * and runs VecCtrlWorld for M ticks. No window, renderer or Application is
+ * created.
+ *
+ * Usage:
+ *   ./PhysicsBench --wz-path /path/to/Data --map 100000000
+ *                  [--movers 500] [--ticks 1000] [--queries 100000] [--seed 1]
+ *                  [--golden file.txt] [--write-golden]
+ *
+ * Prints ns/query, ns/tick and the number of heap allocations made while
+ * stepping. With --golden the final positions are compared against the
+ * file (exit code 1 on mismatch); --write-golden (re)creates it instead.
+ *
+ * Manual tool: it needs the game's WZ data, which is not in the repository,
+ * so no golden file is checked in and nothing runs it automatically. Write
+ * a golden file from a known-good build and compare against it locally.
+ */
+
+#include "graphics/VecCtrl.h"
+#include "physics/VecCtrlWorld.h"
+#include "physics/WvsPhysicalSpace2D.h"
+#include "util/Logger.h"
+#include "util/Rand32.h"
+#include "wz/WzProperty.h"
+#include "wz/WzResMan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ========== Allocation counting ==========
+
+namespace
+{
+std::atomic<std::uint64_t> g_nAllocation{0};
+} // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    g_nAllocation.fetch_add(1, std::memory_order_relaxed);
+    if (auto* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+// ========== Bench ==========
+
+namespace
+{
+
+struct Options
+{
+    std::string sWzPath;
+    std::int32_t nMapId{-1};
+    std::int32_t nMover{500};
+    std::int32_t nTick{1000};
+    std::int32_t nQuery{100000};
+    std::uint32_t uSeed{1};
+    std::string sGolden;
+    bool bWriteGolden{};
+};
+
+void PrintUsage(const char* prog)
+{
+    std::printf("Usage: %s --wz-path <path> --map <mapId> [options]\n", prog);
+    std::printf("  --movers <n>      Number of movers (default 500)\n");
+    std::printf("  --ticks <n>       Ticks to simulate (default 1000)\n");
+    std::printf("  --queries <n>     Foothold queries to time, 0 to skip (default 100000)\n");
+    std::printf("  --seed <n>        Spawn/input seed (default 1)\n");
+    std::printf("  --golden <file>   Compare final positions against file\n");
+    std::printf("  --write-golden    Write the golden file instead of comparing\n");
+}
+
+/// Whole-string integer parse; false on junk, trailing text or overflow
+template <typename T>
+auto ParseNumber(const char* text, T& value) -> bool
+{
+    const auto* end = text + std::strlen(text);
+    const auto [ptr, ec] = std::from_chars(text, end, value);
+    return ec == std::errc{} && ptr == end;
+}
+
+auto ParseOptions(int argc, char* argv[], Options& opt) -> bool
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool bHasValue = i + 1 < argc;
+        if ((arg == "--wz-path" || arg == "-w") && bHasValue)
+            opt.sWzPath = argv[++i];
+        else if ((arg == "--map" || arg == "-m") && bHasValue)
+        {
+            if (!ParseNumber(argv[++i], opt.nMapId))
+                return false;
+        }
+        else if (arg == "--movers" && bHasValue)
+        {
+            if (!ParseNumber(argv[++i], opt.nMover))
+                return false;
+        }
+        else if (arg == "--ticks" && bHasValue)
+        {
+            if (!ParseNumber(argv[++i], opt.nTick))
+                return false;
+        }
+        else if (arg == "--queries" && bHasValue)
+        {
+            if (!ParseNumber(argv[++i], opt.nQuery))
+                return false;
+        }
+        else if (arg == "--seed" && bHasValue)
+        {
+            if (!ParseNumber(argv[++i], opt.uSeed))
+                return false;
+        }
+        else if (arg == "--golden" && bHasValue)
+            opt.sGolden = argv[++i];
+        else if (arg == "--write-golden")
+            opt.bWriteGolden = true;
+        else
+            return false;
+    }
+    if (opt.bWriteGolden && opt.sGolden.empty())
+        return false;
+    return !opt.sWzPath.empty() && opt.nMapId >= 0 && opt.nMover > 0 && opt.nTick > 0
+        && opt.nQuery >= 0;
+}
+
+auto LoadSpace(std::int32_t nMapId) -> bool
+{
+    auto& resMan = ms::WzResMan::GetInstance();
+
+    // Same paths as MapViewStage::ResolveMapProperties
+    char imgPath[128];
+    std::snprintf(imgPath, sizeof(imgPath), "Map/Map%d/%09d.img", nMapId / 100000000, nMapId);
+    char infoPath[128];
+    std::snprintf(infoPath, sizeof(infoPath), "Map/MapInfo.img/%d", nMapId);
+
+    auto pPropField = resMan.GetProperty(imgPath);
+    if (!pPropField)
+    {
+        LOG_ERROR("PhysicsBench: Could not resolve map property: {}", imgPath);
+        return false;
+    }
+
+    auto pPropInfo = resMan.GetProperty(infoPath);
+    if (!pPropInfo)
+        pPropInfo = pPropField->GetChild("info");
+
+    ms::WvsPhysicalSpace2D::GetInstance().Load(
+        pPropField->GetChild("foothold"), pPropField->GetChild("ladderRope"), pPropInfo);
+    return true;
+}
+
+/// Times the R-tree queries VecCtrl makes, at random points over the map
+void RunQueries(const Options& opt)
+{
+    auto& space2D = ms::WvsPhysicalSpace2D::GetInstance();
+    const auto& rcMBR = space2D.GetMBR();
+
+    // Points are drawn up front so the timing covers only the queries;
+    // segments are about one tick of fast movement long
+    ms::Rand32 rand(opt.uSeed);
+    auto RandomIn = [&rand](std::int32_t nLow, std::int32_t nHigh) -> std::int32_t
+    {
+        const auto nRange = static_cast<std::uint32_t>(nHigh - nLow) + 1;
+        return nLow + static_cast<std::int32_t>(static_cast<std::uint32_t>(rand.Random()) % nRange);
+    };
+
+    std::vector<ms::Rect> aQuery(static_cast<std::size_t>(opt.nQuery));
+    for (auto& rc : aQuery)
+    {
+        rc.left = RandomIn(rcMBR.left, rcMBR.right);
+        rc.top = RandomIn(rcMBR.top, rcMBR.bottom);
+        rc.right = rc.left + RandomIn(-20, 20);
+        rc.bottom = rc.top + RandomIn(-20, 20);
+    }
+
+    std::size_t nUnderneath = 0;
+    auto tStart = std::chrono::steady_clock::now();
+    for (const auto& rc : aQuery)
+    {
+        std::int32_t cy = 0;
+        if (space2D.GetFootholdUnderneath(rc.left, rc.top, &cy, rcMBR.bottom, 1))
+            ++nUnderneath;
+    }
+    const auto nsUnderneath = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - tStart).count();
+
+    std::vector<const ms::IStaticFoothold*> apCandidate;
+    std::size_t nCandidate = 0;
+    tStart = std::chrono::steady_clock::now();
+    for (const auto& rc : aQuery)
+    {
+        apCandidate.clear();
+        space2D.GetCrossCandidate(rc.left, rc.top, rc.right, rc.bottom, &apCandidate);
+        nCandidate += apCandidate.size();
+    }
+    const auto nsCross = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - tStart).count();
+
+    std::printf("map %d: %d foothold queries\n", opt.nMapId, opt.nQuery);
+    std::printf("  GetFootholdUnderneath: %.1f ns/query, %zu hits\n",
+                static_cast<double>(nsUnderneath) / opt.nQuery, nUnderneath);
+    std::printf("  GetCrossCandidate:     %.1f ns/query, %zu candidates\n",
+                static_cast<double>(nsCross) / opt.nQuery, nCandidate);
+}
+
+/// One line per mover: index, rounded position, whether it stands on a foothold
+auto DumpState(const std::vector<std::unique_ptr<ms::VecCtrl>>& aMover, const Options& opt)
+    -> std::string
+{
+    std::ostringstream os;
+    os << "# map=" << opt.nMapId << " movers=" << opt.nMover
+       << " ticks=" << opt.nTick << " seed=" << opt.uSeed << '\n';
+    for (std::size_t i = 0; i < aMover.size(); ++i)
+    {
+        const auto& vc = *aMover[i];
+        os << i << ' ' << std::lround(static_cast<double>(vc.m_ap.x))
+           << ' ' << std::lround(static_cast<double>(vc.m_ap.y))
+           << ' ' << (vc.m_pfh.Get() ? 1 : 0) << '\n';
+    }
+    return os.str();
+}
+
+auto CheckGolden(const std::string& sState, const Options& opt) -> bool
+{
+    if (opt.bWriteGolden)
+    {
+        std::ofstream file(opt.sGolden, std::ios::trunc);
+        file << sState;
+        std::printf("Golden file written: %s\n", opt.sGolden.c_str());
+        return static_cast<bool>(file);
+    }
+
+    std::ifstream file(opt.sGolden);
+    if (!file)
+    {
+        std::printf("Golden file not found: %s\n", opt.sGolden.c_str());
+        return false;
+    }
+
+    std::istringstream actual(sState);
+    std::string sExpected;
+    std::string sActual;
+    for (int nLine = 1;; ++nLine)
+    {
+        const bool bExpected = static_cast<bool>(std::getline(file, sExpected));
+        const bool bActual = static_cast<bool>(std::getline(actual, sActual));
+        if (!bExpected && !bActual)
+            break;
+
+        if (bExpected != bActual || sExpected != sActual)
+        {
+            std::printf("Golden mismatch at line %d:\n  expected: %s\n  actual:   %s\n",
+                        nLine, bExpected ? sExpected.c_str() : "<eof>",
+                        bActual ? sActual.c_str() : "<eof>");
+            return false;
+        }
+    }
+
+    std::printf("Golden file matches: %s\n", opt.sGolden.c_str());
+    return true;
+}
+
+auto Run(const Options& opt) -> bool
+{
+    auto& resMan = ms::WzResMan::GetInstance();
+    resMan.SetBasePath(opt.sWzPath);
+    if (!resMan.Initialize())
+    {
+        LOG_ERROR("PhysicsBench: Failed to initialize WzResMan from path: {}", opt.sWzPath);
+        return false;
+    }
+
+    if (!LoadSpace(opt.nMapId))
+        return false;
+
+    auto& space2D = ms::WvsPhysicalSpace2D::GetInstance();
+    const auto& rcMBR = space2D.GetMBR();
+    if (rcMBR.right <= rcMBR.left)
+    {
+        LOG_ERROR("PhysicsBench: Map {} has no footholds", opt.nMapId);
+        return false;
+    }
+
+    if (opt.nQuery > 0)
+        RunQueries(opt);
+
+    // Spawn along the top of the map; everyone falls onto the nearest floor
+    ms::Rand32 rand(opt.uSeed);
+    auto RandomIn = [&rand](std::int32_t nLow, std::int32_t nHigh) -> std::int32_t
+    {
+        const auto nRange = static_cast<std::uint32_t>(nHigh - nLow) + 1;
+        return nLow + static_cast<std::int32_t>(static_cast<std::uint32_t>(rand.Random()) % nRange);
+    };
+
+    auto& world = ms::VecCtrlWorld::GetInstance();
+    std::vector<std::unique_ptr<ms::VecCtrl>> aMover;
+    aMover.reserve(static_cast<std::size_t>(opt.nMover));
+    for (std::int32_t i = 0; i < opt.nMover; ++i)
+    {
+        auto pVecCtrl = std::make_unique<ms::VecCtrl>();
+        pVecCtrl->Init(RandomIn(rcMBR.left, rcMBR.right), rcMBR.top);
+        pVecCtrl->m_bActive = 1;
+        aMover.push_back(std::move(pVecCtrl));
+    }
+
+    // Scripted input: every mover rethinks its direction once a second,
+    // staggered so the changes spread over the ticks
+    constexpr std::int32_t InputPeriod = 1000 / ms::VecCtrlWorld::TickInterval;
+    auto UpdateInput = [&](std::int32_t nTick)
+    {
+        for (std::size_t i = 0; i < aMover.size(); ++i)
+        {
+            if ((nTick + static_cast<std::int32_t>(i)) % InputPeriod == 0)
+                aMover[i]->m_nInputX = RandomIn(-1, 1);
+        }
+    };
+
+    // First tick outside the measurement: it sizes the reused buffers
+    UpdateInput(0);
+    world.Step();
+
+    const auto nAllocBefore = g_nAllocation.load(std::memory_order_relaxed);
+    const auto tStart = std::chrono::steady_clock::now();
+    for (std::int32_t nTick = 1; nTick < opt.nTick; ++nTick)
+    {
+        UpdateInput(nTick);
+        world.Step();
+    }
+    const auto tElapsed = std::chrono::steady_clock::now() - tStart;
+    const auto nAlloc = g_nAllocation.load(std::memory_order_relaxed) - nAllocBefore;
+
+    const auto nMeasured = std::max(opt.nTick - 1, 1);
+    const auto nsTotal = std::chrono::duration_cast<std::chrono::nanoseconds>(tElapsed).count();
+    std::size_t nGrounded = 0;
+    for (const auto& pVecCtrl : aMover)
+        nGrounded += pVecCtrl->m_pfh.Get() ? 1u : 0u;
+
+    std::printf("map %d: %d movers, %d ticks\n", opt.nMapId, opt.nMover, opt.nTick);
+    std::printf("  %.0f ns/tick, %.1f ns/mover/tick\n",
+                static_cast<double>(nsTotal) / nMeasured,
+                static_cast<double>(nsTotal) / nMeasured / opt.nMover);
+    std::printf("  %llu allocations while stepping\n", static_cast<unsigned long long>(nAlloc));
+    std::printf("  %zu/%d movers on a foothold at the end\n", nGrounded, opt.nMover);
+
+    bool bOk = true;
+    if (!opt.sGolden.empty())
+        bOk = CheckGolden(DumpState(aMover, opt), opt);
+
+    world.Clear();
+    return bOk;
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    Options opt;
+    if (!ParseOptions(argc, argv, opt))
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ms::Logger::Initialize();
+    const bool bOk = Run(opt);
+    ms::Logger::Shutdown();
+
+    return bOk ? EXIT_SUCCESS : EXIT_FAILURE;
+}